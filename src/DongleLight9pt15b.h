@@ -1,192 +1,281 @@
-const uint8_t Dongle_Light15pt7bBitmaps[] PROGMEM = {
-  0x00, 0x55, 0x55, 0x4F, 0x99, 0x99, 0x00, 0x00, 0x8C, 0x08, 0x87, 0xFF,
-  0x18, 0x81, 0x10, 0x11, 0x03, 0x10, 0xFF, 0xC2, 0x20, 0x22, 0x06, 0x20,
-  0x08, 0x04, 0x0F, 0x89, 0x78, 0x84, 0x43, 0x20, 0x78, 0x0F, 0x04, 0xC2,
-  0x21, 0x1C, 0x99, 0xF0, 0x20, 0x10, 0x08, 0x00, 0x78, 0x24, 0x22, 0x21,
-  0x31, 0x0B, 0x07, 0x90, 0x01, 0x00, 0x1B, 0xC1, 0xB3, 0x19, 0x08, 0x88,
-  0x4C, 0x66, 0xC1, 0xE0, 0x1C, 0x08, 0x82, 0x20, 0x88, 0x1C, 0x0E, 0x06,
-  0xCB, 0x12, 0xC3, 0xB0, 0xE6, 0x38, 0xF3, 0xF0, 0x32, 0x44, 0x48, 0x88,
-  0x88, 0x88, 0xC4, 0x42, 0x20, 0x84, 0x22, 0x21, 0x11, 0x11, 0x11, 0x32,
-  0x24, 0x40, 0x10, 0x55, 0xCC, 0x7C, 0x41, 0x00, 0x08, 0x08, 0x08, 0xFF,
-  0x08, 0x08, 0x08, 0x08, 0x3E, 0x80, 0xFC, 0xF0, 0x04, 0x10, 0xC2, 0x08,
-  0x61, 0x04, 0x10, 0x82, 0x08, 0x41, 0x04, 0x20, 0x80, 0x3C, 0x42, 0xC2,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC2, 0x42, 0x3C, 0x3F, 0x11, 0x11,
-  0x11, 0x11, 0x11, 0x3C, 0x63, 0x41, 0x41, 0x01, 0x02, 0x06, 0x0C, 0x18,
-  0x30, 0x60, 0x7F, 0x3C, 0x46, 0x42, 0x02, 0x06, 0x1C, 0x02, 0x01, 0x01,
-  0xC1, 0x62, 0x3C, 0x06, 0x07, 0x02, 0x83, 0x43, 0x21, 0x11, 0x89, 0x84,
-  0xFF, 0x81, 0x00, 0x80, 0x40, 0x7E, 0x81, 0x02, 0x0F, 0x80, 0x80, 0x81,
-  0x02, 0x06, 0x13, 0xC0, 0x0C, 0x18, 0x20, 0x40, 0x7C, 0x42, 0x81, 0x81,
-  0x81, 0x81, 0x42, 0x3C, 0xFF, 0x03, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08,
-  0x18, 0x10, 0x10, 0x30, 0x3C, 0x66, 0x42, 0x66, 0x3C, 0x42, 0x81, 0x81,
-  0x81, 0x81, 0x42, 0x3C, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x43, 0x3E, 0x06,
-  0x0C, 0x0C, 0x18, 0x30, 0xF0, 0x03, 0xC0, 0xF0, 0x03, 0xE8, 0x02, 0x18,
-  0x63, 0x8C, 0x18, 0x1C, 0x0C, 0x0C, 0x04, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-  0x80, 0xC0, 0xC0, 0x60, 0x60, 0xC7, 0x18, 0x61, 0x00, 0x7B, 0x38, 0x41,
-  0x08, 0x42, 0x08, 0x20, 0x03, 0x0C, 0x0F, 0xC1, 0x83, 0x19, 0xD4, 0x91,
-  0x99, 0x0C, 0xC8, 0x66, 0x42, 0x33, 0x32, 0x8F, 0xE2, 0x00, 0x18, 0x00,
-  0x60, 0x00, 0xFC, 0x00, 0x0C, 0x07, 0x01, 0x60, 0x48, 0x33, 0x08, 0x46,
-  0x11, 0xFE, 0x40, 0xB0, 0x38, 0x0E, 0x01, 0xFC, 0x86, 0x82, 0x82, 0x86,
-  0xFE, 0x83, 0x81, 0x81, 0x81, 0x82, 0xFC, 0x1F, 0x8C, 0x24, 0x03, 0x00,
-  0x80, 0x20, 0x08, 0x02, 0x00, 0x40, 0x10, 0x03, 0x0C, 0x7E, 0xFE, 0x20,
-  0xC8, 0x0A, 0x03, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0xE0, 0x28, 0x33,
-  0xF8, 0xFD, 0x02, 0x04, 0x08, 0x1F, 0xA0, 0x40, 0x81, 0x02, 0x07, 0xF0,
-  0xFE, 0x08, 0x20, 0x83, 0xF8, 0x20, 0x82, 0x08, 0x20, 0x1F, 0x83, 0x0C,
-  0x40, 0x0C, 0x00, 0x80, 0x08, 0x3E, 0x80, 0x38, 0x02, 0x40, 0x24, 0x06,
-  0x30, 0xC1, 0xF0, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0F, 0xFE, 0x03, 0x01,
-  0x80, 0xC0, 0x60, 0x30, 0x10, 0xFF, 0xF0, 0x08, 0x42, 0x10, 0x84, 0x21,
-  0x08, 0x67, 0xE0, 0x83, 0x86, 0x84, 0x88, 0x90, 0xE0, 0xF0, 0x98, 0x8C,
-  0x86, 0x83, 0x81, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x3F,
-  0x60, 0x73, 0x83, 0x94, 0x14, 0xB1, 0xA4, 0x89, 0x24, 0x49, 0x14, 0x58,
-  0xA2, 0xC7, 0x1E, 0x10, 0xF0, 0x07, 0x00, 0x10, 0xC0, 0xE0, 0x78, 0x36,
-  0x19, 0x0C, 0xC6, 0x33, 0x09, 0x86, 0xC1, 0xE0, 0x70, 0x30, 0x1F, 0x83,
-  0x0C, 0x40, 0x2C, 0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xC0, 0x34,
-  0x02, 0x30, 0xC1, 0xF8, 0xFC, 0x82, 0x81, 0x81, 0x81, 0x82, 0xFC, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x1F, 0x83, 0x0C, 0x40, 0x2C, 0x03, 0x80, 0x18,
-  0x01, 0x80, 0x18, 0x01, 0xC1, 0xB4, 0x0E, 0x30, 0xE0, 0xFB, 0xFC, 0x82,
-  0x81, 0x81, 0x81, 0x82, 0xFC, 0x86, 0x82, 0x83, 0x83, 0x81, 0x3E, 0xC3,
-  0x80, 0x80, 0xC0, 0x78, 0x0E, 0x03, 0x01, 0x81, 0xC2, 0x7C, 0xFF, 0x84,
-  0x02, 0x01, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00,
-  0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x50,
-  0xC7, 0xC0, 0x80, 0x70, 0x34, 0x0D, 0x02, 0x61, 0x88, 0x42, 0x10, 0xCC,
-  0x12, 0x07, 0x80, 0xE0, 0x30, 0x80, 0x0C, 0x10, 0x71, 0xC3, 0x8A, 0x34,
-  0x51, 0xA2, 0xC9, 0x22, 0x49, 0x12, 0x68, 0xB1, 0xC3, 0x8C, 0x18, 0x60,
-  0xC0, 0xC0, 0xD8, 0x63, 0x10, 0xCC, 0x1E, 0x03, 0x00, 0xC0, 0x48, 0x33,
-  0x18, 0x64, 0x0B, 0x03, 0x80, 0xE0, 0xD8, 0xC4, 0x43, 0x60, 0xE0, 0x20,
-  0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0xFF, 0x01, 0x80, 0xC0, 0xC0, 0xC0,
-  0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x1F, 0xF0, 0xF8, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0xF0, 0x82, 0x04, 0x10, 0x40, 0x82, 0x08, 0x10,
-  0x41, 0x02, 0x08, 0x20, 0x41, 0x04, 0xF1, 0x11, 0x11, 0x11, 0x11, 0x11,
-  0x11, 0x11, 0xF0, 0x18, 0x18, 0x2C, 0x24, 0x46, 0x42, 0xC3, 0x00, 0xFF,
-  0xC0, 0x0C, 0x61, 0x3D, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D,
-  0x80, 0x80, 0x80, 0x80, 0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC2,
-  0xBC, 0x3E, 0x62, 0xC0, 0x80, 0x80, 0x80, 0xC0, 0x63, 0x3C, 0x01, 0x01,
-  0x01, 0x01, 0x3D, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x3C,
-  0x46, 0x83, 0x81, 0xFF, 0x80, 0x80, 0x43, 0x3E, 0x1C, 0x40, 0x81, 0x0F,
-  0xC4, 0x08, 0x10, 0x20, 0x40, 0x81, 0x02, 0x00, 0x3D, 0x43, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x43, 0x3D, 0x01, 0x01, 0x42, 0x7C, 0x80, 0x80, 0x80,
-  0x80, 0xBC, 0xC2, 0xC1, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xF0, 0x55,
-  0x55, 0x40, 0x33, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xE0, 0x81,
-  0x02, 0x04, 0x08, 0x51, 0xAC, 0x70, 0xA1, 0x22, 0x64, 0x68, 0x60, 0xFF,
-  0xF8, 0xBC, 0xF6, 0x38, 0xA0, 0x83, 0x04, 0x18, 0x20, 0xC1, 0x06, 0x08,
-  0x30, 0x41, 0x82, 0x08, 0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C, 0x07, 0x06, 0xC6, 0x3E, 0x00,
-  0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC2, 0xBC, 0x80, 0x80, 0x80,
-  0x80, 0x3D, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x01, 0x01,
-  0x01, 0x01, 0xBE, 0x21, 0x08, 0x42, 0x10, 0x80, 0x7D, 0x8E, 0x07, 0x07,
-  0xC0, 0xC0, 0xE1, 0x7C, 0x20, 0x40, 0x87, 0xE2, 0x04, 0x08, 0x10, 0x20,
-  0x40, 0x80, 0xE0, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C,
-  0xC1, 0xA0, 0x98, 0x44, 0x62, 0x21, 0xB0, 0x50, 0x38, 0x08, 0x00, 0x42,
-  0x1A, 0x38, 0x91, 0x44, 0xCA, 0x22, 0x5B, 0x16, 0x50, 0xA2, 0x83, 0x1C,
-  0x18, 0xC0, 0xC1, 0x31, 0x8D, 0x83, 0x81, 0xC1, 0xA0, 0x88, 0x86, 0xC1,
-  0x00, 0xC0, 0xA0, 0xD8, 0x44, 0x62, 0x31, 0x90, 0x58, 0x38, 0x0C, 0x04,
-  0x02, 0x03, 0x01, 0x00, 0xFE, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0,
-  0xFF, 0x39, 0x08, 0x42, 0x10, 0x84, 0xC1, 0x08, 0x42, 0x10, 0x84, 0x38,
-  0xFF, 0xFF, 0xE0, 0xE1, 0x08, 0x42, 0x10, 0x84, 0x19, 0x08, 0x42, 0x10,
-  0x84, 0xE0, 0x70, 0xA4, 0x51, 0xC0 };
+// Generated by tools/fontsubset.py
+constexpr uint8_t Dongle_Light15ptBitmaps[] PROGMEM = {
+  0x55, 0x55, 0x4F, 0x99, 0x99, 0x08, 0xC0, 0x88, 0x7F, 0xF1, 0x88, 0x11,
+  0x01, 0x10, 0x31, 0x0F, 0xFC, 0x22, 0x02, 0x20, 0x62, 0x00, 0x08, 0x04,
+  0x0F, 0x89, 0x78, 0x84, 0x43, 0x20, 0x78, 0x0F, 0x04, 0xC2, 0x21, 0x1C,
+  0x99, 0xF0, 0x20, 0x10, 0x08, 0x00, 0x78, 0x24, 0x22, 0x21, 0x31, 0x0B,
+  0x07, 0x90, 0x01, 0x00, 0x1B, 0xC1, 0xB3, 0x19, 0x08, 0x88, 0x4C, 0x66,
+  0xC1, 0xE0, 0x1C, 0x08, 0x82, 0x20, 0x88, 0x1C, 0x0E, 0x06, 0xCB, 0x12,
+  0xC3, 0xB0, 0xE6, 0x38, 0xF3, 0xF0, 0x32, 0x44, 0x48, 0x88, 0x88, 0x88,
+  0xC4, 0x42, 0x20, 0x84, 0x22, 0x21, 0x11, 0x11, 0x11, 0x32, 0x24, 0x40,
+  0x21, 0x6E, 0xCF, 0x90, 0x80, 0x08, 0x08, 0x08, 0xFF, 0x08, 0x08, 0x08,
+  0x08, 0xFA, 0xFC, 0xF0, 0x04, 0x10, 0xC2, 0x08, 0x61, 0x04, 0x10, 0x82,
+  0x08, 0x41, 0x04, 0x20, 0x80, 0x3C, 0x42, 0xC2, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xC2, 0x42, 0x3C, 0x3F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x79,
+  0x8E, 0x0C, 0x10, 0x20, 0x83, 0x0C, 0x30, 0xC3, 0x07, 0xF0, 0x3C, 0x46,
+  0x42, 0x02, 0x06, 0x1C, 0x02, 0x01, 0x01, 0xC1, 0x62, 0x3C, 0x06, 0x07,
+  0x02, 0x83, 0x43, 0x21, 0x11, 0x89, 0x84, 0xFF, 0x81, 0x00, 0x80, 0x40,
+  0x7E, 0x81, 0x02, 0x0F, 0x80, 0x80, 0x81, 0x02, 0x06, 0x13, 0xC0, 0x0C,
+  0x18, 0x20, 0x40, 0x7C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0xFF,
+  0x03, 0x03, 0x02, 0x06, 0x04, 0x0C, 0x08, 0x18, 0x10, 0x10, 0x30, 0x3C,
+  0x66, 0x42, 0x66, 0x3C, 0x42, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x3C,
+  0x42, 0x81, 0x81, 0x81, 0x43, 0x3E, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0xF0,
+  0x03, 0xC0, 0xF0, 0x03, 0xE8, 0x02, 0x18, 0x63, 0x8C, 0x18, 0x1C, 0x0C,
+  0x0C, 0x04, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0x80, 0xC0, 0xC0, 0x60, 0x60,
+  0xC7, 0x18, 0x61, 0x00, 0x7B, 0x38, 0x41, 0x08, 0x42, 0x08, 0x20, 0x03,
+  0x0C, 0x0F, 0xC1, 0x83, 0x19, 0xD4, 0x91, 0x99, 0x0C, 0xC8, 0x66, 0x42,
+  0x33, 0x32, 0x8F, 0xE2, 0x00, 0x18, 0x00, 0x60, 0x00, 0xFC, 0x00, 0x0C,
+  0x07, 0x01, 0x60, 0x48, 0x33, 0x08, 0x46, 0x11, 0xFE, 0x40, 0xB0, 0x38,
+  0x0E, 0x01, 0xFC, 0x86, 0x82, 0x82, 0x86, 0xFE, 0x83, 0x81, 0x81, 0x81,
+  0x82, 0xFC, 0x1F, 0x8C, 0x24, 0x03, 0x00, 0x80, 0x20, 0x08, 0x02, 0x00,
+  0x40, 0x10, 0x03, 0x0C, 0x7E, 0xFE, 0x20, 0xC8, 0x0A, 0x03, 0x80, 0x60,
+  0x18, 0x06, 0x01, 0x80, 0xE0, 0x28, 0x33, 0xF8, 0xFD, 0x02, 0x04, 0x08,
+  0x1F, 0xA0, 0x40, 0x81, 0x02, 0x07, 0xF0, 0xFE, 0x08, 0x20, 0x83, 0xF8,
+  0x20, 0x82, 0x08, 0x20, 0x1F, 0x83, 0x0C, 0x40, 0x0C, 0x00, 0x80, 0x08,
+  0x3E, 0x80, 0x38, 0x02, 0x40, 0x24, 0x06, 0x30, 0xC1, 0xF0, 0x80, 0xC0,
+  0x60, 0x30, 0x18, 0x0F, 0xFE, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x10,
+  0xFF, 0xF0, 0x08, 0x42, 0x10, 0x84, 0x21, 0x08, 0x67, 0xE0, 0x83, 0x86,
+  0x84, 0x88, 0x90, 0xE0, 0xF0, 0x98, 0x8C, 0x86, 0x83, 0x81, 0x82, 0x08,
+  0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x3F, 0x60, 0x73, 0x83, 0x94, 0x14,
+  0xB1, 0xA4, 0x89, 0x24, 0x49, 0x14, 0x58, 0xA2, 0xC7, 0x1E, 0x10, 0xF0,
+  0x07, 0x00, 0x10, 0xC0, 0xE0, 0x78, 0x36, 0x19, 0x0C, 0xC6, 0x33, 0x09,
+  0x86, 0xC1, 0xE0, 0x70, 0x30, 0x1F, 0x83, 0x0C, 0x40, 0x2C, 0x03, 0x80,
+  0x18, 0x01, 0x80, 0x18, 0x01, 0xC0, 0x34, 0x02, 0x30, 0xC1, 0xF8, 0xFC,
+  0x82, 0x81, 0x81, 0x81, 0x82, 0xFC, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1F,
+  0x83, 0x0C, 0x40, 0x2C, 0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01, 0xC1,
+  0xB4, 0x0E, 0x30, 0xE0, 0xFB, 0xFC, 0x82, 0x81, 0x81, 0x81, 0x82, 0xFC,
+  0x86, 0x82, 0x83, 0x83, 0x81, 0x3E, 0xC3, 0x80, 0x80, 0xC0, 0x78, 0x0E,
+  0x03, 0x01, 0x81, 0xC2, 0x7C, 0xFF, 0x84, 0x02, 0x01, 0x00, 0x80, 0x40,
+  0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x18,
+  0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x50, 0xC7, 0xC0, 0x80, 0x70, 0x34,
+  0x0D, 0x02, 0x61, 0x88, 0x42, 0x10, 0xCC, 0x12, 0x07, 0x80, 0xE0, 0x30,
+  0x80, 0x0C, 0x10, 0x71, 0xC3, 0x8A, 0x34, 0x51, 0xA2, 0xC9, 0x22, 0x49,
+  0x12, 0x68, 0xB1, 0xC3, 0x8C, 0x18, 0x60, 0xC0, 0xC0, 0xD8, 0x63, 0x10,
+  0xCC, 0x1E, 0x03, 0x00, 0xC0, 0x48, 0x33, 0x18, 0x64, 0x0B, 0x03, 0x80,
+  0xE0, 0xD8, 0xC4, 0x43, 0x60, 0xE0, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+  0x00, 0xFF, 0x01, 0x80, 0xC0, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0x30,
+  0x30, 0x1F, 0xF0, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xF0,
+  0x82, 0x04, 0x10, 0x40, 0x82, 0x08, 0x10, 0x41, 0x02, 0x08, 0x20, 0x41,
+  0x04, 0xF1, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xF0, 0x18, 0x18,
+  0x2C, 0x24, 0x46, 0x42, 0xC3, 0xFF, 0xC0, 0xC6, 0x10, 0x3D, 0x43, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x80, 0x80, 0x80, 0x80, 0xBC, 0xC2,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0xC2, 0xBC, 0x3E, 0x62, 0xC0, 0x80, 0x80,
+  0x80, 0xC0, 0x63, 0x3C, 0x01, 0x01, 0x01, 0x01, 0x3D, 0x43, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x43, 0x3D, 0x3C, 0x46, 0x83, 0x81, 0xFF, 0x80, 0x80,
+  0x43, 0x3E, 0x1C, 0x82, 0x08, 0xFC, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+  0x3D, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x01, 0x01, 0x42,
+  0x7C, 0x80, 0x80, 0x80, 0x80, 0xBC, 0xC2, 0xC1, 0x81, 0x81, 0x81, 0x81,
+  0x81, 0x81, 0xF0, 0x55, 0x55, 0x40, 0x33, 0x00, 0x11, 0x11, 0x11, 0x11,
+  0x11, 0x11, 0xE0, 0x81, 0x02, 0x04, 0x08, 0x51, 0xAC, 0x70, 0xA1, 0x22,
+  0x64, 0x68, 0x60, 0xFF, 0xF8, 0xBC, 0xF6, 0x38, 0xA0, 0x83, 0x04, 0x18,
+  0x20, 0xC1, 0x06, 0x08, 0x30, 0x41, 0x82, 0x08, 0xBC, 0xC2, 0x81, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x81, 0x3E, 0x31, 0xB0, 0x70, 0x18, 0x0C, 0x07,
+  0x06, 0xC6, 0x3E, 0x00, 0xBC, 0xC2, 0x81, 0x81, 0x81, 0x81, 0x81, 0xC2,
+  0xBC, 0x80, 0x80, 0x80, 0x80, 0x3D, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x43, 0x3D, 0x01, 0x01, 0x01, 0x01, 0xBE, 0x21, 0x08, 0x42, 0x10, 0x80,
+  0x7D, 0x8E, 0x07, 0x07, 0xC0, 0xC0, 0xE1, 0x7C, 0x20, 0x82, 0x3F, 0x20,
+  0x82, 0x08, 0x20, 0x82, 0x07, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x42, 0x3C, 0xC1, 0xA0, 0x98, 0x44, 0x62, 0x21, 0xB0, 0x50, 0x38, 0x08,
+  0x00, 0x84, 0x38, 0xE2, 0x8A, 0x2C, 0xA2, 0x4B, 0x65, 0x94, 0x51, 0x43,
+  0x1C, 0x31, 0x80, 0xC1, 0x63, 0x36, 0x1C, 0x1C, 0x34, 0x22, 0x43, 0xC1,
+  0xC0, 0xA0, 0xD8, 0x44, 0x62, 0x31, 0x90, 0x58, 0x38, 0x0C, 0x04, 0x02,
+  0x03, 0x01, 0x00, 0xFE, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFF,
+  0x39, 0x08, 0x42, 0x10, 0x84, 0xC1, 0x08, 0x42, 0x10, 0x84, 0x38, 0xFF,
+  0xFF, 0xE0, 0xE1, 0x08, 0x42, 0x10, 0x84, 0x19, 0x08, 0x42, 0x10, 0x84,
+  0xE0, 0xE1, 0x91, 0x8E, 0x18, 0x03, 0x00, 0x20, 0x00, 0x00, 0x03, 0x01,
+  0xC0, 0x58, 0x12, 0x0C, 0xC2, 0x11, 0x84, 0x7F, 0x90, 0x2C, 0x0E, 0x03,
+  0x80, 0x40, 0x0C, 0x07, 0x83, 0x30, 0x00, 0x00, 0x03, 0x01, 0xC0, 0x58,
+  0x12, 0x0C, 0xC2, 0x11, 0x84, 0x7F, 0x90, 0x2C, 0x0E, 0x03, 0x80, 0x40,
+  0x61, 0x98, 0x60, 0x00, 0x00, 0x0C, 0x07, 0x01, 0x60, 0x48, 0x33, 0x08,
+  0x46, 0x11, 0xFE, 0x40, 0xB0, 0x38, 0x0E, 0x01, 0x1F, 0x8C, 0x24, 0x03,
+  0x00, 0x80, 0x20, 0x08, 0x02, 0x00, 0x40, 0x10, 0x03, 0x0C, 0x7E, 0x0C,
+  0x03, 0x00, 0x80, 0x20, 0x60, 0x60, 0x20, 0x00, 0x1F, 0xA0, 0x40, 0x81,
+  0x03, 0xF4, 0x08, 0x10, 0x20, 0x40, 0xFE, 0x18, 0x61, 0x00, 0x00, 0x1F,
+  0xA0, 0x40, 0x81, 0x03, 0xF4, 0x08, 0x10, 0x20, 0x40, 0xFE, 0x18, 0x79,
+  0x98, 0x00, 0x1F, 0xA0, 0x40, 0x81, 0x03, 0xF4, 0x08, 0x10, 0x20, 0x40,
+  0xFE, 0x66, 0xCC, 0x00, 0x0F, 0xD0, 0x20, 0x40, 0x81, 0xFA, 0x04, 0x08,
+  0x10, 0x20, 0x7F, 0x31, 0xEC, 0xC0, 0x00, 0x82, 0x08, 0x20, 0x82, 0x08,
+  0x20, 0x82, 0x08, 0x20, 0xCF, 0x30, 0x00, 0x20, 0x82, 0x08, 0x20, 0x82,
+  0x08, 0x20, 0x82, 0x08, 0x06, 0x00, 0xF0, 0x19, 0x80, 0x00, 0x00, 0x01,
+  0xF8, 0x30, 0xC4, 0x02, 0xC0, 0x38, 0x01, 0x80, 0x18, 0x01, 0x80, 0x1C,
+  0x03, 0x40, 0x23, 0x0C, 0x1F, 0x80, 0x60, 0x66, 0x06, 0x00, 0x00, 0x00,
+  0x1F, 0x83, 0x0C, 0x40, 0x2C, 0x03, 0x80, 0x18, 0x01, 0x80, 0x18, 0x01,
+  0xC0, 0x34, 0x02, 0x30, 0xC1, 0xF8, 0x18, 0x06, 0x00, 0x80, 0x00, 0x04,
+  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x86,
+  0x3E, 0x00, 0x18, 0x1E, 0x19, 0x80, 0x00, 0x04, 0x06, 0x03, 0x01, 0x80,
+  0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x02, 0x86, 0x3E, 0x00, 0x63, 0x31,
+  0x80, 0x00, 0x08, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18,
+  0x0C, 0x05, 0x0C, 0x7C, 0x30, 0x18, 0x04, 0x00, 0x00, 0x3D, 0x43, 0x81,
+  0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x18, 0x3C, 0x66, 0x00, 0x00, 0x3D,
+  0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x66, 0x66, 0x00, 0x00,
+  0x3D, 0x43, 0x81, 0x81, 0x81, 0x81, 0x81, 0x43, 0x3D, 0x3E, 0x62, 0xC0,
+  0x80, 0x80, 0x80, 0xC0, 0x63, 0x3C, 0x18, 0x18, 0x10, 0x10, 0x30, 0x18,
+  0x04, 0x00, 0x00, 0x3C, 0x46, 0x83, 0x81, 0xFF, 0x80, 0x80, 0x43, 0x3E,
+  0x0C, 0x18, 0x20, 0x00, 0x00, 0x3C, 0x46, 0x83, 0x81, 0xFF, 0x80, 0x80,
+  0x43, 0x3E, 0x18, 0x3C, 0x66, 0x00, 0x00, 0x3C, 0x46, 0x83, 0x81, 0xFF,
+  0x80, 0x80, 0x43, 0x3E, 0x66, 0x66, 0x00, 0x00, 0x3C, 0x46, 0x83, 0x81,
+  0xFF, 0x80, 0x80, 0x43, 0x3E, 0x31, 0xEC, 0xC0, 0x00, 0x82, 0x08, 0x20,
+  0x82, 0x08, 0x20, 0x80, 0xCF, 0x30, 0x00, 0x20, 0x82, 0x08, 0x20, 0x82,
+  0x08, 0x20, 0x18, 0x1E, 0x19, 0x80, 0x00, 0x01, 0xF1, 0x8D, 0x83, 0x80,
+  0xC0, 0x60, 0x38, 0x36, 0x31, 0xF0, 0x63, 0x31, 0x80, 0x00, 0x03, 0xE3,
+  0x1B, 0x07, 0x01, 0x80, 0xC0, 0x70, 0x6C, 0x63, 0xE0, 0x30, 0x18, 0x04,
+  0x00, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42, 0x3C, 0x18,
+  0x3C, 0x66, 0x00, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x42,
+  0x3C, 0x66, 0x66, 0x00, 0x00, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
+  0x42, 0x3C, 0x63, 0x31, 0x80, 0x00, 0x0C, 0x0A, 0x0D, 0x84, 0x46, 0x23,
+  0x19, 0x05, 0x83, 0x80, 0xC0, 0x40, 0x20, 0x30, 0x10, 0x00 };
 
-const GFXglyph Dongle_Light15pt7bGlyphs[] PROGMEM = {
-  {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
-  {     1,   2,  12,   6,    2,  -11 },   // 0x21 '!'
-  {     4,   4,   4,   6,    1,  -12 },   // 0x22 '"'
-  {     6,  12,  12,  14,    1,  -11 },   // 0x23 '#'
-  {    24,   9,  17,  13,    2,  -13 },   // 0x24 '$'
-  {    44,  13,  12,  17,    2,  -11 },   // 0x25 '%'
-  {    64,  10,  12,  12,    1,  -11 },   // 0x26 '&'
-  {    79,   1,   4,   3,    1,  -12 },   // 0x27 '''
-  {    80,   4,  17,   9,    3,  -13 },   // 0x28 '('
-  {    89,   4,  17,   9,    2,  -13 },   // 0x29 ')'
-  {    98,   6,   7,   9,    1,  -12 },   // 0x2A '*'
-  {   104,   8,   8,  12,    2,   -9 },   // 0x2B '+'
-  {   112,   2,   5,   5,    2,   -1 },   // 0x2C ','
-  {   114,   6,   1,   9,    1,   -5 },   // 0x2D '-'
-  {   115,   2,   2,   6,    2,   -1 },   // 0x2E '.'
-  {   116,   6,  17,   8,    1,  -12 },   // 0x2F '/'
-  {   129,   8,  12,  10,    1,  -11 },   // 0x30 '0'
-  {   141,   4,  12,   8,    1,  -11 },   // 0x31 '1'
-  {   147,   8,  12,  10,    1,  -11 },   // 0x32 '2'
-  {   159,   8,  12,  10,    1,  -11 },   // 0x33 '3'
-  {   171,   9,  12,   9,    0,  -11 },   // 0x34 '4'
-  {   185,   7,  12,   9,    1,  -11 },   // 0x35 '5'
-  {   196,   8,  12,  10,    1,  -11 },   // 0x36 '6'
-  {   208,   8,  12,   9,    0,  -11 },   // 0x37 '7'
-  {   220,   8,  12,  10,    1,  -11 },   // 0x38 '8'
-  {   232,   8,  12,  10,    1,  -11 },   // 0x39 '9'
-  {   244,   2,   9,   6,    2,   -8 },   // 0x3A ':'
-  {   247,   2,  12,   6,    2,   -8 },   // 0x3B ';'
-  {   250,   7,  10,  12,    2,  -10 },   // 0x3C '<'
-  {   259,   8,   5,  12,    2,   -8 },   // 0x3D '='
-  {   264,   7,  10,  12,    2,  -10 },   // 0x3E '>'
-  {   273,   6,  12,   8,    1,  -11 },   // 0x3F '?'
-  {   282,  13,  13,  15,    1,  -12 },   // 0x40 '@'
-  {   304,  10,  12,  12,    1,  -11 },   // 0x41 'A'
-  {   319,   8,  12,  10,    1,  -11 },   // 0x42 'B'
-  {   331,  10,  12,  12,    1,  -11 },   // 0x43 'C'
-  {   346,  10,  12,  12,    1,  -11 },   // 0x44 'D'
-  {   361,   7,  12,   8,    1,  -11 },   // 0x45 'E'
-  {   372,   6,  12,   8,    1,  -11 },   // 0x46 'F'
-  {   381,  12,  12,  13,    1,  -11 },   // 0x47 'G'
-  {   399,   9,  12,  11,    1,  -11 },   // 0x48 'H'
-  {   413,   1,  12,   5,    2,  -11 },   // 0x49 'I'
-  {   415,   5,  12,   6,    0,  -11 },   // 0x4A 'J'
-  {   423,   8,  12,   9,    1,  -11 },   // 0x4B 'K'
-  {   435,   6,  12,   8,    1,  -11 },   // 0x4C 'L'
-  {   444,  13,  12,  15,    1,  -11 },   // 0x4D 'M'
-  {   464,   9,  12,  11,    1,  -11 },   // 0x4E 'N'
-  {   478,  12,  12,  14,    1,  -11 },   // 0x4F 'O'
-  {   496,   8,  12,  10,    1,  -11 },   // 0x50 'P'
-  {   508,  12,  12,  14,    1,  -11 },   // 0x51 'Q'
-  {   526,   8,  12,  10,    1,  -11 },   // 0x52 'R'
-  {   538,   8,  12,  10,    1,  -11 },   // 0x53 'S'
-  {   550,   9,  12,   9,    0,  -11 },   // 0x54 'T'
-  {   564,   9,  12,  11,    1,  -11 },   // 0x55 'U'
-  {   578,  10,  12,  12,    1,  -11 },   // 0x56 'V'
-  {   593,  13,  12,  15,    1,  -11 },   // 0x57 'W'
-  {   613,  10,  12,  10,    0,  -11 },   // 0x58 'X'
-  {   628,   9,  12,  11,    1,  -11 },   // 0x59 'Y'
-  {   642,   9,  12,  11,    1,  -11 },   // 0x5A 'Z'
-  {   656,   4,  17,   8,    3,  -13 },   // 0x5B '['
-  {   665,   6,  17,   8,    1,  -12 },   // 0x5C '\'
-  {   678,   4,  17,   8,    1,  -13 },   // 0x5D ']'
-  {   687,   8,   8,  12,    2,  -14 },   // 0x5E '^'
-  {   695,  10,   1,  12,    1,    2 },   // 0x5F '_'
-  {   697,   4,   4,   6,    1,  -13 },   // 0x60 '`'
-  {   699,   8,   9,  10,    1,   -8 },   // 0x61 'a'
-  {   708,   8,  13,  10,    1,  -12 },   // 0x62 'b'
-  {   721,   8,   9,  10,    1,   -8 },   // 0x63 'c'
-  {   730,   8,  13,  10,    1,  -12 },   // 0x64 'd'
-  {   743,   8,   9,  10,    1,   -8 },   // 0x65 'e'
-  {   752,   7,  13,   7,    0,  -12 },   // 0x66 'f'
-  {   764,   8,  13,  10,    1,   -8 },   // 0x67 'g'
-  {   777,   8,  13,  10,    1,  -12 },   // 0x68 'h'
-  {   790,   2,  13,   4,    1,  -12 },   // 0x69 'i'
-  {   794,   4,  17,   4,   -1,  -12 },   // 0x6A 'j'
-  {   803,   7,  13,   8,    1,  -12 },   // 0x6B 'k'
-  {   815,   1,  13,   3,    1,  -12 },   // 0x6C 'l'
-  {   817,  13,   9,  15,    1,   -8 },   // 0x6D 'm'
-  {   832,   8,   9,  10,    1,   -8 },   // 0x6E 'n'
-  {   841,   9,   9,  11,    1,   -8 },   // 0x6F 'o'
-  {   852,   8,  13,  10,    1,   -8 },   // 0x70 'p'
-  {   865,   8,  13,  10,    1,   -8 },   // 0x71 'q'
-  {   878,   5,   9,   6,    1,   -8 },   // 0x72 'r'
-  {   884,   7,   9,   9,    1,   -8 },   // 0x73 's'
-  {   892,   7,  12,   7,    0,  -11 },   // 0x74 't'
-  {   903,   8,   9,  10,    1,   -8 },   // 0x75 'u'
-  {   912,   9,   9,   9,    0,   -8 },   // 0x76 'v'
-  {   923,  13,   9,  13,    0,   -8 },   // 0x77 'w'
-  {   938,   9,   9,   9,    0,   -8 },   // 0x78 'x'
-  {   949,   9,  13,   9,    0,   -8 },   // 0x79 'y'
-  {   964,   8,   9,   9,    1,   -8 },   // 0x7A 'z'
-  {   973,   5,  17,   9,    2,  -12 },   // 0x7B '{'
-  {   984,   1,  19,   7,    3,  -14 },   // 0x7C '|'
-  {   987,   5,  17,   9,    2,  -12 },   // 0x7D '}'
-  {   998,   9,   3,  12,    1,   -7 } }; // 0x7E '~'
+constexpr GFXglyph Dongle_Light15ptGlyphs[] PROGMEM = {
+  {     0,   0,   0,   6,    0,    0 },   // 0x20 ' '
+  {     0,   2,  12,   6,    2,  -11 },   // 0x21 '!'
+  {     3,   4,   4,   6,    1,  -12 },   // 0x22 '"'
+  {     5,  12,  11,  14,    1,  -10 },   // 0x23 '#'
+  {    22,   9,  17,  13,    2,  -13 },   // 0x24 '$'
+  {    42,  13,  12,  17,    2,  -11 },   // 0x25 '%'
+  {    62,  10,  12,  12,    1,  -11 },   // 0x26 '&'
+  {    77,   1,   4,   3,    1,  -12 },   // 0x27 '''
+  {    78,   4,  17,   9,    3,  -13 },   // 0x28 '('
+  {    87,   4,  17,   9,    2,  -13 },   // 0x29 ')'
+  {    96,   5,   7,   9,    2,  -12 },   // 0x2A '*'
+  {   101,   8,   8,  12,    2,   -9 },   // 0x2B '+'
+  {   109,   2,   4,   5,    2,    0 },   // 0x2C ','
+  {   110,   6,   1,   9,    1,   -5 },   // 0x2D '-'
+  {   111,   2,   2,   6,    2,   -1 },   // 0x2E '.'
+  {   112,   6,  17,   8,    1,  -12 },   // 0x2F '/'
+  {   125,   8,  12,  10,    1,  -11 },   // 0x30 '0'
+  {   137,   4,  12,   8,    1,  -11 },   // 0x31 '1'
+  {   143,   7,  12,  10,    2,  -11 },   // 0x32 '2'
+  {   154,   8,  12,  10,    1,  -11 },   // 0x33 '3'
+  {   166,   9,  12,   9,    0,  -11 },   // 0x34 '4'
+  {   180,   7,  12,   9,    1,  -11 },   // 0x35 '5'
+  {   191,   8,  12,  10,    1,  -11 },   // 0x36 '6'
+  {   203,   8,  12,   9,    0,  -11 },   // 0x37 '7'
+  {   215,   8,  12,  10,    1,  -11 },   // 0x38 '8'
+  {   227,   8,  12,  10,    1,  -11 },   // 0x39 '9'
+  {   239,   2,   9,   6,    2,   -8 },   // 0x3A ':'
+  {   242,   2,  11,   6,    2,   -8 },   // 0x3B ';'
+  {   245,   7,  10,  12,    2,  -10 },   // 0x3C '<'
+  {   254,   8,   5,  12,    2,   -8 },   // 0x3D '='
+  {   259,   7,  10,  12,    2,  -10 },   // 0x3E '>'
+  {   268,   6,  12,   8,    1,  -11 },   // 0x3F '?'
+  {   277,  13,  13,  15,    1,  -12 },   // 0x40 '@'
+  {   299,  10,  12,  12,    1,  -11 },   // 0x41 'A'
+  {   314,   8,  12,  10,    1,  -11 },   // 0x42 'B'
+  {   326,  10,  12,  12,    1,  -11 },   // 0x43 'C'
+  {   341,  10,  12,  12,    1,  -11 },   // 0x44 'D'
+  {   356,   7,  12,   8,    1,  -11 },   // 0x45 'E'
+  {   367,   6,  12,   8,    1,  -11 },   // 0x46 'F'
+  {   376,  12,  12,  13,    1,  -11 },   // 0x47 'G'
+  {   394,   9,  12,  11,    1,  -11 },   // 0x48 'H'
+  {   408,   1,  12,   5,    2,  -11 },   // 0x49 'I'
+  {   410,   5,  12,   6,    0,  -11 },   // 0x4A 'J'
+  {   418,   8,  12,   9,    1,  -11 },   // 0x4B 'K'
+  {   430,   6,  12,   8,    1,  -11 },   // 0x4C 'L'
+  {   439,  13,  12,  15,    1,  -11 },   // 0x4D 'M'
+  {   459,   9,  12,  11,    1,  -11 },   // 0x4E 'N'
+  {   473,  12,  12,  14,    1,  -11 },   // 0x4F 'O'
+  {   491,   8,  12,  10,    1,  -11 },   // 0x50 'P'
+  {   503,  12,  12,  14,    1,  -11 },   // 0x51 'Q'
+  {   521,   8,  12,  10,    1,  -11 },   // 0x52 'R'
+  {   533,   8,  12,  10,    1,  -11 },   // 0x53 'S'
+  {   545,   9,  12,   9,    0,  -11 },   // 0x54 'T'
+  {   559,   9,  12,  11,    1,  -11 },   // 0x55 'U'
+  {   573,  10,  12,  12,    1,  -11 },   // 0x56 'V'
+  {   588,  13,  12,  15,    1,  -11 },   // 0x57 'W'
+  {   608,  10,  12,  10,    0,  -11 },   // 0x58 'X'
+  {   623,   9,  12,  11,    1,  -11 },   // 0x59 'Y'
+  {   637,   9,  12,  11,    1,  -11 },   // 0x5A 'Z'
+  {   651,   4,  17,   8,    3,  -13 },   // 0x5B '['
+  {   660,   6,  17,   8,    1,  -12 },   // 0x5C '\'
+  {   673,   4,  17,   8,    1,  -13 },   // 0x5D ']'
+  {   682,   8,   7,  12,    2,  -14 },   // 0x5E '^'
+  {   689,  10,   1,  12,    1,    2 },   // 0x5F '_'
+  {   691,   4,   3,   6,    1,  -12 },   // 0x60 '`'
+  {   693,   8,   9,  10,    1,   -8 },   // 0x61 'a'
+  {   702,   8,  13,  10,    1,  -12 },   // 0x62 'b'
+  {   715,   8,   9,  10,    1,   -8 },   // 0x63 'c'
+  {   724,   8,  13,  10,    1,  -12 },   // 0x64 'd'
+  {   737,   8,   9,  10,    1,   -8 },   // 0x65 'e'
+  {   746,   6,  13,   7,    0,  -12 },   // 0x66 'f'
+  {   756,   8,  13,  10,    1,   -8 },   // 0x67 'g'
+  {   769,   8,  13,  10,    1,  -12 },   // 0x68 'h'
+  {   782,   2,  13,   4,    1,  -12 },   // 0x69 'i'
+  {   786,   4,  17,   4,   -1,  -12 },   // 0x6A 'j'
+  {   795,   7,  13,   8,    1,  -12 },   // 0x6B 'k'
+  {   807,   1,  13,   3,    1,  -12 },   // 0x6C 'l'
+  {   809,  13,   9,  15,    1,   -8 },   // 0x6D 'm'
+  {   824,   8,   9,  10,    1,   -8 },   // 0x6E 'n'
+  {   833,   9,   9,  11,    1,   -8 },   // 0x6F 'o'
+  {   844,   8,  13,  10,    1,   -8 },   // 0x70 'p'
+  {   857,   8,  13,  10,    1,   -8 },   // 0x71 'q'
+  {   870,   5,   9,   6,    1,   -8 },   // 0x72 'r'
+  {   876,   7,   9,   9,    1,   -8 },   // 0x73 's'
+  {   884,   6,  12,   7,    0,  -11 },   // 0x74 't'
+  {   893,   8,   9,  10,    1,   -8 },   // 0x75 'u'
+  {   902,   9,   9,   9,    0,   -8 },   // 0x76 'v'
+  {   913,  12,   9,  13,    1,   -8 },   // 0x77 'w'
+  {   927,   8,   9,   9,    0,   -8 },   // 0x78 'x'
+  {   936,   9,  13,   9,    0,   -8 },   // 0x79 'y'
+  {   951,   8,   9,   9,    1,   -8 },   // 0x7A 'z'
+  {   960,   5,  17,   9,    2,  -12 },   // 0x7B '{'
+  {   971,   1,  19,   7,    3,  -14 },   // 0x7C '|'
+  {   974,   5,  17,   9,    2,  -12 },   // 0x7D '}'
+  {   985,   8,   3,  12,    2,   -7 },   // 0x7E '~'
+  {   988,  10,  17,  12,    1,  -16 },   // 0x00C0 'À'
+  {  1010,  10,  17,  12,    1,  -16 },   // 0x00C2 'Â'
+  {  1032,  10,  16,  12,    1,  -15 },   // 0x00C4 'Ä'
+  {  1052,  10,  16,  12,    1,  -11 },   // 0x00C7 'Ç'
+  {  1072,   7,  17,   8,    1,  -16 },   // 0x00C8 'È'
+  {  1087,   7,  17,   8,    1,  -16 },   // 0x00C9 'É'
+  {  1102,   7,  17,   8,    1,  -16 },   // 0x00CA 'Ê'
+  {  1117,   7,  16,   8,    1,  -15 },   // 0x00CB 'Ë'
+  {  1131,   6,  17,   5,    0,  -16 },   // 0x00CE 'Î'
+  {  1144,   6,  16,   5,    0,  -15 },   // 0x00CF 'Ï'
+  {  1156,  12,  17,  14,    1,  -16 },   // 0x00D4 'Ô'
+  {  1182,  12,  16,  14,    1,  -15 },   // 0x00D6 'Ö'
+  {  1206,   9,  17,  11,    1,  -16 },   // 0x00D9 'Ù'
+  {  1226,   9,  17,  11,    1,  -16 },   // 0x00DB 'Û'
+  {  1246,   9,  16,  11,    1,  -15 },   // 0x00DC 'Ü'
+  {  1264,   8,  14,  10,    1,  -13 },   // 0x00E0 'à'
+  {  1278,   8,  14,  10,    1,  -13 },   // 0x00E2 'â'
+  {  1292,   8,  13,  10,    1,  -12 },   // 0x00E4 'ä'
+  {  1305,   8,  13,  10,    1,   -8 },   // 0x00E7 'ç'
+  {  1318,   8,  14,  10,    1,  -13 },   // 0x00E8 'è'
+  {  1332,   8,  14,  10,    1,  -13 },   // 0x00E9 'é'
+  {  1346,   8,  14,  10,    1,  -13 },   // 0x00EA 'ê'
+  {  1360,   8,  13,  10,    1,  -12 },   // 0x00EB 'ë'
+  {  1373,   6,  14,   4,    0,  -13 },   // 0x00EE 'î'
+  {  1384,   6,  13,   4,    0,  -12 },   // 0x00EF 'ï'
+  {  1394,   9,  14,  11,    1,  -13 },   // 0x00F4 'ô'
+  {  1410,   9,  13,  11,    1,  -12 },   // 0x00F6 'ö'
+  {  1425,   8,  14,  10,    1,  -13 },   // 0x00F9 'ù'
+  {  1439,   8,  14,  10,    1,  -13 },   // 0x00FB 'û'
+  {  1453,   8,  13,  10,    1,  -12 },   // 0x00FC 'ü'
+  {  1466,   9,  17,   9,    0,  -12 } }; // 0x00FF 'ÿ'
 
-const GFXfont Dongle_Light15pt7b PROGMEM = {
-  (uint8_t  *)Dongle_Light15pt7bBitmaps,
-  (GFXglyph *)Dongle_Light15pt7bGlyphs,
-  0x20, 0x7E, 43 };
+constexpr GlyphRange Dongle_Light15ptRanges[] PROGMEM = {
+  { 0x0020, 0x007E,    0 },
+  { 0x00C0, 0x00C0,   95 },
+  { 0x00C2, 0x00C2,   96 },
+  { 0x00C4, 0x00C4,   97 },
+  { 0x00C7, 0x00CB,   98 },
+  { 0x00CE, 0x00CF,  103 },
+  { 0x00D4, 0x00D4,  105 },
+  { 0x00D6, 0x00D6,  106 },
+  { 0x00D9, 0x00D9,  107 },
+  { 0x00DB, 0x00DC,  108 },
+  { 0x00E0, 0x00E0,  110 },
+  { 0x00E2, 0x00E2,  111 },
+  { 0x00E4, 0x00E4,  112 },
+  { 0x00E7, 0x00EB,  113 },
+  { 0x00EE, 0x00EF,  118 },
+  { 0x00F4, 0x00F4,  120 },
+  { 0x00F6, 0x00F6,  121 },
+  { 0x00F9, 0x00F9,  122 },
+  { 0x00FB, 0x00FC,  123 },
+  { 0x00FF, 0x00FF,  125 } };
 
-// Create alias for easier access
-#define DongleLight15pt7b Dongle_Light15pt7b
+constexpr SparseFont Dongle_Light15pt PROGMEM = {
+  Dongle_Light15ptBitmaps, Dongle_Light15ptGlyphs, Dongle_Light15ptRanges, 20, 43 };
 
-// Approx. 1674 bytes
+// Approx. 2502 bytes
@@ -1,151 +1,220 @@
-const uint8_t Dongle_Light11pt7bBitmaps[] PROGMEM = {
-  0x00, 0xFD, 0xB6, 0x80, 0x00, 0x12, 0x7F, 0x24, 0x24, 0xFF, 0x48, 0x48,
-  0x10, 0xE5, 0x14, 0x70, 0x61, 0x45, 0x7C, 0x41, 0x00, 0x71, 0x24, 0x8F,
-  0x40, 0x10, 0x0B, 0x85, 0x12, 0x45, 0x0E, 0x30, 0x91, 0x21, 0x85, 0x31,
-  0xE3, 0x3D, 0xE0, 0x29, 0x49, 0x24, 0x89, 0x00, 0x89, 0x12, 0x49, 0x29,
-  0x00, 0x2D, 0xF2, 0x10, 0x20, 0x47, 0xF1, 0x02, 0x00, 0xE0, 0xF0, 0x80,
-  0x11, 0x12, 0x24, 0x44, 0x88, 0x80, 0x7B, 0x38, 0x61, 0x86, 0x1C, 0xDE,
-  0x64, 0x92, 0x49, 0x74, 0x42, 0x11, 0x11, 0x1F, 0x74, 0x42, 0x60, 0x86,
-  0x2E, 0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x82, 0x7D, 0x07, 0x83, 0x04, 0x18,
-  0xDE, 0x10, 0x84, 0x3E, 0x8E, 0x1C, 0x5E, 0xFC, 0x10, 0x82, 0x10, 0x42,
-  0x08, 0x7A, 0x18, 0x5E, 0x86, 0x18, 0x5E, 0x7B, 0x38, 0x71, 0x7C, 0x21,
-  0x08, 0x84, 0x8E, 0x19, 0x31, 0x82, 0x0C, 0xFC, 0x00, 0x3F, 0x83, 0x06,
-  0x36, 0x40, 0x72, 0x42, 0x22, 0x10, 0x04, 0x1F, 0x1F, 0x6F, 0x2E, 0x89,
-  0xA2, 0x68, 0xBD, 0xF9, 0x80, 0x1F, 0x00, 0x18, 0x14, 0x14, 0x24, 0x22,
-  0x7E, 0x41, 0xC1, 0xF2, 0x28, 0xBE, 0x86, 0x18, 0x7E, 0x3C, 0x82, 0x04,
-  0x08, 0x10, 0x10, 0x9F, 0xF9, 0x0A, 0x0C, 0x18, 0x30, 0x61, 0x7C, 0xFC,
-  0x21, 0xF8, 0x42, 0x1F, 0xFC, 0x21, 0xF8, 0x42, 0x10, 0x3E, 0x20, 0x20,
-  0x10, 0xE8, 0x14, 0x09, 0x0C, 0x78, 0x83, 0x06, 0x0F, 0xF8, 0x30, 0x60,
-  0xC1, 0xFF, 0x11, 0x11, 0x11, 0x1E, 0x86, 0x29, 0x28, 0xE2, 0x48, 0xA1,
-  0x84, 0x21, 0x08, 0x42, 0x1F, 0x41, 0x51, 0xA9, 0x32, 0x99, 0x4C, 0x46,
-  0x03, 0x01, 0xC3, 0x86, 0x8C, 0x99, 0x31, 0x61, 0xC3, 0x3E, 0x21, 0xA0,
-  0x30, 0x18, 0x0C, 0x05, 0x8C, 0x7C, 0xFA, 0x18, 0x61, 0xFA, 0x08, 0x20,
-  0x3E, 0x21, 0xA0, 0x30, 0x18, 0x0C, 0x25, 0x8C, 0x7F, 0xFA, 0x18, 0x61,
-  0xFA, 0x28, 0x61, 0x7A, 0x08, 0x18, 0x18, 0x18, 0x5E, 0xFE, 0x20, 0x40,
-  0x81, 0x02, 0x04, 0x08, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x71, 0xBC, 0x83,
-  0x06, 0x12, 0x24, 0x45, 0x0A, 0x08, 0x80, 0xC4, 0x65, 0x32, 0x9D, 0x4B,
-  0x19, 0x8C, 0xC6, 0xC2, 0x88, 0xB0, 0xC1, 0x85, 0x91, 0xC1, 0x82, 0x89,
-  0x11, 0x41, 0x02, 0x04, 0x08, 0x7E, 0x08, 0x20, 0x83, 0x04, 0x10, 0x7F,
-  0xF2, 0x49, 0x24, 0x92, 0x70, 0x88, 0x84, 0x44, 0x22, 0x21, 0x10, 0xE4,
-  0x92, 0x49, 0x24, 0xF0, 0x22, 0xA5, 0x10, 0x00, 0xFE, 0x19, 0x80, 0x77,
-  0x38, 0x61, 0xCD, 0xD0, 0x82, 0x08, 0x2E, 0xCE, 0x18, 0x73, 0xB8, 0x7B,
-  0x08, 0x20, 0xC5, 0xE0, 0x04, 0x10, 0x5D, 0xCE, 0x18, 0x73, 0x74, 0x7A,
-  0x1F, 0xE0, 0xC5, 0xE0, 0x34, 0x4F, 0x44, 0x44, 0x40, 0x77, 0x38, 0x61,
-  0xCD, 0xD0, 0x43, 0x78, 0x82, 0x08, 0x2E, 0xC6, 0x18, 0x61, 0x84, 0x9F,
-  0x80, 0x20, 0x12, 0x49, 0x24, 0xE0, 0x84, 0x21, 0x1B, 0x62, 0x92, 0x88,
-  0xFF, 0x80, 0xB9, 0xD8, 0xC6, 0x10, 0xC2, 0x18, 0x43, 0x08, 0x40, 0xBB,
-  0x18, 0x61, 0x86, 0x10, 0x7B, 0x38, 0x61, 0xCD, 0xE0, 0xBB, 0x38, 0x61,
-  0xCE, 0xE8, 0x20, 0x80, 0x77, 0x38, 0x61, 0xCD, 0xD0, 0x41, 0x04, 0xBC,
-  0x88, 0x88, 0x74, 0x30, 0x78, 0xF8, 0x44, 0xF4, 0x44, 0x47, 0x86, 0x18,
-  0x61, 0x8D, 0xE0, 0x85, 0x14, 0x8A, 0x28, 0x40, 0x8C, 0xA6, 0x55, 0x2A,
-  0xA5, 0x31, 0x98, 0xC5, 0xA1, 0x0A, 0x4E, 0x10, 0x82, 0x89, 0x11, 0x42,
-  0x82, 0x04, 0x08, 0x20, 0x7C, 0x21, 0x08, 0x43, 0xF0, 0x74, 0x44, 0x48,
-  0x44, 0x44, 0x47, 0x7F, 0xF8, 0xE2, 0x22, 0x21, 0x22, 0x22, 0x2E, 0x67,
-  0x38 };
+// Generated by tools/fontsubset.py
+constexpr uint8_t Dongle_Light11ptBitmaps[] PROGMEM = {
+  0xFD, 0xB6, 0x80, 0x12, 0x7F, 0x24, 0x24, 0xFF, 0x48, 0x48, 0x23, 0xA9,
+  0x4E, 0x18, 0xA5, 0xF9, 0x08, 0x71, 0x24, 0x8F, 0x40, 0x10, 0x0B, 0x85,
+  0x12, 0x45, 0x0E, 0x30, 0x91, 0x21, 0x85, 0x31, 0xE3, 0x3D, 0xE0, 0x29,
+  0x49, 0x24, 0x89, 0x00, 0x89, 0x12, 0x49, 0x29, 0x00, 0x2D, 0xF2, 0x10,
+  0x20, 0x47, 0xF1, 0x02, 0x00, 0xE0, 0xF0, 0x80, 0x11, 0x12, 0x24, 0x44,
+  0x88, 0x80, 0x7B, 0x38, 0x61, 0x86, 0x1C, 0xDE, 0xD5, 0x55, 0x74, 0x42,
+  0x11, 0x11, 0x1F, 0x74, 0x42, 0x60, 0x86, 0x2E, 0x18, 0xA2, 0x92, 0x8B,
+  0xF0, 0x82, 0x7D, 0x07, 0x83, 0x04, 0x18, 0xDE, 0x10, 0x84, 0x3E, 0x8E,
+  0x1C, 0x5E, 0xFC, 0x10, 0x82, 0x10, 0x42, 0x08, 0x7A, 0x18, 0x5E, 0x86,
+  0x18, 0x5E, 0x7B, 0x38, 0x71, 0x7C, 0x21, 0x08, 0x84, 0x8E, 0x19, 0x31,
+  0x82, 0x0C, 0xFC, 0x00, 0x3F, 0x83, 0x06, 0x36, 0x40, 0xE9, 0x12, 0x44,
+  0x04, 0x1F, 0x1F, 0x6F, 0x2E, 0x89, 0xA2, 0x68, 0xBD, 0xF9, 0x80, 0x1F,
+  0x00, 0x18, 0x14, 0x14, 0x24, 0x22, 0x7E, 0x41, 0xC1, 0xF2, 0x28, 0xBE,
+  0x86, 0x18, 0x7E, 0x3C, 0x82, 0x04, 0x08, 0x10, 0x10, 0x9F, 0xF9, 0x0A,
+  0x0C, 0x18, 0x30, 0x61, 0x7C, 0xFC, 0x21, 0xF8, 0x42, 0x1F, 0xFC, 0x21,
+  0xF8, 0x42, 0x10, 0x3E, 0x40, 0x80, 0x87, 0x81, 0x81, 0x43, 0x3C, 0x83,
+  0x06, 0x0F, 0xF8, 0x30, 0x60, 0xC1, 0xFF, 0x11, 0x11, 0x11, 0x1E, 0x86,
+  0x29, 0x28, 0xE2, 0x48, 0xA1, 0x84, 0x21, 0x08, 0x42, 0x1F, 0x41, 0x51,
+  0xA9, 0x32, 0x99, 0x4C, 0x46, 0x03, 0x01, 0xC3, 0x86, 0x8C, 0x99, 0x31,
+  0x61, 0xC3, 0x3E, 0x21, 0xA0, 0x30, 0x18, 0x0C, 0x05, 0x8C, 0x7C, 0xFA,
+  0x18, 0x61, 0xFA, 0x08, 0x20, 0x3E, 0x21, 0xA0, 0x30, 0x18, 0x0C, 0x25,
+  0x8C, 0x7F, 0xFA, 0x18, 0x61, 0xFA, 0x28, 0x61, 0x7A, 0x08, 0x18, 0x18,
+  0x18, 0x5E, 0xFE, 0x20, 0x40, 0x81, 0x02, 0x04, 0x08, 0x83, 0x06, 0x0C,
+  0x18, 0x30, 0x71, 0xBC, 0x83, 0x06, 0x12, 0x24, 0x45, 0x0A, 0x08, 0x80,
+  0xC4, 0x65, 0x32, 0x9D, 0x4B, 0x19, 0x8C, 0xC6, 0xC2, 0x88, 0xB0, 0xC1,
+  0x85, 0x91, 0xC1, 0x82, 0x89, 0x11, 0x41, 0x02, 0x04, 0x08, 0x7E, 0x08,
+  0x20, 0x83, 0x04, 0x10, 0x7F, 0xF2, 0x49, 0x24, 0x92, 0x70, 0x88, 0x84,
+  0x44, 0x22, 0x21, 0x10, 0xE4, 0x92, 0x49, 0x24, 0xF0, 0x22, 0xA5, 0x10,
+  0xFE, 0xCC, 0x77, 0x38, 0x61, 0xCD, 0xD0, 0x82, 0x08, 0x2E, 0xCE, 0x18,
+  0x73, 0xB8, 0x7B, 0x08, 0x20, 0xC5, 0xE0, 0x04, 0x10, 0x5D, 0xCE, 0x18,
+  0x73, 0x74, 0x7A, 0x1F, 0xE0, 0xC5, 0xE0, 0x34, 0x4F, 0x44, 0x44, 0x40,
+  0x77, 0x38, 0x61, 0xCD, 0xD0, 0x43, 0x78, 0x82, 0x08, 0x2E, 0xC6, 0x18,
+  0x61, 0x84, 0x9F, 0x80, 0x20, 0x12, 0x49, 0x24, 0xE0, 0x84, 0x21, 0x1B,
+  0x62, 0x92, 0x88, 0xFF, 0x80, 0xB9, 0xD8, 0xC6, 0x10, 0xC2, 0x18, 0x43,
+  0x08, 0x40, 0xBB, 0x18, 0x61, 0x86, 0x10, 0x7B, 0x38, 0x61, 0xCD, 0xE0,
+  0xBB, 0x38, 0x61, 0xCE, 0xE8, 0x20, 0x80, 0x77, 0x38, 0x61, 0xCD, 0xD0,
+  0x41, 0x04, 0xBC, 0x88, 0x88, 0x74, 0x30, 0x78, 0xF8, 0x44, 0xF4, 0x44,
+  0x47, 0x86, 0x18, 0x61, 0x8D, 0xE0, 0x85, 0x14, 0x8A, 0x28, 0x40, 0x8C,
+  0xA6, 0x55, 0x2A, 0xA5, 0x31, 0x98, 0xC5, 0xA1, 0x0A, 0x4E, 0x10, 0x82,
+  0x89, 0x11, 0x42, 0x82, 0x04, 0x08, 0x20, 0x7C, 0x21, 0x08, 0x43, 0xF0,
+  0x74, 0x44, 0x48, 0x44, 0x44, 0x47, 0xFF, 0xF0, 0xE2, 0x22, 0x21, 0x22,
+  0x22, 0x2E, 0x67, 0x38, 0x30, 0x18, 0x00, 0x18, 0x14, 0x14, 0x24, 0x22,
+  0x7E, 0x41, 0xC1, 0x08, 0x14, 0x22, 0x00, 0x18, 0x14, 0x14, 0x24, 0x22,
+  0x7E, 0x41, 0xC1, 0x42, 0x00, 0x18, 0x14, 0x14, 0x24, 0x22, 0x7E, 0x41,
+  0xC1, 0x3C, 0x82, 0x04, 0x08, 0x10, 0x10, 0x9F, 0x10, 0x20, 0x40, 0x61,
+  0x81, 0xF8, 0x43, 0xF0, 0x84, 0x3E, 0x33, 0x01, 0xF8, 0x43, 0xF0, 0x84,
+  0x3E, 0x22, 0xA2, 0x0F, 0xC2, 0x1F, 0x84, 0x21, 0xF0, 0x50, 0x3F, 0x08,
+  0x7E, 0x10, 0x87, 0xC0, 0x22, 0xA2, 0x02, 0x10, 0x84, 0x21, 0x08, 0x40,
+  0xA1, 0x24, 0x92, 0x48, 0x08, 0x0A, 0x08, 0x80, 0x03, 0xE2, 0x1A, 0x03,
+  0x01, 0x80, 0xC0, 0x58, 0xC7, 0xC0, 0x41, 0x00, 0x0F, 0x88, 0x68, 0x0C,
+  0x06, 0x03, 0x01, 0x63, 0x1F, 0x00, 0x30, 0x30, 0x04, 0x18, 0x30, 0x60,
+  0xC1, 0x83, 0x8D, 0xE0, 0x10, 0x51, 0x10, 0x08, 0x30, 0x60, 0xC1, 0x83,
+  0x07, 0x1B, 0xC0, 0x44, 0x02, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0xC6, 0xF0,
+  0x60, 0xC0, 0x1D, 0xCE, 0x18, 0x73, 0x74, 0x10, 0xA4, 0x40, 0x77, 0x38,
+  0x61, 0xCD, 0xD0, 0x48, 0x07, 0x73, 0x86, 0x1C, 0xDD, 0x7B, 0x08, 0x20,
+  0xC5, 0xE1, 0x04, 0x10, 0x60, 0xC0, 0x1E, 0x87, 0xF8, 0x31, 0x78, 0x31,
+  0x80, 0x1E, 0x87, 0xF8, 0x31, 0x78, 0x10, 0xA4, 0x40, 0x7A, 0x1F, 0xE0,
+  0xC5, 0xE0, 0x48, 0x07, 0xA1, 0xFE, 0x0C, 0x5E, 0x22, 0xA2, 0x02, 0x10,
+  0x84, 0x21, 0x00, 0xA1, 0x24, 0x92, 0x10, 0xA4, 0x40, 0x7B, 0x38, 0x61,
+  0xCD, 0xE0, 0x48, 0x07, 0xB3, 0x86, 0x1C, 0xDE, 0x60, 0xC0, 0x21, 0x86,
+  0x18, 0x63, 0x78, 0x10, 0xA4, 0x40, 0x86, 0x18, 0x61, 0x8D, 0xE0, 0x48,
+  0x08, 0x61, 0x86, 0x18, 0xDE, 0x44, 0x02, 0x0A, 0x24, 0x45, 0x0A, 0x08,
+  0x10, 0x20, 0x80 };
 
-const GFXglyph Dongle_Light11pt7bGlyphs[] PROGMEM = {
-  {     0,   1,   1,   4,    0,    0 },   // 0x20 ' '
-  {     1,   1,   8,   3,    1,   -7 },   // 0x21 '!'
-  {     2,   3,   3,   5,    1,   -8 },   // 0x22 '"'
-  {     4,   8,   8,  10,    1,   -7 },   // 0x23 '#'
-  {    12,   6,  11,   7,    0,   -8 },   // 0x24 '$'
-  {    21,  10,   8,  12,    1,   -7 },   // 0x25 '%'
-  {    31,   7,   8,   9,    1,   -7 },   // 0x26 '&'
-  {    38,   1,   3,   3,    1,   -8 },   // 0x27 '''
-  {    39,   3,  12,   7,    2,   -8 },   // 0x28 '('
-  {    44,   3,  12,   7,    2,   -8 },   // 0x29 ')'
-  {    49,   4,   4,   6,    1,   -8 },   // 0x2A '*'
-  {    51,   7,   6,   9,    1,   -6 },   // 0x2B '+'
-  {    57,   1,   3,   4,    1,    0 },   // 0x2C ','
-  {    58,   4,   1,   6,    1,   -3 },   // 0x2D '-'
-  {    59,   1,   1,   3,    1,    0 },   // 0x2E '.'
-  {    60,   4,  12,   6,    1,   -8 },   // 0x2F '/'
-  {    66,   6,   8,   8,    1,   -7 },   // 0x30 '0'
-  {    72,   3,   8,   6,    1,   -7 },   // 0x31 '1'
-  {    75,   5,   8,   7,    1,   -7 },   // 0x32 '2'
-  {    80,   5,   8,   7,    1,   -7 },   // 0x33 '3'
-  {    85,   6,   8,   7,    1,   -7 },   // 0x34 '4'
-  {    91,   6,   8,   7,    0,   -7 },   // 0x35 '5'
-  {    97,   6,   8,   8,    1,   -7 },   // 0x36 '6'
-  {   103,   6,   8,   7,    0,   -7 },   // 0x37 '7'
-  {   109,   6,   8,   8,    1,   -7 },   // 0x38 '8'
-  {   115,   6,   8,   8,    1,   -7 },   // 0x39 '9'
-  {   121,   1,   6,   3,    1,   -5 },   // 0x3A ':'
-  {   122,   1,   8,   3,    1,   -5 },   // 0x3B ';'
-  {   123,   5,   6,   9,    2,   -6 },   // 0x3C '<'
-  {   127,   6,   4,   9,    1,   -5 },   // 0x3D '='
-  {   130,   5,   6,   9,    2,   -6 },   // 0x3E '>'
-  {   134,   5,   8,   6,    0,   -7 },   // 0x3F '?'
-  {   139,  10,   9,  12,    1,   -8 },   // 0x40 '@'
-  {   151,   8,   8,   9,    0,   -7 },   // 0x41 'A'
-  {   159,   6,   8,   8,    1,   -7 },   // 0x42 'B'
-  {   165,   7,   8,   9,    1,   -7 },   // 0x43 'C'
-  {   172,   7,   8,   9,    1,   -7 },   // 0x44 'D'
-  {   179,   5,   8,   7,    1,   -7 },   // 0x45 'E'
-  {   184,   5,   8,   7,    1,   -7 },   // 0x46 'F'
-  {   189,   9,   8,  10,    1,   -7 },   // 0x47 'G'
-  {   198,   7,   8,   9,    1,   -7 },   // 0x48 'H'
-  {   205,   1,   8,   3,    1,   -7 },   // 0x49 'I'
-  {   206,   4,   8,   5,    0,   -7 },   // 0x4A 'J'
-  {   210,   6,   8,   7,    1,   -7 },   // 0x4B 'K'
-  {   216,   5,   8,   6,    1,   -7 },   // 0x4C 'L'
-  {   221,   9,   8,  11,    1,   -7 },   // 0x4D 'M'
-  {   230,   7,   8,   9,    1,   -7 },   // 0x4E 'N'
-  {   237,   9,   8,  11,    1,   -7 },   // 0x4F 'O'
-  {   246,   6,   8,   8,    1,   -7 },   // 0x50 'P'
-  {   252,   9,   8,  11,    1,   -7 },   // 0x51 'Q'
-  {   261,   6,   8,   8,    1,   -7 },   // 0x52 'R'
-  {   267,   6,   8,   8,    1,   -7 },   // 0x53 'S'
-  {   273,   7,   8,   7,    0,   -7 },   // 0x54 'T'
-  {   280,   7,   8,   9,    1,   -7 },   // 0x55 'U'
-  {   287,   7,   8,   9,    1,   -7 },   // 0x56 'V'
-  {   294,   9,   8,  11,    1,   -7 },   // 0x57 'W'
-  {   303,   7,   8,   8,    0,   -7 },   // 0x58 'X'
-  {   310,   7,   8,   9,    1,   -7 },   // 0x59 'Y'
-  {   317,   7,   8,   7,    0,   -7 },   // 0x5A 'Z'
-  {   324,   3,  12,   6,    2,   -8 },   // 0x5B '['
-  {   329,   4,  12,   6,    1,   -8 },   // 0x5C '\'
-  {   335,   3,  12,   6,    1,   -8 },   // 0x5D ']'
-  {   340,   5,   5,   9,    2,   -9 },   // 0x5E '^'
-  {   344,   7,   1,   9,    1,    2 },   // 0x5F '_'
-  {   345,   3,   3,   4,    1,   -9 },   // 0x60 '`'
-  {   347,   6,   6,   8,    1,   -5 },   // 0x61 'a'
-  {   352,   6,   9,   8,    1,   -8 },   // 0x62 'b'
-  {   359,   6,   6,   7,    1,   -5 },   // 0x63 'c'
-  {   364,   6,   9,   8,    1,   -8 },   // 0x64 'd'
-  {   371,   6,   6,   8,    1,   -5 },   // 0x65 'e'
-  {   376,   4,   9,   5,    1,   -8 },   // 0x66 'f'
-  {   381,   6,   9,   8,    1,   -5 },   // 0x67 'g'
-  {   388,   6,   9,   8,    1,   -8 },   // 0x68 'h'
-  {   395,   1,   9,   3,    1,   -8 },   // 0x69 'i'
-  {   397,   3,  12,   3,   -1,   -8 },   // 0x6A 'j'
-  {   402,   5,   9,   7,    1,   -8 },   // 0x6B 'k'
-  {   408,   1,   9,   3,    1,   -8 },   // 0x6C 'l'
-  {   410,  11,   6,  13,    1,   -5 },   // 0x6D 'm'
-  {   419,   6,   6,   8,    1,   -5 },   // 0x6E 'n'
-  {   424,   6,   6,   8,    1,   -5 },   // 0x6F 'o'
-  {   429,   6,   9,   8,    1,   -5 },   // 0x70 'p'
-  {   436,   6,   9,   8,    1,   -5 },   // 0x71 'q'
-  {   443,   4,   6,   5,    1,   -5 },   // 0x72 'r'
-  {   446,   5,   6,   7,    1,   -5 },   // 0x73 's'
-  {   450,   4,   8,   5,    0,   -7 },   // 0x74 't'
-  {   454,   6,   6,   8,    1,   -5 },   // 0x75 'u'
-  {   459,   6,   6,   7,    0,   -5 },   // 0x76 'v'
-  {   464,   9,   6,  10,    0,   -5 },   // 0x77 'w'
-  {   471,   6,   6,   6,    0,   -5 },   // 0x78 'x'
-  {   476,   7,   9,   7,    0,   -5 },   // 0x79 'y'
-  {   484,   6,   6,   6,    0,   -5 },   // 0x7A 'z'
-  {   489,   4,  12,   7,    2,   -8 },   // 0x7B '{'
-  {   495,   1,  13,   5,    2,   -9 },   // 0x7C '|'
-  {   497,   4,  12,   7,    1,   -8 },   // 0x7D '}'
-  {   503,   7,   2,   9,    1,   -4 } }; // 0x7E '~'
+constexpr GFXglyph Dongle_Light11ptGlyphs[] PROGMEM = {
+  {     0,   0,   0,   4,    0,    0 },   // 0x20 ' '
+  {     0,   1,   8,   3,    1,   -7 },   // 0x21 '!'
+  {     1,   3,   3,   5,    1,   -8 },   // 0x22 '"'
+  {     3,   8,   7,  10,    1,   -6 },   // 0x23 '#'
+  {    10,   5,  11,   7,    1,   -8 },   // 0x24 '$'
+  {    17,  10,   8,  12,    1,   -7 },   // 0x25 '%'
+  {    27,   7,   8,   9,    1,   -7 },   // 0x26 '&'
+  {    34,   1,   3,   3,    1,   -8 },   // 0x27 '''
+  {    35,   3,  11,   7,    2,   -8 },   // 0x28 '('
+  {    40,   3,  11,   7,    2,   -8 },   // 0x29 ')'
+  {    45,   4,   4,   6,    1,   -8 },   // 0x2A '*'
+  {    47,   7,   6,   9,    1,   -6 },   // 0x2B '+'
+  {    53,   1,   3,   4,    1,    0 },   // 0x2C ','
+  {    54,   4,   1,   6,    1,   -3 },   // 0x2D '-'
+  {    55,   1,   1,   3,    1,    0 },   // 0x2E '.'
+  {    56,   4,  11,   6,    1,   -8 },   // 0x2F '/'
+  {    62,   6,   8,   8,    1,   -7 },   // 0x30 '0'
+  {    68,   2,   8,   6,    2,   -7 },   // 0x31 '1'
+  {    70,   5,   8,   7,    1,   -7 },   // 0x32 '2'
+  {    75,   5,   8,   7,    1,   -7 },   // 0x33 '3'
+  {    80,   6,   8,   7,    1,   -7 },   // 0x34 '4'
+  {    86,   6,   8,   7,    0,   -7 },   // 0x35 '5'
+  {    92,   6,   8,   8,    1,   -7 },   // 0x36 '6'
+  {    98,   6,   8,   7,    0,   -7 },   // 0x37 '7'
+  {   104,   6,   8,   8,    1,   -7 },   // 0x38 '8'
+  {   110,   6,   8,   8,    1,   -7 },   // 0x39 '9'
+  {   116,   1,   6,   3,    1,   -5 },   // 0x3A ':'
+  {   117,   1,   7,   3,    1,   -5 },   // 0x3B ';'
+  {   118,   5,   6,   9,    2,   -6 },   // 0x3C '<'
+  {   122,   6,   4,   9,    1,   -5 },   // 0x3D '='
+  {   125,   5,   6,   9,    2,   -6 },   // 0x3E '>'
+  {   129,   4,   8,   6,    1,   -7 },   // 0x3F '?'
+  {   133,  10,   9,  12,    1,   -8 },   // 0x40 '@'
+  {   145,   8,   8,   9,    0,   -7 },   // 0x41 'A'
+  {   153,   6,   8,   8,    1,   -7 },   // 0x42 'B'
+  {   159,   7,   8,   9,    1,   -7 },   // 0x43 'C'
+  {   166,   7,   8,   9,    1,   -7 },   // 0x44 'D'
+  {   173,   5,   8,   7,    1,   -7 },   // 0x45 'E'
+  {   178,   5,   8,   7,    1,   -7 },   // 0x46 'F'
+  {   183,   8,   8,  10,    1,   -7 },   // 0x47 'G'
+  {   191,   7,   8,   9,    1,   -7 },   // 0x48 'H'
+  {   198,   1,   8,   3,    1,   -7 },   // 0x49 'I'
+  {   199,   4,   8,   5,    0,   -7 },   // 0x4A 'J'
+  {   203,   6,   8,   7,    1,   -7 },   // 0x4B 'K'
+  {   209,   5,   8,   6,    1,   -7 },   // 0x4C 'L'
+  {   214,   9,   8,  11,    1,   -7 },   // 0x4D 'M'
+  {   223,   7,   8,   9,    1,   -7 },   // 0x4E 'N'
+  {   230,   9,   8,  11,    1,   -7 },   // 0x4F 'O'
+  {   239,   6,   8,   8,    1,   -7 },   // 0x50 'P'
+  {   245,   9,   8,  11,    1,   -7 },   // 0x51 'Q'
+  {   254,   6,   8,   8,    1,   -7 },   // 0x52 'R'
+  {   260,   6,   8,   8,    1,   -7 },   // 0x53 'S'
+  {   266,   7,   8,   7,    0,   -7 },   // 0x54 'T'
+  {   273,   7,   8,   9,    1,   -7 },   // 0x55 'U'
+  {   280,   7,   8,   9,    1,   -7 },   // 0x56 'V'
+  {   287,   9,   8,  11,    1,   -7 },   // 0x57 'W'
+  {   296,   7,   8,   8,    0,   -7 },   // 0x58 'X'
+  {   303,   7,   8,   9,    1,   -7 },   // 0x59 'Y'
+  {   310,   7,   8,   7,    0,   -7 },   // 0x5A 'Z'
+  {   317,   3,  12,   6,    2,   -8 },   // 0x5B '['
+  {   322,   4,  11,   6,    1,   -8 },   // 0x5C '\'
+  {   328,   3,  12,   6,    1,   -8 },   // 0x5D ']'
+  {   333,   5,   4,   9,    2,   -9 },   // 0x5E '^'
+  {   336,   7,   1,   9,    1,    2 },   // 0x5F '_'
+  {   337,   3,   2,   4,    1,   -8 },   // 0x60 '`'
+  {   338,   6,   6,   8,    1,   -5 },   // 0x61 'a'
+  {   343,   6,   9,   8,    1,   -8 },   // 0x62 'b'
+  {   350,   6,   6,   7,    1,   -5 },   // 0x63 'c'
+  {   355,   6,   9,   8,    1,   -8 },   // 0x64 'd'
+  {   362,   6,   6,   8,    1,   -5 },   // 0x65 'e'
+  {   367,   4,   9,   5,    1,   -8 },   // 0x66 'f'
+  {   372,   6,   9,   8,    1,   -5 },   // 0x67 'g'
+  {   379,   6,   9,   8,    1,   -8 },   // 0x68 'h'
+  {   386,   1,   9,   3,    1,   -8 },   // 0x69 'i'
+  {   388,   3,  12,   3,   -1,   -8 },   // 0x6A 'j'
+  {   393,   5,   9,   7,    1,   -8 },   // 0x6B 'k'
+  {   399,   1,   9,   3,    1,   -8 },   // 0x6C 'l'
+  {   401,  11,   6,  13,    1,   -5 },   // 0x6D 'm'
+  {   410,   6,   6,   8,    1,   -5 },   // 0x6E 'n'
+  {   415,   6,   6,   8,    1,   -5 },   // 0x6F 'o'
+  {   420,   6,   9,   8,    1,   -5 },   // 0x70 'p'
+  {   427,   6,   9,   8,    1,   -5 },   // 0x71 'q'
+  {   434,   4,   6,   5,    1,   -5 },   // 0x72 'r'
+  {   437,   5,   6,   7,    1,   -5 },   // 0x73 's'
+  {   441,   4,   8,   5,    0,   -7 },   // 0x74 't'
+  {   445,   6,   6,   8,    1,   -5 },   // 0x75 'u'
+  {   450,   6,   6,   7,    0,   -5 },   // 0x76 'v'
+  {   455,   9,   6,  10,    0,   -5 },   // 0x77 'w'
+  {   462,   6,   6,   6,    0,   -5 },   // 0x78 'x'
+  {   467,   7,   9,   7,    0,   -5 },   // 0x79 'y'
+  {   475,   6,   6,   6,    0,   -5 },   // 0x7A 'z'
+  {   480,   4,  12,   7,    2,   -8 },   // 0x7B '{'
+  {   486,   1,  12,   5,    2,   -8 },   // 0x7C '|'
+  {   488,   4,  12,   7,    1,   -8 },   // 0x7D '}'
+  {   494,   7,   2,   9,    1,   -4 },   // 0x7E '~'
+  {   496,   8,  11,   9,    0,  -10 },   // 0x00C0 'À'
+  {   507,   8,  12,   9,    0,  -11 },   // 0x00C2 'Â'
+  {   519,   8,  10,   9,    0,   -9 },   // 0x00C4 'Ä'
+  {   529,   7,  11,   9,    1,   -7 },   // 0x00C7 'Ç'
+  {   539,   5,  11,   7,    1,  -10 },   // 0x00C8 'È'
+  {   546,   5,  11,   7,    1,  -10 },   // 0x00C9 'É'
+  {   553,   5,  12,   7,    1,  -11 },   // 0x00CA 'Ê'
+  {   561,   5,  10,   7,    1,   -9 },   // 0x00CB 'Ë'
+  {   568,   5,  12,   3,   -1,  -11 },   // 0x00CE 'Î'
+  {   576,   3,  10,   3,    0,   -9 },   // 0x00CF 'Ï'
+  {   580,   9,  12,  11,    1,  -11 },   // 0x00D4 'Ô'
+  {   594,   9,  10,  11,    1,   -9 },   // 0x00D6 'Ö'
+  {   606,   7,  11,   9,    1,  -10 },   // 0x00D9 'Ù'
+  {   616,   7,  12,   9,    1,  -11 },   // 0x00DB 'Û'
+  {   627,   7,  10,   9,    1,   -9 },   // 0x00DC 'Ü'
+  {   636,   6,   9,   8,    1,   -8 },   // 0x00E0 'à'
+  {   643,   6,  10,   8,    1,   -9 },   // 0x00E2 'â'
+  {   651,   6,   8,   8,    1,   -7 },   // 0x00E4 'ä'
+  {   657,   6,   9,   7,    1,   -5 },   // 0x00E7 'ç'
+  {   664,   6,   9,   8,    1,   -8 },   // 0x00E8 'è'
+  {   671,   6,   9,   8,    1,   -8 },   // 0x00E9 'é'
+  {   678,   6,  10,   8,    1,   -9 },   // 0x00EA 'ê'
+  {   686,   6,   8,   8,    1,   -7 },   // 0x00EB 'ë'
+  {   692,   5,  10,   3,   -1,   -9 },   // 0x00EE 'î'
+  {   699,   3,   8,   3,    0,   -7 },   // 0x00EF 'ï'
+  {   702,   6,  10,   8,    1,   -9 },   // 0x00F4 'ô'
+  {   710,   6,   8,   8,    1,   -7 },   // 0x00F6 'ö'
+  {   716,   6,   9,   8,    1,   -8 },   // 0x00F9 'ù'
+  {   723,   6,  10,   8,    1,   -9 },   // 0x00FB 'û'
+  {   731,   6,   8,   8,    1,   -7 },   // 0x00FC 'ü'
+  {   737,   7,  11,   7,    0,   -7 } }; // 0x00FF 'ÿ'
 
-const GFXfont Dongle_Light11pt7b PROGMEM = {
-  (uint8_t  *)Dongle_Light11pt7bBitmaps,
-  (GFXglyph *)Dongle_Light11pt7bGlyphs,
-  0x20, 0x7E, 31 };
+constexpr GlyphRange Dongle_Light11ptRanges[] PROGMEM = {
+  { 0x0020, 0x007E,    0 },
+  { 0x00C0, 0x00C0,   95 },
+  { 0x00C2, 0x00C2,   96 },
+  { 0x00C4, 0x00C4,   97 },
+  { 0x00C7, 0x00CB,   98 },
+  { 0x00CE, 0x00CF,  103 },
+  { 0x00D4, 0x00D4,  105 },
+  { 0x00D6, 0x00D6,  106 },
+  { 0x00D9, 0x00D9,  107 },
+  { 0x00DB, 0x00DC,  108 },
+  { 0x00E0, 0x00E0,  110 },
+  { 0x00E2, 0x00E2,  111 },
+  { 0x00E4, 0x00E4,  112 },
+  { 0x00E7, 0x00EB,  113 },
+  { 0x00EE, 0x00EF,  118 },
+  { 0x00F4, 0x00F4,  120 },
+  { 0x00F6, 0x00F6,  121 },
+  { 0x00F9, 0x00F9,  122 },
+  { 0x00FB, 0x00FC,  123 },
+  { 0x00FF, 0x00FF,  125 } };
 
-// Create alias for backward compatibility
-#define DongleLight9pt7b Dongle_Light11pt7b
+constexpr SparseFont Dongle_Light11pt PROGMEM = {
+  Dongle_Light11ptBitmaps, Dongle_Light11ptGlyphs, Dongle_Light11ptRanges, 20, 31 };
 
-// Approx. 1177 bytes
+// Approx. 1763 bytes
@@ -0,0 +1,170 @@
+#include "band_buffer.h"
+#include "fbops.h"
+#include <stdlib.h>
+#include <string.h>
+
+BandBuffer::~BandBuffer()
+{
+  release();
+}
+
+bool BandBuffer::allocate(int16_t width, int16_t rows, uint8_t planeCount)
+{
+  release();
+  planes = (uint8_t *)malloc(bandBytes(width, rows, planeCount));
+  if (!planes)
+  {
+    return false;
+  }
+  planeBytes = bandBytes(width, rows, 1);
+  planeCount_ = planeCount;
+  bandWidth = width;
+  maxRows = rows;
+  return true;
+}
+
+void BandBuffer::release()
+{
+  free(planes);
+  planes = nullptr;
+  planeBytes = 0;
+  planeCount_ = 0;
+  bandWidth = maxRows = bandTop = bandRows = 0;
+}
+
+void BandBuffer::setBand(int16_t top, int16_t rows)
+{
+  bandTop = top;
+  bandRows = rows < maxRows ? rows : maxRows;
+  fill(INK_WHITE);
+}
+
+void BandBuffer::fill(ink_t ink)
+{
+  // The planes of a shorter last band are packed at the start of each plane
+  size_t bytes = (size_t)(bandWidth / 8) * bandRows;
+  ink = planeInk(ink);
+  memset(planes, ink == INK_BLACK ? 0x00 : 0xFF, bytes);
+  if (planeCount_ == 2)
+  {
+    memset(planes + planeBytes, ink == INK_RED ? 0x00 : 0xFF, bytes);
+  }
+}
+
+/* Sets the bits of mask in byte i of each plane row to ink. red is nullptr
+ * without a red plane.
+ */
+static inline void setBits(uint8_t *black, uint8_t *red, int16_t i,
+                           uint8_t mask, ink_t ink)
+{
+  if (ink == INK_BLACK)
+  {
+    black[i] &= ~mask;
+  }
+  else
+  {
+    black[i] |= mask;
+  }
+  if (!red)
+  {
+    return;
+  }
+  if (ink == INK_RED)
+  {
+    red[i] &= ~mask;
+  }
+  else
+  {
+    red[i] |= mask;
+  }
+}
+
+void BandBuffer::setPixel(int16_t x, int16_t y, ink_t ink)
+{
+  y -= bandTop;
+  if (x < 0 || x >= bandWidth || y < 0 || y >= bandRows)
+  {
+    return;
+  }
+  setBits(blackRow(y), redRow(y), x >> 3, 0x80 >> (x & 7), planeInk(ink));
+}
+
+void BandBuffer::fillSpan(int16_t x, int16_t y, int16_t w, ink_t ink)
+{
+  y -= bandTop;
+  if (y >= 0 && y < bandRows)
+  {
+    fillRowSpan(y, x, w, ink);
+  }
+}
+
+void BandBuffer::fillRowSpan(int16_t row, int16_t x, int16_t w, ink_t ink)
+{
+  int16_t x1 = x + w;     // exclusive
+  if (x < 0)
+  {
+    x = 0;
+  }
+  if (x1 > bandWidth)
+  {
+    x1 = bandWidth;
+  }
+  if (x >= x1)
+  {
+    return;
+  }
+  ink = planeInk(ink);
+  fbFillBits(blackRow(row), x, x1, ink != INK_BLACK);
+  if (planeCount_ == 2)
+  {
+    fbFillBits(redRow(row), x, x1, ink != INK_RED);
+  }
+}
+
+void BandBuffer::blitRow(int16_t row, int16_t x, const uint8_t *bits,
+                         int16_t w, bool inverted, ink_t ink)
+{
+  ink = planeInk(ink);
+  uint8_t *black = blackRow(row);
+  uint8_t *red = redRow(row);
+  const int16_t rowBytes = bandWidth / 8;
+  const uint8_t flip = inverted ? 0xFF : 0x00;
+  const int16_t shift = x & 7;
+  const int16_t bytes = (w + 7) / 8;
+  // Bits of the last byte that are part of the row
+  const uint8_t lastMask = 0xFF << ((8 - (w & 7)) & 7);
+  int16_t dst = x >> 3;
+  for (int16_t i = 0; i < bytes; i++, dst++)
+  {
+    uint8_t src = bits[i] ^ flip;
+    if (i == bytes - 1)
+    {
+      src &= lastMask;
+    }
+    if (!src)
+    {
+      continue;
+    }
+    uint8_t hi = src >> shift;
+    uint8_t lo = src << (8 - shift);
+    if (hi && dst >= 0 && dst < rowBytes)
+    {
+      setBits(black, red, dst, hi, ink);
+    }
+    if (lo && dst + 1 >= 0 && dst + 1 < rowBytes)
+    {
+      setBits(black, red, dst + 1, lo, ink);
+    }
+  }
+} // end blitRow
+
+bool BandBuffer::redBlank() const
+{
+  const uint8_t *red = redRow(0);
+  if (!red)
+  {
+    return true;
+  }
+  size_t bytes = (size_t)(bandWidth / 8) * bandRows;
+  return fbFindRun(red, bytes, 0xFF).start == bytes;
+}
@@ -0,0 +1,121 @@
+#ifndef BAND_BUFFER_H
+#define BAND_BUFFER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Two-plane frame buffer for a horizontal band of the panel, laid out the way
+ * GxEPD2 writes it to the controller: one black and one red plane, rows of
+ * width / 8 bytes, MSB first, a cleared bit is ink. A red pixel clears the
+ * black plane at the same position, as GxEPD2_3C does. For black and white
+ * panels the red plane is left out and red ink is drawn black.
+ *
+ * The band is allocated on the heap once WiFi is off, so its height is chosen
+ * at run time from the free memory instead of being fixed at compile time.
+ */
+
+typedef enum ink {
+  INK_WHITE,
+  INK_BLACK,
+  INK_RED
+} ink_t;
+
+// Bands a frame is rendered in
+struct PagePlan {
+  uint8_t pages;        // 0 if not even the smallest band fits
+  int16_t bandHeight;
+  size_t bytes;         // all planes of one band
+};
+
+constexpr size_t bandBytes(int16_t width, int16_t rows, uint8_t planes = 2)
+{
+  return (size_t)(width / 8) * rows * planes;
+}
+
+/* Picks the fewest pages, 1, 2, 4 ... up to maxPages, whose band fits into
+ * available bytes.
+ */
+constexpr PagePlan planPages(int16_t width, int16_t height, size_t available,
+                             uint8_t maxPages, uint8_t planes = 2)
+{
+  // Wider than maxPages, so that doubling past 128 ends the loop
+  for (unsigned pages = 1; pages <= maxPages; pages *= 2)
+  {
+    int16_t bandHeight = (height + pages - 1) / pages;
+    if (bandBytes(width, bandHeight, planes) <= available)
+    {
+      return {(uint8_t)pages, bandHeight, bandBytes(width, bandHeight, planes)};
+    }
+  }
+  return {0, 0, 0};
+}
+
+class BandBuffer {
+public:
+  BandBuffer() = default;
+  BandBuffer(const BandBuffer &) = delete;
+  BandBuffer &operator=(const BandBuffer &) = delete;
+  ~BandBuffer();
+
+  // Allocates the planes for bands of up to maxRows rows, false if out of
+  // memory. With 1 plane there is no red plane.
+  bool allocate(int16_t width, int16_t maxRows, uint8_t planes = 2);
+  void release();
+
+  // Starts the band of rows [top, top + rows), all white
+  void setBand(int16_t top, int16_t rows);
+  void fill(ink_t ink);
+  // x and y are frame coordinates, pixels outside the band are ignored
+  void setPixel(int16_t x, int16_t y, ink_t ink);
+  // Fills w pixels from x, y, whole bytes of both planes at a time
+  void fillSpan(int16_t x, int16_t y, int16_t w, ink_t ink);
+  // Same for a row of the band, 0 ... rows() - 1, for callers that clipped
+  // their rows to the band already
+  void fillRowSpan(int16_t row, int16_t x, int16_t w, ink_t ink);
+  // Sets ink at x + i of a row of the band for every set bit i of an MSB
+  // first bitmap row w pixels wide, or every cleared bit if inverted. The
+  // bitmap row is shifted into place a byte at a time.
+  void blitRow(int16_t row, int16_t x, const uint8_t *bits, int16_t w,
+               bool inverted, ink_t ink);
+  // True if no pixel of the band is red
+  bool redBlank() const;
+
+  int16_t width() const { return bandWidth; }
+  int16_t top() const { return bandTop; }
+  int16_t rows() const { return bandRows; }
+  uint8_t planeCount() const { return planeCount_; }
+  const uint8_t *black() const { return planes; }
+  // nullptr without a red plane
+  const uint8_t *red() const { return redRow(0); }
+  // Row of the band, 0 ... rows() - 1
+  uint8_t *blackRow(int16_t row) { return planes + row * (bandWidth / 8); }
+  uint8_t *redRow(int16_t row)
+  {
+    return planeCount_ == 2 ? blackRow(row) + planeBytes : nullptr;
+  }
+  const uint8_t *blackRow(int16_t row) const
+  {
+    return planes + row * (bandWidth / 8);
+  }
+  const uint8_t *redRow(int16_t row) const
+  {
+    return planeCount_ == 2 ? blackRow(row) + planeBytes : nullptr;
+  }
+
+private:
+  // Red is drawn black without a red plane
+  ink_t planeInk(ink_t ink) const
+  {
+    return ink == INK_RED && planeCount_ == 1 ? INK_BLACK : ink;
+  }
+
+  uint8_t *planes = nullptr;    // black plane followed by the red plane
+  size_t planeBytes = 0;        // of one plane at maxRows
+  uint8_t planeCount_ = 0;
+  int16_t bandWidth = 0;
+  int16_t maxRows = 0;
+  int16_t bandTop = 0;
+  int16_t bandRows = 0;
+};
+
+#endif // BAND_BUFFER_H
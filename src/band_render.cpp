@@ -0,0 +1,70 @@
+#include "band_render.h"
+#include "panel_color.h"
+#include "span_raster.h"
+#include "blitter.h"
+#include "text_layout.h"
+#include <string.h>
+
+ink_t inkOf(uint16_t color)
+{
+  return color == GxEPD_WHITE ? INK_WHITE
+         : color == GxEPD_RED ? INK_RED
+                              : INK_BLACK;
+}
+
+// Unpacked glyphs of recent frames, see blitter.h
+static GlyphCache glyphCache;
+
+bool replayIntoBand(BandBuffer &band, const DisplayList &dl,
+                    const DisplayCommand &cmd)
+{
+  switch (cmd.op)
+  {
+  case OP_FILL_RECT:
+    fillRectSpans(band, cmd.x, cmd.y, cmd.w, cmd.h, inkOf(cmd.color));
+    return true;
+  case OP_FILL_ROUND_RECT:
+    return fillRoundRectSpans(band, cmd.x, cmd.y, cmd.w, cmd.h, cmd.r,
+                              cmd.corners, inkOf(cmd.color));
+  case OP_FILL_CIRCLE:
+    return fillCircleSpans(band, cmd.x, cmd.y, cmd.r, inkOf(cmd.color));
+  case OP_TEXT:
+  {
+    const SparseFont &font = getFont((font_t)cmd.font);
+    const char *text = dl.textOf(cmd);
+    forEachTextGlyph(font, text, strlen(text),
+                     [&](const GFXglyph &glyph, int16_t dx) {
+                       blitGlyph(band, glyphCache, font, glyph, cmd.x + dx,
+                                 cmd.y, inkOf(cmd.color));
+                     });
+    return true;
+  }
+  case OP_ICON:
+    blitIcon(band, cmd.x, cmd.y, *cmd.icon, inkOf(cmd.color));
+    return true;
+  default:
+    return false;
+  }
+} // end replayIntoBand
+
+
+int renderBand(BandBuffer &band, const DisplayList &dl)
+{
+  int16_t top = band.top();
+  int16_t bottom = top + band.rows();
+  if (dl.background())
+  {
+    forEachChromeRun(*dl.background(), top, bottom,
+                     [&](int16_t x, int16_t y, int16_t w, uint8_t plane) {
+                       band.fillSpan(x, y, w,
+                                     plane == CHROME_PLANE_RED ? INK_RED
+                                                               : INK_BLACK);
+                     });
+  }
+  int undrawn = 0;
+  dl.forEachInBand(top, bottom,
+                   [&](const DisplayCommand &cmd) {
+                     undrawn += !replayIntoBand(band, dl, cmd);
+                   });
+  return undrawn;
+}
@@ -0,0 +1,26 @@
+#ifndef BAND_RENDER_H
+#define BAND_RENDER_H
+
+#include <stdint.h>
+#include "band_buffer.h"
+#include "display_list.h"
+
+/* Replays a display list straight into a band buffer, with the span
+ * rasterizer and the blitter instead of a graphics library, see
+ * span_raster.h and blitter.h. The firmware draws what these don't handle
+ * with Adafruit_GFX; native builds of the layout, such as the frame
+ * renderer in tools/framerender, have only these.
+ */
+
+// Maps a GxEPD2 color to the ink of a band, the way GxEPD2_3C does
+ink_t inkOf(uint16_t color);
+// Draws a single command into band. Returns false for lines and for rounded
+// shapes with a radius above SPAN_MAX_RADIUS, which it leaves undrawn.
+bool replayIntoBand(BandBuffer &band, const DisplayList &dl,
+                    const DisplayCommand &cmd);
+// Draws the rows of the display list that band covers: first its chrome,
+// then the commands with pixels in them. Returns how many commands it
+// couldn't draw.
+int renderBand(BandBuffer &band, const DisplayList &dl);
+
+#endif // BAND_RENDER_H
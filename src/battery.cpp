@@ -0,0 +1,90 @@
+#include "battery.h"
+#include "battery_soc.h"
+#include "config.h"
+
+#include <esp_adc_cal.h>
+
+// Kept in RTC memory across deep sleep: the eFuse calibration only has to be
+// read once per power up, and the resistance is learnt over many wakes
+struct BatteryCache {
+  bool valid;
+  esp_adc_cal_characteristics_t adc;
+  uint16_t milliOhm;
+};
+
+RTC_DATA_ATTR static BatteryCache cache = {};
+
+// The last uncorrected idle reading, compared with the one under load
+static uint32_t idleMv = 0;
+
+/* Returns the median of BATTERY_SAMPLES readings in millivolts. Single
+ * readings of the ESP32 ADC scatter by tens of millivolts.
+ */
+static uint32_t sampleBatteryMv()
+{
+  if (!cache.valid)
+  {
+    // We will use the eFuse ADC calibration bits, to get accurate voltage
+    // readings. The DFRobot FireBeetle Esp32-E V1.0's ADC is 12 bit, and uses
+    // 11db attenuation, which gives it a measurable input voltage range of
+    // 150mV to 2450mV.
+    esp_adc_cal_value_t val_type __attribute__((unused)) =
+        esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_12,
+                                 ADC_WIDTH_BIT_12, 1100, &cache.adc);
+#if DEBUG_LEVEL >= 1
+    if (val_type == ESP_ADC_CAL_VAL_EFUSE_VREF)
+    {
+      Serial.println("[debug] ADC Cal eFuse Vref");
+    }
+    else if (val_type == ESP_ADC_CAL_VAL_EFUSE_TP)
+    {
+      Serial.println("[debug] ADC Cal Two Point");
+    }
+    else
+    {
+      Serial.println("[debug] ADC Cal Default");
+    }
+#endif
+    cache.milliOhm = BATTERY_RESISTANCE;
+    cache.valid = true;
+  }
+
+  uint16_t samples[BATTERY_SAMPLES];
+  for (int i = 0; i < BATTERY_SAMPLES; i++)
+  {
+    samples[i] = analogRead(PIN_BAT_ADC);
+  }
+  uint16_t raw = medianOf(samples, BATTERY_SAMPLES);
+  // DFRobot FireBeetle Esp32-E V1.0 voltage divider (1M+1M), so readings are
+  // multiplied by 2.
+  return esp_adc_cal_raw_to_voltage(raw, &cache.adc) * 2;
+} // end sampleBatteryMv
+
+/* Returns battery voltage in millivolts (mv), the open circuit voltage the
+ * reading and the learnt internal resistance give.
+ */
+uint32_t readBatteryVoltage()
+{
+  idleMv = sampleBatteryMv();
+  return openCircuitMv(idleMv, BATTERY_IDLE_CURRENT, cache.milliOhm);
+}
+
+/* Samples while the radio draws BATTERY_WIFI_CURRENT and moves the cached
+ * resistance a quarter of the way to what the two readings give.
+ */
+void measureBatterySag()
+{
+  if (!idleMv)
+  {
+    return;
+  }
+  uint32_t loadMv = sampleBatteryMv();
+  uint32_t milliOhm = sagResistance(idleMv, BATTERY_IDLE_CURRENT, loadMv,
+                                    BATTERY_WIFI_CURRENT);
+  Serial.printf("Battery %lu mv idle, %lu mv with WiFi\n",
+                (unsigned long)idleMv, (unsigned long)loadMv);
+  if (milliOhm)
+  {
+    cache.milliOhm = (3 * cache.milliOhm + milliOhm) / 4;
+  }
+}
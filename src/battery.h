@@ -0,0 +1,21 @@
+#ifndef BATTERY_H
+#define BATTERY_H
+
+#include <Arduino.h>
+#include "config.h"
+#include "battery_soc.h"
+
+// Battery voltage in millivolts, corrected for the current the awake device
+// draws; call with WiFi off
+uint32_t readBatteryVoltage();
+// Measures again while WiFi is connected to learn the internal resistance
+// that the next readings correct with
+void measureBatterySag();
+// Charge in percent for the BATTERY_PROFILE chemistry, without the ADC so
+// that the layout builds natively
+inline uint32_t batteryPercent(uint32_t mv)
+{
+  return BATTERY_PROFILE::lut.lookup(mv);
+}
+
+#endif // BATTERY_H
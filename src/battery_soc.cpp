@@ -0,0 +1,50 @@
+#include "battery_soc.h"
+
+// Resistances outside these are taken for a reading disturbed by something
+// else than the load
+#define MIN_SAG_RESISTANCE 20
+#define MAX_SAG_RESISTANCE 2000
+
+/* Sorts the samples by insertion, there are only a few, and returns the
+ * middle one; the lower middle one for an even count.
+ */
+uint16_t medianOf(uint16_t *samples, size_t count)
+{
+  if (!count)
+  {
+    return 0;
+  }
+  for (size_t i = 1; i < count; i++)
+  {
+    uint16_t sample = samples[i];
+    size_t j = i;
+    for (; j > 0 && samples[j - 1] > sample; j--)
+    {
+      samples[j] = samples[j - 1];
+    }
+    samples[j] = sample;
+  }
+  return samples[(count - 1) / 2];
+}
+
+uint32_t openCircuitMv(uint32_t mv, uint32_t currentMa, uint32_t milliOhm)
+{
+  return mv + (currentMa * milliOhm + 500) / 1000;
+}
+
+/* The drop between the two readings over the difference of the currents.
+ */
+uint32_t sagResistance(uint32_t idleMv, uint32_t idleMa, uint32_t loadMv,
+                       uint32_t loadMa)
+{
+  if (loadMa <= idleMa || loadMv > idleMv)
+  {
+    return 0;
+  }
+  const uint32_t milliOhm = (idleMv - loadMv) * 1000 / (loadMa - idleMa);
+  if (milliOhm < MIN_SAG_RESISTANCE || milliOhm > MAX_SAG_RESISTANCE)
+  {
+    return 0;
+  }
+  return milliOhm;
+}
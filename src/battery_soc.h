@@ -0,0 +1,135 @@
+#ifndef BATTERY_SOC_H
+#define BATTERY_SOC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Battery state of charge from voltage, without hardware: a lookup table per
+ * chemistry built at compile time, the median of noisy ADC samples and the
+ * correction for the voltage the battery loses under load.
+ */
+
+#define SOC_LUT_SIZE 128
+
+// Percent charge by voltage, sampled every stepMv from minMv and
+// interpolated, rounded, in between
+struct SocLut {
+  uint16_t minMv;
+  uint16_t stepMv;
+  uint8_t percent[SOC_LUT_SIZE];
+
+  uint8_t lookup(uint32_t mv) const
+  {
+    if (mv <= minMv)
+    {
+      return percent[0];
+    }
+    const uint32_t offset = mv - minMv;
+    const uint32_t i = offset / stepMv;
+    if (i >= SOC_LUT_SIZE - 1)
+    {
+      return percent[SOC_LUT_SIZE - 1];
+    }
+    return percent[i] + ((percent[i + 1] - percent[i]) * (offset % stepMv)
+                         + stepMv / 2) / stepMv;
+  }
+};
+
+// A point of an open circuit voltage curve
+struct SocKnot {
+  uint16_t mv;
+  uint8_t percent;
+};
+
+constexpr double socSqrt(double x)
+{
+  double root = x > 1 ? x : 1;
+  for (int i = 0; i < 32; i++)
+  {
+    root = (root + x / root) / 2;
+  }
+  return root;
+}
+
+/* The symmetric sigmoid c - c / (1 + (k * x)^5.5) from minMv to maxMv,
+ * x being the fraction of that range, that calcBatPercent() evaluated on
+ * every wake. Contains LGPLv3 code from
+ * <https://github.com/rlogiacco/BatterySense>, see
+ * <https://www.desmos.com/calculator/7m9lu26vpy>.
+ */
+constexpr SocLut makeSigmoidLut(uint16_t minMv, uint16_t maxMv)
+{
+  SocLut lut{};
+  lut.minMv = minMv;
+  lut.stepMv = (maxMv - minMv + SOC_LUT_SIZE - 2) / (SOC_LUT_SIZE - 1);
+  for (int i = 0; i < SOC_LUT_SIZE; i++)
+  {
+    const double y = 1.724 * i * lut.stepMv / (maxMv - minMv);
+    const double p = 105 - 105 / (1 + y * y * y * y * y * socSqrt(y));
+    lut.percent[i] = p >= 100 ? 100 : (uint8_t)p;
+  }
+  return lut;
+}
+
+/* A piecewise linear curve through knots, sorted by voltage, from the first
+ * knot to the last, rounded to whole percents.
+ */
+template <size_t N>
+constexpr SocLut makeKnotLut(const SocKnot (&knots)[N])
+{
+  SocLut lut{};
+  lut.minMv = knots[0].mv;
+  lut.stepMv = (knots[N - 1].mv - knots[0].mv + SOC_LUT_SIZE - 2)
+               / (SOC_LUT_SIZE - 1);
+  size_t k = 0;
+  for (int i = 0; i < SOC_LUT_SIZE; i++)
+  {
+    const uint32_t mv = lut.minMv + i * lut.stepMv;
+    while (k + 2 < N && mv >= knots[k + 1].mv)
+    {
+      k++;
+    }
+    const SocKnot &a = knots[k];
+    const SocKnot &b = knots[k + 1];
+    if (mv >= b.mv)
+    {
+      lut.percent[i] = b.percent;
+      continue;
+    }
+    lut.percent[i] = a.percent + ((b.percent - a.percent) * (mv - a.mv)
+                                  + (b.mv - a.mv) / 2) / (b.mv - a.mv);
+  }
+  return lut;
+}
+
+// Chemistry profiles for BATTERY_PROFILE in config.h
+
+// Lithium polymer or lithium ion, the sigmoid between the two voltages
+template <uint16_t MinMv, uint16_t MaxMv>
+struct LipoProfile {
+  static constexpr SocLut lut = makeSigmoidLut(MinMv, MaxMv);
+};
+
+// Lithium iron phosphate, resting voltage by charge of a single cell; flat
+// between 20% and 90%
+struct LiFePO4Profile {
+  static constexpr SocKnot knots[] = {
+    {2500, 0},  {3000, 10}, {3200, 20}, {3220, 30}, {3250, 40}, {3260, 50},
+    {3270, 60}, {3300, 70}, {3320, 80}, {3350, 90}, {3400, 100}
+  };
+  static constexpr SocLut lut = makeKnotLut(knots);
+};
+
+// Median of count samples, which it sorts
+uint16_t medianOf(uint16_t *samples, size_t count);
+
+// Open circuit voltage of a battery reading mv while currentMa flows
+// through its internal resistance
+uint32_t openCircuitMv(uint32_t mv, uint32_t currentMa, uint32_t milliOhm);
+
+// Internal resistance in milliohms from readings at two currents, or 0 when
+// the readings can't be right
+uint32_t sagResistance(uint32_t idleMv, uint32_t idleMa, uint32_t loadMv,
+                       uint32_t loadMa);
+
+#endif // BATTERY_SOC_H
@@ -0,0 +1,132 @@
+#include "blitter.h"
+#include <string.h>
+
+// Largest glyph drawn without the cache, larger ones are skipped
+#define GLYPH_MAX_ROW_BYTES 8
+#define GLYPH_MAX_HEIGHT    64
+
+void unpackGlyph(const SparseFont &font, const GFXglyph &glyph,
+                 uint8_t *rows, int16_t rowBytes)
+{
+  const uint8_t *bits = font.bitmap + glyph.bitmapOffset;
+  uint32_t bit = 0;
+  memset(rows, 0, rowBytes * glyph.height);
+  for (int16_t y = 0; y < glyph.height; y++)
+  {
+    uint8_t *row = rows + y * rowBytes;
+    for (int16_t x = 0; x < glyph.width; x++, bit++)
+    {
+      if (bits[bit >> 3] & (0x80 >> (bit & 7)))
+      {
+        row[x >> 3] |= 0x80 >> (x & 7);
+      }
+    }
+  }
+}
+
+void GlyphCache::clear()
+{
+  memset(entries, 0, sizeof(entries));
+  tick = hits = misses = 0;
+}
+
+const CachedGlyph *GlyphCache::get(const SparseFont &font,
+                                   const GFXglyph &glyph)
+{
+  if (glyph.width > GLYPH_CACHE_ROW_BYTES * 8 ||
+      glyph.height > GLYPH_CACHE_MAX_HEIGHT)
+  {
+    return nullptr;
+  }
+  // Glyph records are 7 bytes apart, mix the pointer bits a little
+  uintptr_t key = (uintptr_t)&glyph;
+  CachedGlyph *set = entries[(key ^ (key >> 5)) % GLYPH_CACHE_SETS];
+  tick++;
+
+  CachedGlyph *victim = &set[0];
+  for (int way = 0; way < GLYPH_CACHE_WAYS; way++)
+  {
+    if (set[way].glyph == &glyph)
+    {
+      set[way].used = tick;
+      hits++;
+      return &set[way];
+    }
+    if (set[way].used < victim->used)
+    {
+      victim = &set[way];
+    }
+  }
+  misses++;
+  victim->glyph = &glyph;
+  victim->used = tick;
+  unpackGlyph(font, glyph, &victim->rows[0][0], GLYPH_CACHE_ROW_BYTES);
+  return victim;
+} // end get
+
+/* Blits the rows of a bitmap of rowBytes wide rows whose top left corner is
+ * at x, y, clipped to the band.
+ */
+static void blitRows(BandBuffer &band, int16_t x, int16_t y,
+                     const uint8_t *rows, int16_t rowBytes, int16_t w,
+                     int16_t h, bool inverted, ink_t ink)
+{
+  int16_t first = band.top() > y ? band.top() - y : 0;
+  int16_t last = band.top() + band.rows() - y;
+  if (last > h)
+  {
+    last = h;
+  }
+  for (int16_t row = first; row < last; row++)
+  {
+    band.blitRow(y + row - band.top(), x, rows + row * rowBytes, w, inverted,
+                 ink);
+  }
+}
+
+void blitGlyph(BandBuffer &band, GlyphCache &cache, const SparseFont &font,
+               const GFXglyph &glyph, int16_t x, int16_t y, ink_t ink)
+{
+  if (!glyph.width || !glyph.height)
+  {
+    return;
+  }
+  x += glyph.xOffset;
+  y += glyph.yOffset;
+  if (y >= band.top() + band.rows() || y + glyph.height <= band.top())
+  {
+    return;
+  }
+  const CachedGlyph *cached = cache.get(font, glyph);
+  if (cached)
+  {
+    blitRows(band, x, y, &cached->rows[0][0], GLYPH_CACHE_ROW_BYTES,
+             glyph.width, glyph.height, false, ink);
+    return;
+  }
+  int16_t rowBytes = (glyph.width + 7) / 8;
+  if (rowBytes > GLYPH_MAX_ROW_BYTES || glyph.height > GLYPH_MAX_HEIGHT)
+  {
+    return;
+  }
+  uint8_t rows[GLYPH_MAX_ROW_BYTES * GLYPH_MAX_HEIGHT];
+  unpackGlyph(font, glyph, rows, rowBytes);
+  blitRows(band, x, y, rows, rowBytes, glyph.width, glyph.height, false, ink);
+} // end blitGlyph
+
+void blitBitmap(BandBuffer &band, int16_t x, int16_t y,
+                const uint8_t *bitmap, int16_t w, int16_t h, bool inverted,
+                ink_t ink)
+{
+  blitRows(band, x, y, bitmap, (w + 7) / 8, w, h, inverted, ink);
+}
+
+void blitIcon(BandBuffer &band, int16_t x, int16_t y, const PackedIcon &icon,
+              ink_t ink)
+{
+  forEachIconRow(icon, band.top() - y, band.top() + band.rows() - y,
+                 [&](int16_t row, const uint8_t *bits) {
+                   blitBitmap(band, x, y + row, bits, icon.width, 1, true,
+                              ink);
+                 });
+}
@@ -0,0 +1,74 @@
+#ifndef BLITTER_H
+#define BLITTER_H
+
+#include <stdint.h>
+#include "band_buffer.h"
+#include "sparse_font.h"
+#include "packed_icon.h"
+
+/* Glyphs and icons copied into the planes of a BandBuffer a row at a time.
+ * Adafruit_GFX reads glyph bitmaps from flash bit by bit and writes every
+ * pixel on its own; here each row is shifted into place and merged with the
+ * planes a byte at a time.
+ *
+ * Glyph bitmaps are packed without row padding, so rows start at arbitrary
+ * bits. Recently used glyphs are kept unpacked into byte aligned rows in a
+ * small cache in DRAM, which also keeps the flash cache out of the inner
+ * loop. The cache is 4-way set associative with LRU replacement in each set.
+ *
+ * Icons are decoded from their packed stream one row at a time and each row
+ * is blitted as it comes, see packed_icon.h.
+ */
+
+#define GLYPH_CACHE_SETS       16
+#define GLYPH_CACHE_WAYS       4
+#define GLYPH_CACHE_ROW_BYTES  2    // glyphs up to 16 pixels wide ...
+#define GLYPH_CACHE_MAX_HEIGHT 24   // ... and 24 rows high are cached
+
+struct CachedGlyph {
+  const GFXglyph *glyph;    // nullptr for a free entry
+  uint32_t used;            // tick of the last use
+  uint8_t rows[GLYPH_CACHE_MAX_HEIGHT][GLYPH_CACHE_ROW_BYTES];
+};
+
+class GlyphCache {
+public:
+  /* Returns glyph unpacked into byte aligned rows, from the cache or
+   * unpacked into it. Returns nullptr if the glyph is too large to cache.
+   */
+  const CachedGlyph *get(const SparseFont &font, const GFXglyph &glyph);
+  void clear();
+
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+
+private:
+  CachedGlyph entries[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS] = {};
+  uint32_t tick = 0;
+};
+
+/* Unpacks the bitmap of glyph into height rows of rowBytes bytes each.
+ */
+void unpackGlyph(const SparseFont &font, const GFXglyph &glyph,
+                 uint8_t *rows, int16_t rowBytes);
+
+/* Draws glyph with its pen position at x and baseline at y, like
+ * Adafruit_GFX's drawChar() with a custom font.
+ */
+void blitGlyph(BandBuffer &band, GlyphCache &cache, const SparseFont &font,
+               const GFXglyph &glyph, int16_t x, int16_t y, ink_t ink);
+
+/* Draws a byte padded bitmap with its top left corner at x, y: the set bits,
+ * or the cleared ones if inverted as in GxEPD2's drawInvertedBitmap().
+ */
+void blitBitmap(BandBuffer &band, int16_t x, int16_t y,
+                const uint8_t *bitmap, int16_t w, int16_t h, bool inverted,
+                ink_t ink);
+
+/* Draws the cleared bits of icon with its top left corner at x, y, decoding
+ * only as far as the last row inside the band.
+ */
+void blitIcon(BandBuffer &band, int16_t x, int16_t y, const PackedIcon &icon,
+              ink_t ink);
+
+#endif // BLITTER_H
@@ -0,0 +1,64 @@
+#ifndef CALENDAR_DATE_H
+#define CALENDAR_DATE_H
+
+#include <stdint.h>
+
+/* Dates as days since 1970-01-01 in the proleptic Gregorian calendar, so
+ * that grid days and day numbers come out right across month and year ends
+ * for any number of weeks shown. Whole days only: no time zone or DST is
+ * involved, unlike with mktime().
+ */
+
+constexpr int32_t daysFromCivil(int year, int month, int day)
+{
+  year -= month <= 2;
+  const int32_t era = (year >= 0 ? year : year - 399) / 400;
+  const int32_t yearOfEra = year - era * 400;
+  const int32_t dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5
+                          + day - 1;
+  const int32_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100
+                         + dayOfYear;
+  return era * 146097 + dayOfEra - 719468;
+}
+
+// Day of the month, 1 to 31, of days since 1970-01-01
+constexpr int dayOfMonth(int32_t days)
+{
+  days += 719468;
+  const int32_t era = (days >= 0 ? days : days - 146096) / 146097;
+  const int32_t dayOfEra = days - era * 146097;
+  const int32_t yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524
+                             - dayOfEra / 146096) / 365;
+  const int32_t dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4
+                                        - yearOfEra / 100);
+  const int32_t monthFromMarch = (5 * dayOfYear + 2) / 153;
+  return dayOfYear - (153 * monthFromMarch + 2) / 5 + 1;
+}
+
+// Value of count decimal digits at text, stopping at the first non-digit
+constexpr int parseDigits(const char *text, int count)
+{
+  int value = 0;
+  for (int i = 0; i < count && text[i] >= '0' && text[i] <= '9'; i++)
+  {
+    value = value * 10 + (text[i] - '0');
+  }
+  return value;
+}
+
+// Days since 1970-01-01 of a date starting "YYYY-MM-DD", as Home Assistant
+// sends dates and the start of date-times; 0 for anything shorter
+constexpr int32_t parseDateDays(const char *date)
+{
+  for (int i = 0; i < 10; i++)
+  {
+    if (!date[i])
+    {
+      return 0;
+    }
+  }
+  return daysFromCivil(parseDigits(date, 4), parseDigits(date + 5, 2),
+                       parseDigits(date + 8, 2));
+}
+
+#endif // CALENDAR_DATE_H
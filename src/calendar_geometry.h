@@ -0,0 +1,37 @@
+#ifndef CALENDAR_GEOMETRY_H
+#define CALENDAR_GEOMETRY_H
+
+/* Compile time description of the calendar grid. The layout and drawing code
+ * is templated on it, so every cell position below folds into constants and
+ * loops over weeks and columns have constant bounds.
+ *
+ * Grid days are 1-based and numbered row by row from the first cell; a row
+ * is one week.
+ */
+template <int Weeks, int Width, int Height, int HeaderHeight>
+struct CalendarGeometry {
+  static_assert(Weeks >= 1 && Weeks <= 6, "calendar shows 1 to 6 weeks");
+  static_assert(Height > HeaderHeight, "no room below the header");
+
+  static constexpr int weeks = Weeks;
+  static constexpr int columns = 7;                     // days per week
+  static constexpr int days = weeks * columns;
+  static constexpr int width = Width;
+  static constexpr int headerHeight = HeaderHeight;
+  static constexpr int dayWidth = Width / columns;
+  static constexpr int rowHeight = (Height - HeaderHeight) / weeks;
+
+  static constexpr bool contains(int day) { return day >= 1 && day <= days; }
+  static constexpr int week(int day) { return (day - 1) / columns; }
+  static constexpr int column(int day) { return (day - 1) % columns; }
+  static constexpr int day(int week, int column)
+  {
+    return week * columns + column + 1;
+  }
+
+  // Top left corner of a cell
+  static constexpr int cellX(int column) { return column * dayWidth; }
+  static constexpr int cellY(int week) { return headerHeight + week * rowHeight; }
+};
+
+#endif // CALENDAR_GEOMETRY_H
@@ -0,0 +1,144 @@
+#include "calendar_layout.h"
+
+// Radix digits used to sort single-day events by start minute. A key is at
+// most 1 + 23 * 60 + 59 = 1440, so two 6-bit digits cover it.
+#define MINUTE_DIGIT_BITS 6
+#define MINUTE_DIGIT_SIZE (1 << MINUTE_DIGIT_BITS)
+#define MAX_MULTI_DAY_ROWS 32
+
+/* Returns the sort key for an "HH:MM" time string: minutes since midnight
+ * plus one, or 0 for full-day ("-") and malformed times.
+ */
+uint16_t parseStartMinute(const char *time)
+{
+  if (time == nullptr
+   || time[0] < '0' || time[0] > '9' || time[1] < '0' || time[1] > '9'
+   || time[2] != ':'
+   || time[3] < '0' || time[3] > '9' || time[4] < '0' || time[4] > '9')
+  {
+    return 0;
+  }
+  int hours = (time[0] - '0') * 10 + (time[1] - '0');
+  int minutes = (time[3] - '0') * 10 + (time[4] - '0');
+  if (hours > 23 || minutes > 59)
+  {
+    return 0;
+  }
+  return 1 + hours * 60 + minutes;
+} // end parseStartMinute
+
+/* One stable counting-sort pass of src into dst, bucketed by digit(index).
+ * counts must hold numBuckets + 1 entries; on return counts[b] is the start
+ * offset of bucket b in dst and counts[numBuckets] the total.
+ */
+template <typename DigitFn>
+static void countingSortPass(const std::vector<uint16_t> &src,
+                             std::vector<uint16_t> &dst,
+                             std::vector<uint16_t> &counts, int numBuckets,
+                             DigitFn digit)
+{
+  counts.assign(numBuckets + 1, 0);
+  for (uint16_t index : src)
+  {
+    ++counts[digit(index) + 1];
+  }
+  for (int b = 0; b < numBuckets; b++)
+  {
+    counts[b + 1] += counts[b];
+  }
+  std::vector<uint16_t> next(counts.begin(), counts.end() - 1);
+  dst.resize(src.size());
+  for (uint16_t index : src)
+  {
+    dst[next[digit(index)]++] = index;
+  }
+} // end countingSortPass
+
+/* Assigns a stacking row to every multi-day event, buckets single-day events
+ * per grid day ordered by start time, and records how many multi-day rows
+ * are stacked on each day.
+ *
+ * Multi-day events are placed in order of start day (then input order) into
+ * the lowest row that is free on every day they span, which matches the
+ * previous row search but uses one occupancy bitmask per day instead of
+ * rescanning all events. Events starting outside 1..numDays keep row -1.
+ */
+void buildCalendarLayout(const std::vector<LayoutEvent> &events, int numDays,
+                         CalendarLayout &layout)
+{
+  const int numEvents = events.size();
+  layout.multiDayRows.assign(numEvents, -1);
+  layout.multiDayDepth.assign(numDays + 1, 0);
+
+  std::vector<uint16_t> multiDay;
+  std::vector<uint16_t> singleDay;
+  for (int i = 0; i < numEvents; i++)
+  {
+    const LayoutEvent &event = events[i];
+    if (event.startDay < 1 || event.startDay > numDays)
+    {
+      continue;
+    }
+    if (event.isMultiDay)
+    {
+      multiDay.push_back(i);
+    }
+    else
+    {
+      singleDay.push_back(i);
+    }
+  }
+
+  // Multi-day rows, processed by start day
+  std::vector<uint16_t> counts;
+  std::vector<uint16_t> byStart;
+  countingSortPass(multiDay, byStart, counts, numDays + 1,
+                   [&](uint16_t i) { return events[i].startDay; });
+
+  std::vector<uint32_t> dayRows(numDays + 1, 0);
+  for (uint16_t i : byStart)
+  {
+    const int first = events[i].startDay;
+    const int last = events[i].endDay < numDays ? events[i].endDay : numDays;
+    uint32_t occupied = 0;
+    for (int day = first; day <= last; day++)
+    {
+      occupied |= dayRows[day];
+    }
+    int row = 0;
+    while (row < MAX_MULTI_DAY_ROWS - 1 && (occupied & (1UL << row)))
+    {
+      row++;
+    }
+    layout.multiDayRows[i] = row;
+    for (int day = first; day <= last; day++)
+    {
+      dayRows[day] |= 1UL << row;
+    }
+  }
+
+  for (int day = 1; day <= numDays; day++)
+  {
+    uint8_t depth = 0;
+    for (uint32_t rows = dayRows[day]; rows != 0; rows >>= 1)
+    {
+      depth++;
+    }
+    layout.multiDayDepth[day] = depth;
+  }
+
+  // Single-day events: LSD radix sort on (day, start minute). Each pass is
+  // stable, so events with equal start times keep their input order.
+  std::vector<uint16_t> sorted;
+  countingSortPass(singleDay, sorted, counts, MINUTE_DIGIT_SIZE,
+                   [&](uint16_t i) {
+                     return events[i].startMinute & (MINUTE_DIGIT_SIZE - 1);
+                   });
+  countingSortPass(sorted, singleDay, counts, MINUTE_DIGIT_SIZE,
+                   [&](uint16_t i) {
+                     return events[i].startMinute >> MINUTE_DIGIT_BITS;
+                   });
+  countingSortPass(singleDay, layout.singleDayOrder, counts, numDays + 2,
+                   [&](uint16_t i) { return events[i].startDay; });
+  layout.dayOffsets.assign(counts.begin(), counts.end() - 1);
+} // end buildCalendarLayout
@@ -0,0 +1,51 @@
+#ifndef CALENDAR_LAYOUT_H
+#define CALENDAR_LAYOUT_H
+
+#include <stdint.h>
+#include <vector>
+
+// Minimal view of a CalendarEvent used by the layout pass. It carries no
+// Arduino types so the layout code can also be built for native tests.
+struct LayoutEvent {
+  int16_t startDay;      // 1-based grid day
+  int16_t endDay;        // 1-based grid day (inclusive)
+  uint16_t startMinute;  // sort key from parseStartMinute()
+  bool isMultiDay;
+};
+
+// Result of one pass over all events: multi-day row assignment, per-day
+// multi-day stacking depth and single-day events bucketed per day.
+struct CalendarLayout {
+  std::vector<int8_t> multiDayRows;      // per event, -1 if not assigned
+  std::vector<uint8_t> multiDayDepth;    // per grid day, index 0 unused
+  std::vector<uint16_t> dayOffsets;      // per grid day, index into singleDayOrder
+  std::vector<uint16_t> singleDayOrder;  // event indices sorted by (day, start)
+
+  int singleDayCount(int day) const
+  {
+    return dayOffsets[day + 1] - dayOffsets[day];
+  }
+  const uint16_t *singleDayEvents(int day) const
+  {
+    return singleDayOrder.data() + dayOffsets[day];
+  }
+};
+
+// Sort key for an "HH:MM" start time. Full-day events ("-") and anything
+// unparsable map to 0 so they sort before 00:00.
+uint16_t parseStartMinute(const char *time);
+
+// Lays out numDays grid days in O(n + numDays), plus the days covered by
+// each multi-day event.
+void buildCalendarLayout(const std::vector<LayoutEvent> &events, int numDays,
+                         CalendarLayout &layout);
+
+// Lays out every day of a CalendarGeometry
+template <class View>
+void buildCalendarLayout(const std::vector<LayoutEvent> &events,
+                         CalendarLayout &layout)
+{
+  buildCalendarLayout(events, View::days, layout);
+}
+
+#endif // CALENDAR_LAYOUT_H
@@ -0,0 +1,497 @@
+#include "calendar_view.h"
+#include "battery.h"
+#include "icons.h"
+#include "calendar_layout.h"
+#include "calendar_date.h"
+#include "text_layout.h"
+#include "static_chrome.h"
+#include "frame_hash.h"
+#include <algorithm>
+#include <cmath>
+
+// Most lines drawMultiLnString() wraps text into
+#define MAX_WRAPPED_LINES 4
+
+// Bottom right of the frame, kept free of cell content for the status bar
+static const DisplayRect STATUS_BAR_STRIP = {STATUS_BAR_LEFT, STATUS_BAR_TOP,
+                                             DISP_WIDTH, DISP_HEIGHT};
+// What drawStatusBar() drew, none on error screens
+static DisplayRect statusBarBounds = {0, 0, 0, 0};
+
+// ============================================================================
+// Text Rendering Helper Functions
+// ============================================================================
+
+/* Records the first length characters of text, plus an ellipsis if asked
+ * for, with the baseline starting at x, y.
+ */
+static void drawTextRun(DisplayList &dl, int16_t x, int16_t y,
+                        const char *text, uint16_t length, bool ellipsis,
+                        font_t font, uint16_t color)
+{
+  if (length == 0 && !ellipsis)
+  {
+    return;
+  }
+  int16_t width = getTextWidth(text, length, font);
+  if (ellipsis)
+  {
+    width += getEllipsisWidth(font);
+  }
+  dl.text(x, y, text, length, ellipsis ? TEXT_ELLIPSIS : "", font, color,
+          getTextBox(x, y, width, font));
+}
+
+/* Records text with its baseline starting at x, y.
+ */
+static void drawText(DisplayList &dl, int16_t x, int16_t y, const String &text,
+                     font_t font, uint16_t color)
+{
+  drawTextRun(dl, x, y, text.c_str(), text.length(), false, font, color);
+}
+
+/* Returns the width of a string in pixels in the given font.
+ */
+uint16_t getStringWidth(const String &text, font_t font)
+{
+  return getTextWidth(text.c_str(), text.length(), font);
+}
+
+/* Draws a string with specified alignment (LEFT, CENTER, RIGHT).
+ */
+void drawString(DisplayList &dl, int16_t x, int16_t y, const String &text,
+                alignment_t alignment, font_t font, uint16_t color)
+{
+  uint16_t w = getStringWidth(text, font);
+  if (alignment == RIGHT)
+  {
+    x = x - w;
+  }
+  if (alignment == CENTER)
+  {
+    x = x - w / 2;
+  }
+  drawText(dl, x, y, text, font, color);
+}
+
+/* Draws multi-line string with intelligent word wrapping.
+ */
+void drawMultiLnString(DisplayList &dl, int16_t x, int16_t y,
+                       const String &text, alignment_t alignment,
+                       font_t font, uint16_t max_width,
+                       uint16_t max_lines, int16_t line_spacing,
+                       uint16_t color)
+{
+  TextLine lines[MAX_WRAPPED_LINES];
+  uint16_t count = wrapText(text.c_str(), font, max_width,
+                            std::min<uint16_t>(max_lines, MAX_WRAPPED_LINES),
+                            lines);
+  for (uint16_t i = 0; i < count; i++)
+  {
+    const TextLine &line = lines[i];
+    const char *start = text.c_str() + line.start;
+    int16_t w = getTextWidth(start, line.length, font);
+    if (line.ellipsis)
+    {
+      w += getEllipsisWidth(font);
+    }
+    int16_t lineX = x;
+    if (alignment == RIGHT)
+    {
+      lineX = x - w;
+    }
+    if (alignment == CENTER)
+    {
+      lineX = x - w / 2;
+    }
+    drawTextRun(dl, lineX, y + i * line_spacing, start, line.length,
+                line.ellipsis, font, color);
+  }
+  return;
+} // end drawMultiLnString
+
+// ============================================================================
+// Icon/Bitmap Helper Functions
+// ============================================================================
+
+/* Returns 24x24 bitmap incidcating battery status.
+ */
+const PackedIcon &getBatBitmap24(uint32_t batPercent)
+{
+  if (batPercent >= 93)
+  {
+    return battery_full_90deg_24x24;
+  }
+  else if (batPercent >= 79)
+  {
+    return battery_6_bar_90deg_24x24;
+  }
+  else if (batPercent >= 65)
+  {
+    return battery_5_bar_90deg_24x24;
+  }
+  else if (batPercent >= 50)
+  {
+    return battery_4_bar_90deg_24x24;
+  }
+  else if (batPercent >= 36)
+  {
+    return battery_3_bar_90deg_24x24;
+  }
+  else if (batPercent >= 22)
+  {
+    return battery_2_bar_90deg_24x24;
+  }
+  else if (batPercent >= 8)
+  {
+    return battery_1_bar_90deg_24x24;
+  }
+  else
+  {  // batPercent < 8
+    return battery_0_bar_90deg_24x24;
+  }
+} // end getBatBitmap24
+
+/* Returns appropriate WiFi icon based on signal strength.
+ */
+const PackedIcon &getWiFiBitmap16(int rssi)
+{
+  if (rssi == 0)
+    return wifi_x_16x16;
+  else if (rssi >= -50)
+    return wifi_16x16;
+  else if (rssi >= -60)
+    return wifi_3_bar_16x16;
+  else if (rssi >= -70)
+    return wifi_2_bar_16x16;
+  else
+    return wifi_1_bar_16x16;
+}
+
+/* Returns WiFi signal quality description.
+ */
+const char *getWiFidesc(int rssi)
+{
+  if (rssi == 0)
+    return TXT_WIFI_NO_CONNECTION;
+  else if (rssi >= -50)
+    return TXT_WIFI_EXCELLENT;
+  else if (rssi >= -60)
+    return TXT_WIFI_GOOD;
+  else if (rssi >= -70)
+    return TXT_WIFI_FAIR;
+  else
+    return TXT_WIFI_POOR;
+}
+
+// ============================================================================
+// Calendar Drawing Functions
+// ============================================================================
+
+/* Returns the grid day of a date (YYYY-MM-DD), 1 for weekStart.
+ */
+int calculateGridPosition(String date, String weekStart)
+{
+  return parseDateDays(date.c_str()) - parseDateDays(weekStart.c_str()) + 1;
+}
+
+/* Returns the day of the month shown in a cell of the grid.
+ */
+int calculateCalendarDay(String weekStart, int weekNumber, int dayInWeek)
+{
+  return dayOfMonth(parseDateDays(weekStart.c_str()) + weekNumber * 7
+                    + dayInWeek);
+}
+
+void drawRoundedRect(DisplayList &dl, int x, int y, int width, int height, int radius, uint16_t color) {
+  dl.fillRoundRect(x, y, width, height, radius, color);
+}
+
+void drawSingleDayEvent(DisplayList &dl, int x, int y, int width, int height, String startTime, String endTime, String title, uint16_t color, bool singleLineMode) {
+  drawRoundedRect(dl, x, y, width, height, EVENT_BORDER_RADIUS, color);
+
+  // Display time range on first line
+  drawText(dl, x + EVENT_TEXT_MARGIN, y + TIME_TEXT_Y_OFFSET,
+           startTime + "-" + endTime, FONT_SMALL, GxEPD_WHITE);
+
+  // Display title, wrapped to the box width. Single-line mode is used for
+  // the reduced height event shown before the overflow text.
+  drawMultiLnString(dl, x + EVENT_TEXT_MARGIN, y + TITLE_FIRST_LINE_Y_OFFSET,
+                    title, LEFT, FONT_LARGE, width - 2 * EVENT_TEXT_MARGIN,
+                    singleLineMode ? 1 : 2,
+                    TITLE_SECOND_LINE_Y_OFFSET - TITLE_FIRST_LINE_Y_OFFSET,
+                    GxEPD_WHITE);
+}
+
+void drawMultiDayEvent(DisplayList &dl, int x, int y, int width, int height, String title, bool isStart, bool isEnd, uint16_t color) {
+  // Rounded only where the event starts and ends, segments continuing into
+  // the next or from the previous week have square ends
+  uint8_t corners = (isStart ? CORNERS_LEFT : 0) | (isEnd ? CORNERS_RIGHT : 0);
+  if (corners) {
+    dl.fillRoundRect(x, y, width, height, EVENT_BORDER_RADIUS, color, corners);
+  } else {
+    dl.fillRect(x, y, width, height, color);
+  }
+
+  // Title is cut with an ellipsis where the box ends
+  drawMultiLnString(dl, x + EVENT_TEXT_MARGIN, y + 19, title, LEFT, FONT_LARGE,
+                    width - 2 * EVENT_TEXT_MARGIN, 1, 0, GxEPD_WHITE);
+}
+
+/* Lays out the calendar grid described by View, see calendar_geometry.h.
+ */
+template <class View>
+static void drawCalendarView(DisplayList &dl, const std::vector<CalendarEvent>& events, String currentDate, String weekStart) {
+
+  // Calculate current day grid position relative to week start
+  int currentDayNumber = calculateGridPosition(currentDate, weekStart);
+
+    // Weekday headers, header line and week separator come pre-rendered,
+    // only the current weekday is drawn again on top in red
+    dl.setBackground(&getCalendarChrome());
+
+    const char* weekdays[] = {TXT_MONDAY, TXT_TUESDAY, TXT_WEDNESDAY, TXT_THURSDAY, TXT_FRIDAY, TXT_SATURDAY, TXT_SUNDAY};
+    int currentWeekday = View::column(currentDayNumber); // Convert day number to weekday index
+
+    if (View::contains(currentDayNumber)) {
+      // Same position as in the chrome so the red glyphs cover the black ones
+      int textWidth = getTextWidth(weekdays[currentWeekday], FONT_LARGE);
+      int centerX = View::cellX(currentWeekday) + (View::dayWidth - textWidth) / 2;
+      drawText(dl, centerX, View::headerHeight - HEADER_TEXT_Y_OFFSET,
+               weekdays[currentWeekday], FONT_LARGE, GxEPD_RED);
+    }
+
+    // STEP 1: Lay out all events in one pass: multi-day rows, per-day
+    // multi-day depth and single-day events bucketed per day by start time
+    std::vector<LayoutEvent> layoutEvents;
+    layoutEvents.reserve(events.size());
+    for (const CalendarEvent &event : events) {
+      layoutEvents.push_back({(int16_t)event.startDay, (int16_t)event.endDay,
+                              parseStartMinute(event.startTime.c_str()),
+                              event.isMultiDay});
+    }
+    CalendarLayout layout;
+    buildCalendarLayout<View>(layoutEvents, layout);
+    const std::vector<int8_t> &eventRows = layout.multiDayRows;
+
+    // STEP 2: Draw multi-day events as continuous boxes, one segment per
+    // week they cover in the view, the title only on the first one
+    for (int i = 0; i < events.size(); i++) {
+      if (events[i].isMultiDay && View::contains(events[i].startDay)) {
+        int endDay = events[i].endDay;
+        int lastDay = min(endDay, View::days);
+        uint16_t eventColor = (currentDayNumber >= events[i].startDay && currentDayNumber <= events[i].endDay) ? GxEPD_RED : GxEPD_BLACK;
+
+        for (int day = events[i].startDay; day <= lastDay; ) {
+          int column = View::column(day);
+          int daysInWeek = min(lastDay - day + 1, View::columns - column);
+
+          int x = View::cellX(column) + EVENT_MARGIN;
+          int y = View::cellY(View::week(day)) + DAY_NUMBER_MARGIN + (eventRows[i] * MULTI_DAY_EVENT_SPACING);
+          int eventWidth = (daysInWeek * View::dayWidth) - (2 * EVENT_MARGIN);
+
+          bool isStart = (day == events[i].startDay);
+          bool isEnd = (endDay <= day + daysInWeek - 1);
+          drawMultiDayEvent(dl, x, y, eventWidth, MULTI_DAY_EVENT_HEIGHT, isStart ? events[i].title : "", isStart, isEnd, eventColor);
+
+          day += daysInWeek;
+        }
+      }
+    }
+
+    // STEP 3: Draw day numbers and single-day events
+    for (int week = 0; week < View::weeks; week++) {
+      int y = View::cellY(week);
+
+      for (int day = 0; day < View::columns; day++) {
+        int x = View::cellX(day);
+        int dayNumber = calculateCalendarDay(weekStart, week, day);
+
+        // Calculate the relative day number for event comparison
+        int relativeDayNumber = View::day(week, day);
+
+        // Draw day number with red background box if current day
+        uint16_t dayNumberColor = GxEPD_BLACK;
+        if (relativeDayNumber == currentDayNumber) {
+          // Draw red background box for current day
+          dl.fillRoundRect(x + CURRENT_DAY_BOX_X_OFFSET, y + CURRENT_DAY_BOX_Y_OFFSET,
+                           CURRENT_DAY_BOX_WIDTH, CURRENT_DAY_BOX_HEIGHT, EVENT_BORDER_RADIUS, GxEPD_RED);
+          dayNumberColor = GxEPD_WHITE;
+        }
+        drawText(dl, x + DAY_NUMBER_X_OFFSET, y + DAY_NUMBER_Y_OFFSET,
+                 String(dayNumber), FONT_LARGE, dayNumberColor);
+
+        // Multi-day rows stacked on this day, single-day events sorted by time
+        int multiDayCount = layout.multiDayDepth[relativeDayNumber];
+        const uint16_t *singleDayEventIndices = layout.singleDayEvents(relativeDayNumber);
+        int singleDayEventCount = layout.singleDayCount(relativeDayNumber);
+
+        // Calculate available space for single-day events
+        int dayNumberMargin = 25; // Increased to 25px for better spacing
+        int availableHeight = View::rowHeight - dayNumberMargin - (multiDayCount * 30)
+                            - stripRows<View>(STATUS_BAR_STRIP, week, day);
+
+        // Draw single-day events starting after all multi-day events
+        int eventY = y + dayNumberMargin + (multiDayCount * 30);
+        int singleDayEventsDrawn = 0;
+
+        // Calculate how many events we can actually show
+        // Simple approach: calculate how many full events fit, then check if we can add one reduced
+        int maxFullEvents = availableHeight / SINGLE_DAY_EVENT_SPACING;
+        int eventsToShow;
+
+        if (singleDayEventCount <= maxFullEvents) {
+          // All events fit with full height
+          eventsToShow = singleDayEventCount;
+        } else {
+          // Not all events fit - check if we can show maxFullEvents-1 full + 1 reduced + overflow
+          int spaceForReduced = ((maxFullEvents - 1) * SINGLE_DAY_EVENT_SPACING) +
+                               (SINGLE_DAY_EVENT_HEIGHT_REDUCED + 2) +
+                               OVERFLOW_TEXT_SPACING;
+
+          if (spaceForReduced <= availableHeight && maxFullEvents > 0) {
+            // We can fit maxFullEvents-1 full + 1 reduced + overflow text
+            eventsToShow = maxFullEvents;
+          } else {
+            // Show maxFullEvents-1 full events + overflow (no reduced event)
+            eventsToShow = max(1, maxFullEvents - 1);
+          }
+        }
+
+        for (int i = 0; i < eventsToShow; i++) {
+          int eventWidth = View::dayWidth - (2 * EVENT_MARGIN);
+          int eventX = x + EVENT_MARGIN;
+          int eventIndex = singleDayEventIndices[i];
+
+          // Determine if this is the last event and there's overflow
+          bool isLastEventWithOverflow = (i == eventsToShow - 1 && singleDayEventCount > eventsToShow);
+          bool singleLineMode = isLastEventWithOverflow;
+          int eventHeight = isLastEventWithOverflow ? SINGLE_DAY_EVENT_HEIGHT_REDUCED : SINGLE_DAY_EVENT_HEIGHT;
+
+          uint16_t singleEventColor = (relativeDayNumber == currentDayNumber) ? GxEPD_RED : GxEPD_BLACK;
+          drawSingleDayEvent(dl, eventX, eventY, eventWidth, eventHeight,
+                            events[eventIndex].startTime, events[eventIndex].endTime, events[eventIndex].title, singleEventColor, singleLineMode);
+
+          if (isLastEventWithOverflow) {
+            // For reduced height event, use smaller spacing
+            eventY += SINGLE_DAY_EVENT_HEIGHT_REDUCED + 2; // 2px margin
+          } else {
+            eventY += SINGLE_DAY_EVENT_SPACING;
+          }
+          singleDayEventsDrawn++;
+        }
+
+        // Show overflow indicator if there are more events than we could display
+        if (singleDayEventCount > eventsToShow) {
+          int remainingEvents = singleDayEventCount - eventsToShow;
+          drawText(dl, x + EVENT_MARGIN, eventY + OVERFLOW_TEXT_Y_OFFSET,
+                   String(remainingEvents) + " more events...", FONT_SMALL,
+                   GxEPD_BLACK);
+        }
+      }
+    }
+}
+
+void drawCalendar(DisplayList &dl, const std::vector<CalendarEvent>& events, String currentDate, String currentDay, String currentTime, String weekStart) {
+  drawCalendarView<CalendarView>(dl, events, currentDate, weekStart);
+}
+
+/* This function is responsible for drawing the status bar along the bottom of
+ * the display.
+ */
+void drawStatusBar(DisplayList &dl, const String &refreshTimeStr,
+                   int rssi, uint32_t batVoltage)
+{
+  String dataStr;
+  uint16_t dataColor = GxEPD_BLACK;
+  int pos = DISP_WIDTH - 2;
+  const int sp = 2;
+  const size_t first = dl.size();
+
+#if BATTERY_MONITORING
+  // battery - BATTERY_PROFILE in config.h
+  uint32_t batPercent = batteryPercent(batVoltage);
+  if (batVoltage < WARN_BATTERY_VOLTAGE)
+  {
+    dataColor = ACCENT_COLOR;
+  }
+  dataStr = String(batPercent) + "%";
+  dataStr += " (" + String( std::round(batVoltage / 10.f) / 100.f, 2 ) + "v)";
+  drawString(dl, pos, DISP_HEIGHT - 1 - 2, dataStr, RIGHT, FONT_SMALL, dataColor);
+  pos -= getStringWidth(dataStr, FONT_SMALL) + 25;
+  dl.icon(pos, DISP_HEIGHT - 1 - 17, getBatBitmap24(batPercent), dataColor);
+  pos -= sp + 9;
+#endif
+
+  // WiFi
+  dataStr = String(getWiFidesc(rssi));
+  dataColor = rssi >= -70 ? GxEPD_BLACK : ACCENT_COLOR;
+  if (rssi != 0)
+  {
+    dataStr += " (" + String(rssi) + "dBm)";
+  }
+  // Calculate positions: icon first, then text to its right
+  int wifiIconPos = pos - getStringWidth(dataStr, FONT_SMALL) - 19;
+  int wifiTextPos = wifiIconPos + 16 + 3; // icon width + small margin
+  dl.icon(wifiIconPos, DISP_HEIGHT - 1 - 13, getWiFiBitmap16(rssi), dataColor);
+  drawString(dl, wifiTextPos, DISP_HEIGHT - 1 - 2, dataStr, LEFT, FONT_SMALL, dataColor);
+  pos = wifiIconPos - sp;
+
+  // last refresh
+  dataColor = GxEPD_BLACK;
+  drawString(dl, pos, DISP_HEIGHT - 1 - 2, refreshTimeStr, RIGHT, FONT_SMALL, dataColor);
+  pos -= getStringWidth(refreshTimeStr, FONT_SMALL) + 25;
+  dl.icon(pos, DISP_HEIGHT - 1 - 21, wi_refresh_32x32, dataColor);
+  pos -= sp;
+
+  // The ink of all of it, hashed as its own region
+  statusBarBounds = {INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN};
+  for (size_t i = first; i < dl.size(); i++)
+  {
+    const DisplayRect &b = dl[i].bounds;
+    statusBarBounds = {std::min(statusBarBounds.x0, b.x0),
+                       std::min(statusBarBounds.y0, b.y0),
+                       std::max(statusBarBounds.x1, b.x1),
+                       std::max(statusBarBounds.y1, b.y1)};
+  }
+  return;
+} // end drawStatusBar
+
+
+/* This function is responsible for drawing prominent error messages to the
+ * screen.
+ *
+ * If error message line 2 (errMsgLn2) is empty, line 1 will be automatically
+ * wrapped.
+ */
+void drawError(DisplayList &dl, const PackedIcon &icon_196x196,
+               const String &errMsgLn1, const String &errMsgLn2)
+{
+  if (!errMsgLn2.isEmpty())
+  {
+    drawString(dl, DISP_WIDTH / 2,
+               DISP_HEIGHT / 2 + 196 / 2 + 21,
+               errMsgLn1, CENTER, FONT_LARGE);
+    drawString(dl, DISP_WIDTH / 2,
+               DISP_HEIGHT / 2 + 196 / 2 + 21 + 55,
+               errMsgLn2, CENTER, FONT_LARGE);
+  }
+  else
+  {
+    drawMultiLnString(dl, DISP_WIDTH / 2,
+                      DISP_HEIGHT / 2 + 196 / 2 + 21,
+                      errMsgLn1, CENTER, FONT_LARGE, DISP_WIDTH - 200, 2, 55);
+  }
+  dl.icon(DISP_WIDTH / 2 - 196 / 2, DISP_HEIGHT / 2 - 196 / 2 - 21,
+          icon_196x196, ACCENT_COLOR);
+  return;
+} // end drawError
+
+/* The status bar as last drawn, then the header and the cells of the
+ * calendar grid.
+ */
+uint8_t layoutRegions(DisplayRect *regions)
+{
+  return calendarRegions<CalendarView>(regions, statusBarBounds,
+                                       STATUS_BAR_STRIP);
+}
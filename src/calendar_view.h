@@ -0,0 +1,65 @@
+#ifndef CALENDAR_VIEW_H
+#define CALENDAR_VIEW_H
+
+#include <Arduino.h>
+#include <vector>
+#include "config.h"
+#include "panel_color.h"
+#include "display_list.h"
+#include "packed_icon.h"
+#include "calendar_geometry.h"
+
+/* The layout of a frame: the calendar, the status bar and the error screens,
+ * recorded into a display list, see display_list.h. None of it touches the
+ * panel, so it also builds natively with an Arduino String, which is how
+ * tools/framerender renders frames for thin clients.
+ */
+
+// Text alignment enum
+typedef enum alignment {
+  LEFT,
+  RIGHT,
+  CENTER
+} alignment_t;
+
+struct CalendarEvent {
+  String title;
+  int startDay;
+  int endDay;
+  String startTime;
+  String endTime;
+  String calendar;
+  bool isMultiDay;
+};
+
+// Calendar grid selected in config.h
+typedef CalendarGeometry<CALENDAR_WEEKS, CALENDAR_WIDTH, CALENDAR_HEIGHT,
+                         HEADER_HEIGHT> CalendarView;
+
+// Text rendering functions
+uint16_t getStringWidth(const String &text, font_t font);
+void drawString(DisplayList &dl, int16_t x, int16_t y, const String &text, alignment_t alignment, font_t font, uint16_t color=GxEPD_BLACK);
+void drawMultiLnString(DisplayList &dl, int16_t x, int16_t y, const String &text, alignment_t alignment, font_t font, uint16_t max_width, uint16_t max_lines, int16_t line_spacing, uint16_t color=GxEPD_BLACK);
+
+// Drawing functions, these record into a display list instead of drawing
+// directly so layout runs once per frame instead of once per page
+void drawRoundedRect(DisplayList &dl, int x, int y, int width, int height, int radius, uint16_t color);
+void drawSingleDayEvent(DisplayList &dl, int x, int y, int width, int height, String startTime, String endTime, String title, uint16_t color = GxEPD_BLACK, bool singleLineMode = false);
+void drawMultiDayEvent(DisplayList &dl, int x, int y, int width, int height, String title, bool isStart, bool isEnd, uint16_t color = GxEPD_BLACK);
+void drawCalendar(DisplayList &dl, const std::vector<CalendarEvent>& events, String currentDate, String currentDay, String currentTime, String weekStart);
+void drawStatusBar(DisplayList &dl, const String &refreshTimeStr, int rssi, uint32_t batVoltage);
+void drawError(DisplayList &dl, const PackedIcon &icon_196x196, const String &errMsgLn1, const String &errMsgLn2="");
+
+// Splits the frame last laid out into the regions hashed on their own, see
+// frame_hash.h. Returns their number.
+uint8_t layoutRegions(DisplayRect *regions);
+
+// Icon/bitmap helper functions
+const PackedIcon &getBatBitmap24(uint32_t batPercent);
+const PackedIcon &getWiFiBitmap16(int rssi);
+const char *getWiFidesc(int rssi);
+
+// Date calculation helper functions
+int calculateGridPosition(String date, String weekStart);
+
+#endif // CALENDAR_VIEW_H
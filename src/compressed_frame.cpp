@@ -0,0 +1,348 @@
+#include "compressed_frame.h"
+#include "fbops.h"
+#include "packbits.h"
+#include <string.h>
+
+static const uint8_t FRAME_FILE_MAGIC[4] = {'C', 'A', 'L', 'F'};
+static const uint8_t DELTA_FILE_MAGIC[4] = {'C', 'A', 'L', 'D'};
+
+void CompressedFrame::begin(int16_t width, int16_t height, uint8_t planes)
+{
+  clear();
+  frameWidth = width;
+  frameHeight = height;
+  planeCount = planes;
+  offsets.reserve(height * planes);
+}
+
+void CompressedFrame::clear()
+{
+  offsets.clear();
+  data.clear();
+  frameWidth = frameHeight = 0;
+  planeCount = 0;
+}
+
+void CompressedFrame::appendRow(const uint8_t *row)
+{
+  const size_t rowBytes = frameWidth / 8;
+  // Incompressible rows grow by one header byte per packet
+  const size_t worstCase = rowBytes + (rowBytes + PACKBITS_MAX_PACKET - 1) /
+                                          PACKBITS_MAX_PACKET;
+  size_t offset = data.size();
+  offsets.push_back(offset);
+  data.resize(offset + worstCase);
+  data.resize(offset + packbitsEncode(row, rowBytes, &data[offset]));
+}
+
+void CompressedFrame::appendBand(const BandBuffer &band)
+{
+  for (int16_t row = 0; row < band.rows(); row++)
+  {
+    const uint8_t *planes[] = {band.blackRow(row), band.redRow(row)};
+    for (uint8_t p = 0; p < planeCount; p++)
+    {
+      appendRow(planes[p]);
+    }
+  }
+}
+
+const uint8_t *CompressedFrame::packedRow(size_t index, size_t *size) const
+{
+  size_t end = index + 1 < offsets.size() ? offsets[index + 1] : data.size();
+  *size = end - offsets[index];
+  return &data[offsets[index]];
+}
+
+void CompressedFrame::decodeRow(int16_t y, uint8_t *row) const
+{
+  const size_t rowBytes = frameWidth / 8;
+  for (uint8_t p = 0; p < planeCount; p++)
+  {
+    packbitsDecode(&data[offsets[y * planeCount + p]], row + p * rowBytes,
+                   rowBytes);
+  }
+}
+
+void CompressedFrame::decodeBand(BandBuffer &band) const
+{
+  const size_t rowBytes = frameWidth / 8;
+  for (int16_t row = 0; row < band.rows(); row++)
+  {
+    size_t index = (band.top() + row) * planeCount;
+    packbitsDecode(&data[offsets[index]], band.blackRow(row), rowBytes);
+    if (planeCount == 2)
+    {
+      packbitsDecode(&data[offsets[index + 1]], band.redRow(row), rowBytes);
+    }
+  }
+}
+
+static void putHeader(std::vector<uint8_t> &file, const uint8_t *magic,
+                      uint8_t planes, int16_t width, int16_t height)
+{
+  file.insert(file.end(), magic, magic + 4);
+  file.push_back(FRAME_FILE_VERSION);
+  file.push_back(planes);
+  file.push_back(width & 0xFF);
+  file.push_back(width >> 8);
+  file.push_back(height & 0xFF);
+  file.push_back(height >> 8);
+}
+
+static void putU16(std::vector<uint8_t> &file, uint16_t value)
+{
+  file.push_back(value & 0xFF);
+  file.push_back(value >> 8);
+}
+
+void CompressedFrame::save(std::vector<uint8_t> &file) const
+{
+  putHeader(file, FRAME_FILE_MAGIC, planeCount, frameWidth, frameHeight);
+  file.insert(file.end(), data.begin(), data.end());
+}
+
+/* Size of the packed row of length bytes at in, 0 if it runs past end.
+ */
+static size_t packedRowSize(const uint8_t *in, const uint8_t *end,
+                            size_t length)
+{
+  const uint8_t *start = in;
+  size_t out = 0;
+  while (out < length)
+  {
+    if (in >= end)
+    {
+      return 0;
+    }
+    int8_t n = (int8_t)*in++;
+    if (n >= 0)
+    {
+      out += n + 1;
+      in += n + 1;
+    }
+    else if (n != -128)
+    {
+      out += 1 - n;
+      in++;
+    }
+  }
+  return in <= end ? in - start : 0;
+}
+
+bool CompressedFrame::load(const uint8_t *file, size_t length)
+{
+  clear();
+  if (length < FRAME_FILE_HEADER_SIZE ||
+      memcmp(file, FRAME_FILE_MAGIC, 4) != 0 ||
+      file[4] != FRAME_FILE_VERSION || file[5] < 1 || file[5] > 2)
+  {
+    return false;
+  }
+  int16_t width = file[6] | file[7] << 8;
+  int16_t height = file[8] | file[9] << 8;
+  if (width <= 0 || width % 8 || height <= 0)
+  {
+    return false;
+  }
+
+  begin(width, height, file[5]);
+  const uint8_t *rows = file + FRAME_FILE_HEADER_SIZE;
+  const uint8_t *end = file + length;
+  size_t offset = 0;
+  for (int32_t i = 0; i < (int32_t)height * planeCount; i++)
+  {
+    size_t size = packedRowSize(rows + offset, end, width / 8);
+    if (!size)
+    {
+      clear();
+      return false;
+    }
+    offsets.push_back(offset);
+    offset += size;
+  }
+  data.assign(rows, rows + offset);
+  return true;
+} // end load
+
+uint32_t CompressedFrame::id() const
+{
+  std::vector<uint8_t> row(frameWidth / 8 * planeCount);
+  uint32_t hash = FNV_OFFSET_BASIS;
+  for (int16_t y = 0; y < rows(); y++)
+  {
+    decodeRow(y, row.data());
+    hash = fbHash(hash, row.data(), row.size());
+  }
+  return hash;
+}
+
+bool CompressedFrame::samePacking(const CompressedFrame &other) const
+{
+  return frameWidth == other.frameWidth && frameHeight == other.frameHeight &&
+         planeCount == other.planeCount && offsets == other.offsets &&
+         data == other.data;
+}
+
+bool CompressedFrame::saveDelta(const CompressedFrame &base,
+                                std::vector<uint8_t> &file) const
+{
+  if (base.frameWidth != frameWidth || base.frameHeight != frameHeight ||
+      base.planeCount != planeCount || base.rows() != frameHeight ||
+      rows() != frameHeight)
+  {
+    return false;
+  }
+  const size_t rowBytes = frameWidth / 8;
+  const size_t frameRowBytes = rowBytes * planeCount;
+  std::vector<uint8_t> ours(frameRowBytes);
+  std::vector<uint8_t> theirs(frameRowBytes);
+  std::vector<uint8_t> packed(rowBytes + rowBytes / PACKBITS_MAX_PACKET + 1);
+
+  putHeader(file, DELTA_FILE_MAGIC, planeCount, frameWidth, frameHeight);
+  uint32_t baseId = base.id();
+  for (int shift = 0; shift < 32; shift += 8)
+  {
+    file.push_back(baseId >> shift);
+  }
+
+  // Offset of the counts of the open run of changed rows, 0 if none
+  size_t run = 0;
+  uint16_t equal = 0;
+  uint16_t changed = 0;
+  for (int16_t y = 0; y < frameHeight; y++)
+  {
+    // Rows packed the same are equal without decoding them
+    bool same = true;
+    for (uint8_t p = 0; p < planeCount && same; p++)
+    {
+      size_t a, b;
+      const uint8_t *rowA = packedRow(y * planeCount + p, &a);
+      const uint8_t *rowB = base.packedRow(y * planeCount + p, &b);
+      same = a == b && memcmp(rowA, rowB, a) == 0;
+    }
+    if (!same)
+    {
+      decodeRow(y, ours.data());
+      base.decodeRow(y, theirs.data());
+      // ours becomes the XOR of the rows
+      same = !fbXorDiff(ours.data(), ours.data(), theirs.data(),
+                        frameRowBytes);
+    }
+    if (same)
+    {
+      if (run)
+      {
+        file[run + 2] = changed & 0xFF;
+        file[run + 3] = changed >> 8;
+        run = 0;
+        equal = 0;
+      }
+      equal++;
+      continue;
+    }
+
+    if (!run)
+    {
+      run = file.size();
+      putU16(file, equal);
+      putU16(file, 0);
+      changed = 0;
+    }
+    for (uint8_t p = 0; p < planeCount; p++)
+    {
+      size_t size = packbitsEncode(&ours[p * rowBytes], rowBytes, packed.data());
+      file.insert(file.end(), packed.begin(), packed.begin() + size);
+    }
+    changed++;
+  }
+  if (run)
+  {
+    file[run + 2] = changed & 0xFF;
+    file[run + 3] = changed >> 8;
+  }
+  else if (equal)
+  {
+    // Trailing equal rows end the file as a run without changes
+    putU16(file, equal);
+    putU16(file, 0);
+  }
+  return true;
+} // end saveDelta
+
+bool CompressedFrame::loadDelta(const CompressedFrame &base,
+                                const uint8_t *file, size_t length)
+{
+  clear();
+  if (length < DELTA_FILE_HEADER_SIZE ||
+      memcmp(file, DELTA_FILE_MAGIC, 4) != 0 ||
+      file[4] != FRAME_FILE_VERSION || file[5] != base.planeCount ||
+      (file[6] | file[7] << 8) != base.frameWidth ||
+      (file[8] | file[9] << 8) != base.frameHeight ||
+      base.rows() != base.frameHeight)
+  {
+    return false;
+  }
+  uint32_t baseId = file[10] | file[11] << 8 | file[12] << 16 |
+                    (uint32_t)file[13] << 24;
+  if (baseId != base.id())
+  {
+    return false;
+  }
+
+  begin(base.frameWidth, base.frameHeight, base.planeCount);
+  const size_t rowBytes = frameWidth / 8;
+  std::vector<uint8_t> row(rowBytes);
+  std::vector<uint8_t> delta(rowBytes);
+  const uint8_t *in = file + DELTA_FILE_HEADER_SIZE;
+  const uint8_t *end = file + length;
+  int32_t y = 0;
+  while (y < frameHeight)
+  {
+    if (end - in < 4)
+    {
+      clear();
+      return false;
+    }
+    int32_t equal = in[0] | in[1] << 8;
+    int32_t changed = in[2] | in[3] << 8;
+    in += 4;
+    if ((!equal && !changed) || y + equal + changed > frameHeight)
+    {
+      clear();
+      return false;
+    }
+
+    // Equal rows are copied as they are packed
+    size_t from = base.offsets[y * planeCount];
+    size_t to = y + equal < frameHeight
+                    ? base.offsets[(y + equal) * planeCount]
+                    : base.data.size();
+    for (size_t i = 0; i < (size_t)equal * planeCount; i++)
+    {
+      offsets.push_back(data.size() + base.offsets[y * planeCount + i] - from);
+    }
+    data.insert(data.end(), base.data.begin() + from, base.data.begin() + to);
+    y += equal;
+
+    for (int32_t last = y + changed; y < last; y++)
+    {
+      for (uint8_t p = 0; p < planeCount; p++)
+      {
+        size_t size = packedRowSize(in, end, rowBytes);
+        if (!size)
+        {
+          clear();
+          return false;
+        }
+        packbitsDecode(in, delta.data(), rowBytes);
+        packbitsDecode(&base.data[base.offsets[y * planeCount + p]],
+                       row.data(), rowBytes);
+        fbXorDiff(row.data(), row.data(), delta.data(), rowBytes);
+        appendRow(row.data());
+        in += size;
+      }
+    }
+  }
+  return true;
+} // end loadDelta
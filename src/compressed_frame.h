@@ -0,0 +1,110 @@
+#ifndef COMPRESSED_FRAME_H
+#define COMPRESSED_FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "band_buffer.h"
+
+/* A whole one or two-plane frame kept in memory with every row of each plane
+ * PackBits compressed. Calendar frames are mostly white with a little red,
+ * so an 800x480 frame shrinks from 96000 bytes to a few kilobytes and is
+ * rendered in a single pass even when the heap has no contiguous block for
+ * the raw frame.
+ *
+ * Bands are rendered into a small BandBuffer and appended top to bottom.
+ * For the transfer to the panel each band is decoded into the same buffer
+ * again right before it is written.
+ *
+ * In thin-client mode the frame is rendered off-device and downloaded as a
+ * frame file, little endian:
+ *   4 bytes   "CALF"
+ *   1 byte    FRAME_FILE_VERSION
+ *   1 byte    planes, 1 or 2
+ *   2 bytes   width, a multiple of 8
+ *   2 bytes   height
+ * followed by the PackBits rows, top to bottom, the black row of each frame
+ * row before its red one. tools/framerender renders them with the layout
+ * code of the firmware, tools/framepack.py packs them from an image.
+ *
+ * Successive frames differ in a few cells and the status bar, so a frame can
+ * also be sent as a delta file against the frame before it, little endian:
+ *   4 bytes   "CALD"
+ *   1 byte    FRAME_FILE_VERSION
+ *   1 byte    planes
+ *   2 bytes   width
+ *   2 bytes   height
+ *   4 bytes   id() of the base frame it applies to
+ * followed by runs of rows until all rows are covered:
+ *   2 bytes   rows equal to the base
+ *   2 bytes   rows that changed, n
+ *   n frame rows of PackBits rows, each XORed with the base row first
+ * Unchanged bytes XOR to zero and pack into long runs, so a changed row costs
+ * a few bytes and an unchanged one nothing.
+ */
+
+#define FRAME_FILE_VERSION     1
+#define FRAME_FILE_HEADER_SIZE 10
+#define DELTA_FILE_HEADER_SIZE 14
+class CompressedFrame {
+public:
+  // Drops any stored rows and starts a width x height frame of planes planes
+  void begin(int16_t width, int16_t height, uint8_t planes = 2);
+  void clear();
+
+  // Compresses the rows of band, which must start at rows()
+  void appendBand(const BandBuffer &band);
+  // Decodes the rows of the band set in band
+  void decodeBand(BandBuffer &band) const;
+
+  // Appends the frame as a frame file to file
+  void save(std::vector<uint8_t> &file) const;
+  // Replaces the frame with the one in a frame file. Returns false, leaving
+  // the frame empty, if the file is malformed or cut short.
+  bool load(const uint8_t *file, size_t length);
+  // Appends the delta file that turns base into this frame to file. Returns
+  // false if base differs in size or planes.
+  bool saveDelta(const CompressedFrame &base, std::vector<uint8_t> &file) const;
+  // Replaces the frame with base changed by a delta file. Rows equal to the
+  // base are copied packed, only changed ones are decoded. Returns false,
+  // leaving the frame empty, if the file is malformed or for another base.
+  bool loadDelta(const CompressedFrame &base, const uint8_t *file,
+                 size_t length);
+  // fbHash() of the decoded rows, a frame row at a time with black before
+  // red, to tell frames apart however they were packed
+  uint32_t id() const;
+  // True if other holds the same rows packed the same way, without decoding
+  // them. Equal frames from one packer are, so it tells a frame that didn't
+  // change from the one before it; false may still be an equal frame.
+  bool samePacking(const CompressedFrame &other) const;
+
+  int16_t width() const { return frameWidth; }
+  int16_t height() const { return frameHeight; }
+  uint8_t planes() const { return planeCount; }
+  // Rows appended so far
+  int16_t rows() const { return planeCount ? offsets.size() / planeCount : 0; }
+  // Compressed size including the row index
+  size_t bytes() const
+  {
+    return data.size() + offsets.size() * sizeof(uint32_t);
+  }
+  size_t rawBytes() const
+  {
+    return bandBytes(frameWidth, frameHeight, planeCount);
+  }
+
+private:
+  void appendRow(const uint8_t *row);
+  // Packed row index, black and red of every frame row, and its size
+  const uint8_t *packedRow(size_t index, size_t *size) const;
+  // Decodes all planes of frame row y into row, planes after each other
+  void decodeRow(int16_t y, uint8_t *row) const;
+
+  int16_t frameWidth = 0;
+  int16_t frameHeight = 0;
+  uint8_t planeCount = 0;
+  std::vector<uint32_t> offsets;    // black and red row of every frame row
+  std::vector<uint8_t> data;
+};
+
+#endif // COMPRESSED_FRAME_H
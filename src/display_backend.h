@@ -0,0 +1,87 @@
+#ifndef DISPLAY_BACKEND_H
+#define DISPLAY_BACKEND_H
+
+#include <GxEPD2_BW.h>
+#include <GxEPD2_3C.h>
+#include "config.h"
+
+/* The GxEPD2 display class and plane layout for the panel driver selected
+ * with DISPLAY_PANEL in config.h, picked at compile time.
+ *
+ * Three-color panels get two planes and refresh in about 20 seconds. Black
+ * and white panels get only the black plane, red ink is drawn black, and
+ * those with a fast partial update refresh a window in about a second. Their
+ * controller compares the new frame with the previous one it keeps in RAM,
+ * so every frame is written again after its refresh, see writeAgain.
+ */
+template <class Panel, bool Color = Panel::hasColor>
+struct DisplayBackend;
+
+template <class Panel>
+struct DisplayBackend<Panel, true> {
+  typedef GxEPD2_3C<Panel, FALLBACK_PAGE_HEIGHT> Display;
+  static const uint8_t planes = 2;
+  static const bool fastPartialUpdate = false;
+
+  // Writes h whole rows from y; a nullptr red plane is sent as white
+  static void writeRows(Display &display, const uint8_t *black,
+                        const uint8_t *red, int16_t y, int16_t w, int16_t h)
+  {
+    display.writeImage(black, red, 0, y, w, h);
+  }
+
+  // Writes the w x h part at x, y of a bitmap of wBitmap x hBitmap pixels,
+  // taken from row yPart of it
+  static void writePart(Display &display, const uint8_t *black,
+                        const uint8_t *red, int16_t yPart, int16_t wBitmap,
+                        int16_t hBitmap, int16_t x, int16_t y, int16_t w,
+                        int16_t h)
+  {
+    display.epd2.writeImagePart(black, red, x, yPart, wBitmap, hBitmap, x, y,
+                                w, h);
+  }
+
+  static void writeAgain(Display &, const uint8_t *, int16_t, int16_t,
+                         int16_t, int16_t, int16_t, int16_t, int16_t) {}
+};
+
+template <class Panel>
+struct DisplayBackend<Panel, false> {
+  typedef GxEPD2_BW<Panel, FALLBACK_PAGE_HEIGHT> Display;
+  static const uint8_t planes = 1;
+  static const bool fastPartialUpdate = Panel::hasFastPartialUpdate;
+
+  static void writeRows(Display &display, const uint8_t *black,
+                        const uint8_t *, int16_t y, int16_t w, int16_t h)
+  {
+    display.writeImage(black, 0, y, w, h);
+  }
+
+  static void writePart(Display &display, const uint8_t *black,
+                        const uint8_t *, int16_t yPart, int16_t wBitmap,
+                        int16_t hBitmap, int16_t x, int16_t y, int16_t w,
+                        int16_t h)
+  {
+    display.epd2.writeImagePart(black, x, yPart, wBitmap, hBitmap, x, y, w, h);
+  }
+
+  // Writes the part of a frame that was just refreshed to the controller's
+  // copy of the previous frame, which the next fast partial update compares
+  // against
+  static void writeAgain(Display &display, const uint8_t *black,
+                         int16_t yPart, int16_t wBitmap, int16_t hBitmap,
+                         int16_t x, int16_t y, int16_t w, int16_t h)
+  {
+    if (fastPartialUpdate)
+    {
+      display.epd2.writeImagePartAgain(black, x, yPart, wBitmap, hBitmap, x,
+                                       y, w, h);
+    }
+  }
+};
+
+// The backend of the panel in config.h
+typedef DisplayBackend<DISPLAY_PANEL> Backend;
+typedef Backend::Display Display;
+
+#endif // DISPLAY_BACKEND_H
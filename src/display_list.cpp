@@ -0,0 +1,85 @@
+#include "display_list.h"
+#include <string.h>
+#include <algorithm>
+
+void DisplayList::clear()
+{
+  commands.clear();
+  strings.clear();
+  chrome = nullptr;
+}
+
+DisplayCommand &DisplayList::add(display_op_t op, uint16_t color,
+                                 int16_t x, int16_t y, int16_t w, int16_t h,
+                                 int16_t r, const DisplayRect &bounds)
+{
+  DisplayCommand cmd = {};
+  cmd.op = op;
+  cmd.color = color;
+  cmd.x = x;
+  cmd.y = y;
+  cmd.w = w;
+  cmd.h = h;
+  cmd.r = r;
+  cmd.bounds = bounds;
+  commands.push_back(cmd);
+  return commands.back();
+}
+
+void DisplayList::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                           uint16_t color)
+{
+  add(OP_FILL_RECT, color, x, y, w, h, 0,
+      {x, y, (int16_t)(x + w), (int16_t)(y + h)});
+}
+
+void DisplayList::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                                int16_t r, uint16_t color, uint8_t corners)
+{
+  DisplayCommand &cmd = add(OP_FILL_ROUND_RECT, color, x, y, w, h, r,
+                            {x, y, (int16_t)(x + w), (int16_t)(y + h)});
+  cmd.corners = corners;
+}
+
+void DisplayList::fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color)
+{
+  add(OP_FILL_CIRCLE, color, x, y, 0, 0, r,
+      {(int16_t)(x - r), (int16_t)(y - r),
+       (int16_t)(x + r + 1), (int16_t)(y + r + 1)});
+}
+
+void DisplayList::line(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                       uint16_t color)
+{
+  DisplayRect bounds = {std::min(x0, x1), std::min(y0, y1),
+                        (int16_t)(std::max(x0, x1) + 1),
+                        (int16_t)(std::max(y0, y1) + 1)};
+  add(OP_LINE, color, x0, y0, x1 - x0, y1 - y0, 0, bounds);
+}
+
+void DisplayList::text(int16_t x, int16_t y, const char *str, font_t font,
+                       uint16_t color, const DisplayRect &bounds)
+{
+  text(x, y, str, strlen(str), "", font, color, bounds);
+}
+
+void DisplayList::text(int16_t x, int16_t y, const char *str, uint16_t length,
+                       const char *suffix, font_t font, uint16_t color,
+                       const DisplayRect &bounds)
+{
+  DisplayCommand &cmd = add(OP_TEXT, color, x, y, 0, 0, 0, bounds);
+  cmd.font = font;
+  cmd.text = strings.size();
+  strings.insert(strings.end(), str, str + length);
+  strings.insert(strings.end(), suffix, suffix + strlen(suffix) + 1);
+}
+
+void DisplayList::icon(int16_t x, int16_t y, const PackedIcon &icon,
+                       uint16_t color)
+{
+  int16_t w = icon.width;
+  int16_t h = icon.height;
+  DisplayCommand &cmd = add(OP_ICON, color, x, y, w, h, 0,
+                            {x, y, (int16_t)(x + w), (int16_t)(y + h)});
+  cmd.icon = &icon;
+}
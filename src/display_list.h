@@ -0,0 +1,107 @@
+#ifndef DISPLAY_LIST_H
+#define DISPLAY_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "static_chrome.h"
+#include "span_raster.h"
+#include "packed_icon.h"
+
+// Fonts that can be referenced from the display list
+typedef enum font {
+  FONT_SMALL,   // DongleLight9pt7b
+  FONT_LARGE    // DongleLight15pt7b
+} font_t;
+
+// Drawing primitives recorded by the layout stage
+typedef enum display_op {
+  OP_FILL_RECT,         // x, y, w, h
+  OP_FILL_ROUND_RECT,   // x, y, w, h, r and corners
+  OP_FILL_CIRCLE,       // centre x, y and radius r
+  OP_LINE,              // from x, y to x + w, y + h
+  OP_TEXT,              // baseline x, y
+  OP_ICON               // x, y of a PackedIcon, its cleared bits are ink
+} display_op_t;
+
+// Bounding box, right and bottom edges exclusive
+struct DisplayRect {
+  int16_t x0, y0, x1, y1;
+};
+
+struct DisplayCommand {
+  uint8_t op;          // display_op_t
+  uint8_t font;        // font_t, OP_TEXT only
+  uint8_t corners;     // CORNER_* bits, OP_FILL_ROUND_RECT only
+  uint16_t color;
+  int16_t x, y, w, h, r;
+  DisplayRect bounds;
+  uint16_t text;       // offset into the string pool, OP_TEXT only
+  const PackedIcon *icon;   // OP_ICON only
+};
+
+/* Retained list of everything that makes up one frame. The layout code runs
+ * once per wake and records its primitives here; each page band then replays
+ * only the commands whose bounds intersect it.
+ */
+class DisplayList {
+public:
+  void clear();
+
+  // Pre-rendered chrome drawn into every band before the commands
+  void setBackground(const ChromeImage *image) { chrome = image; }
+  const ChromeImage *background() const { return chrome; }
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  // Rounds the given corners, see span_raster.h
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                     uint16_t color, uint8_t corners = CORNERS_ALL);
+  void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t color);
+  void line(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  // bounds is the ink box of the text as measured by the caller
+  void text(int16_t x, int16_t y, const char *str, font_t font,
+            uint16_t color, const DisplayRect &bounds);
+  // Records the first length characters of str followed by suffix
+  void text(int16_t x, int16_t y, const char *str, uint16_t length,
+            const char *suffix, font_t font, uint16_t color,
+            const DisplayRect &bounds);
+  // icon must outlive the list
+  void icon(int16_t x, int16_t y, const PackedIcon &icon, uint16_t color);
+
+  size_t size() const { return commands.size(); }
+  const DisplayCommand &operator[](size_t i) const { return commands[i]; }
+  const char *textOf(const DisplayCommand &cmd) const
+  {
+    return strings.data() + cmd.text;
+  }
+
+  // True when cmd has pixels inside rows [top, bottom)
+  static bool inBand(const DisplayCommand &cmd, int16_t top, int16_t bottom)
+  {
+    return cmd.bounds.y0 < bottom && cmd.bounds.y1 > top;
+  }
+
+  // Calls fn(cmd) for every command with pixels inside rows [top, bottom)
+  template <typename Fn>
+  void forEachInBand(int16_t top, int16_t bottom, Fn fn) const
+  {
+    for (const DisplayCommand &cmd : commands)
+    {
+      if (inBand(cmd, top, bottom))
+      {
+        fn(cmd);
+      }
+    }
+  }
+
+private:
+  DisplayCommand &add(display_op_t op, uint16_t color, int16_t x, int16_t y,
+                      int16_t w, int16_t h, int16_t r,
+                      const DisplayRect &bounds);
+
+  std::vector<DisplayCommand> commands;
+  std::vector<char> strings;
+  const ChromeImage *chrome = nullptr;
+};
+
+#endif // DISPLAY_LIST_H
@@ -1,740 +1,673 @@
 #include "drawing.h"
 #include "utilities.h"
-#include "icons.h"
-#include "DongleLight9pt7b.h"
-#include "DongleLight9pt15b.h"
 #include "config.h"
+#include "text_layout.h"
+#include "static_chrome.h"
+#include "band_buffer.h"
+#include "band_render.h"
+#include "compressed_frame.h"
+#include "frame_hash.h"
+#include "span_raster.h"
+#include "light_sleep.h"
 #include <SPI.h>
+#include <esp_heap_caps.h>
+#include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/queue.h>
 #include <algorithm>
+#include <string.h>
+#include <time.h>
 
-// ============================================================================
-// Text Rendering Helper Functions
-// ============================================================================
+// Partial refreshes between full ones, none if the panel can't
+#define PANEL_MAX_PARTIAL_REFRESHES \
+  (DISPLAY_PANEL::hasPartialUpdate ? FRAME_MAX_PARTIAL_REFRESHES : 0)
 
-/* Returns the width of a string in pixels based on current font.
- */
-uint16_t getStringWidth(const String &text)
+// What the panel shows, kept in RTC memory across deep sleep
+RTC_DATA_ATTR static PanelState panel = {};
+
+// Seconds for PanelState. The system clock is never set, but it runs on the
+// RTC through deep sleep, so differences between wakes hold.
+static uint32_t panelSeconds()
 {
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.getTextBounds(text, 0, 0, &x1, &y1, &w, &h);
-  return w;
+  return (uint32_t)time(nullptr);
 }
 
-/* Draws a string with specified alignment (LEFT, CENTER, RIGHT).
- */
-void drawString(int16_t x, int16_t y, const String &text, alignment_t alignment,
-                uint16_t color)
-{
-  int16_t x1, y1;
-  uint16_t w, h;
-  display.setTextColor(color);
-  display.getTextBounds(text, x, y, &x1, &y1, &w, &h);
-  if (alignment == RIGHT)
-  {
-    x = x - w;
-  }
-  if (alignment == CENTER)
-  {
-    x = x - w / 2;
-  }
-  display.setCursor(x, y);
-  display.print(text);
+void initDisplay() {
+  // RST may still be held from powerOffDisplay()
+  gpio_hold_dis(static_cast<gpio_num_t>(EPD_RST));
+  // Now initialize the display
+  // A panel whose content is known can be refreshed partially
+  display.init(115200, !panel.valid, 10, false);
+  // Light sleep instead of polling BUSY during refreshes
+  display.epd2.setBusyCallback(sleepWhilePanelBusy);
+ 
+  // Configure SPI pins
+  SPI.end();
+  SPI.begin(EPD_SCK,
+            EPD_MISO,
+            EPD_MOSI,
+            EPD_CS);
+  display.setRotation(0);
+  display.setFullWindow();
+  display.firstPage(); // use paged drawing mode, sets fillScreen(GxEPD_WHITE)
+  return;
 }
 
-/* Draws multi-line string with intelligent word wrapping.
+/* Draws one glyph with its pen position at x and baseline at y, the same way
+ * Adafruit_GFX draws characters of custom fonts. Adafruit_GFX itself only
+ * handles fonts indexed by a single byte.
  */
-void drawMultiLnString(int16_t x, int16_t y, const String &text,
-                       alignment_t alignment, uint16_t max_width,
-                       uint16_t max_lines, int16_t line_spacing,
-                       uint16_t color)
+static void drawGlyph(Adafruit_GFX &gfx, const SparseFont &font,
+                      const GFXglyph &glyph, int16_t x, int16_t y,
+                      uint16_t color)
 {
-  uint16_t current_line = 0;
-  String textRemaining = text;
-  // print until we reach max_lines or no more text remains
-  while (current_line < max_lines && !textRemaining.isEmpty())
-  {
-    int16_t  x1, y1;
-    uint16_t w, h;
-
-    display.getTextBounds(textRemaining, 0, 0, &x1, &y1, &w, &h);
-
-    int endIndex = textRemaining.length();
-    // check if remaining text is to wide, if it is then print what we can
-    String subStr = textRemaining;
-    int splitAt = 0;
-    int keepLastChar = 0;
-    while (w > max_width && splitAt != -1)
+  const uint8_t *bits = font.bitmap + glyph.bitmapOffset;
+  uint8_t byte = 0;
+  uint8_t bit = 0;
+  gfx.startWrite();
+  for (uint8_t yy = 0; yy < glyph.height; yy++)
+  {
+    for (uint8_t xx = 0; xx < glyph.width; xx++)
     {
-      if (keepLastChar)
+      if (!(bit++ & 7))
       {
-        // if we kept the last character during the last iteration of this while
-        // loop, remove it now so we don't get stuck in an infinite loop.
-        subStr.remove(subStr.length() - 1);
+        byte = *bits++;
       }
-
-      // find the last place in the string that we can break it.
-      if (current_line < max_lines - 1)
-      {
-        splitAt = std::max(subStr.lastIndexOf(" "),
-                           subStr.lastIndexOf("-"));
-      }
-      else
+      if (byte & 0x80)
       {
-        // this is the last line, only break at spaces so we can add ellipsis
-        splitAt = subStr.lastIndexOf(" ");
+        gfx.writePixel(x + glyph.xOffset + xx, y + glyph.yOffset + yy, color);
       }
+      byte <<= 1;
+    }
+  }
+  gfx.endWrite();
+} // end drawGlyph
 
-      // if splitAt == -1 then there is an unbroken set of characters that is
-      // longer than max_width. Otherwise if splitAt != -1 then we can continue
-      // the loop until the string is <= max_width
-      if (splitAt != -1)
-      {
-        endIndex = splitAt;
-        subStr = subStr.substring(0, endIndex + 1);
-
-        char lastChar = subStr.charAt(endIndex);
-        if (lastChar == ' ')
-        {
-          // remove this char now so it is not counted towards line width
-          keepLastChar = 0;
-          subStr.remove(endIndex);
-          --endIndex;
-        }
-        else if (lastChar == '-')
-        {
-          // this char will be printed on this line and removed next iteration
-          keepLastChar = 1;
-        }
-
-        if (current_line < max_lines - 1)
-        {
-          // this is not the last line
-          display.getTextBounds(subStr, 0, 0, &x1, &y1, &w, &h);
-        }
-        else
-        {
-          // this is the last line, we need to make sure there is space for
-          // ellipsis
-          display.getTextBounds(subStr + "...", 0, 0, &x1, &y1, &w, &h);
-          if (w <= max_width)
-          {
-            // ellipsis fit, add them to subStr
-            subStr = subStr + "...";
-          }
-        }
-
-      } // end if (splitAt != -1)
-    } // end inner while
-
-    drawString(x, y + (current_line * line_spacing), subStr, alignment, color);
-
-    // update textRemaining to no longer include what was printed
-    // +1 for exclusive bounds, +1 to get passed space/dash
-    textRemaining = textRemaining.substring(endIndex + 2 - keepLastChar);
-
-    ++current_line;
-  } // end outer while
-
-  return;
-} // end drawMultiLnString
-
-// ============================================================================
-// Icon/Bitmap Helper Functions
-// ============================================================================
-
-/* Returns 24x24 bitmap incidcating battery status.
+/* Adafruit_GFX::fillRoundRect() with only some corners rounded.
  */
-const uint8_t *getBatBitmap24(uint32_t batPercent)
+static void fillRoundRectGfx(Adafruit_GFX &gfx, const DisplayCommand &cmd)
 {
-  if (batPercent >= 93)
-  {
-    return battery_full_90deg_24x24;
-  }
-  else if (batPercent >= 79)
+  int16_t r = std::min<int16_t>(cmd.r, std::min(cmd.w, cmd.h) / 2);
+  if (cmd.corners == CORNERS_ALL || r <= 0)
   {
-    return battery_6_bar_90deg_24x24;
+    gfx.fillRoundRect(cmd.x, cmd.y, cmd.w, cmd.h, r, cmd.color);
+    return;
   }
-  else if (batPercent >= 65)
+  int16_t left = cmd.corners & CORNERS_LEFT ? r : 0;
+  int16_t right = cmd.corners & CORNERS_RIGHT ? r : 0;
+  gfx.fillRect(cmd.x + left, cmd.y, cmd.w - left - right, cmd.h, cmd.color);
+  if (left)
   {
-    return battery_5_bar_90deg_24x24;
+    gfx.fillCircleHelper(cmd.x + r, cmd.y + r, r, 2, cmd.h - 2 * r - 1,
+                         cmd.color);
   }
-  else if (batPercent >= 50)
+  if (right)
   {
-    return battery_4_bar_90deg_24x24;
+    gfx.fillCircleHelper(cmd.x + cmd.w - r - 1, cmd.y + r, r, 1,
+                         cmd.h - 2 * r - 1, cmd.color);
   }
-  else if (batPercent >= 36)
+} // end fillRoundRectGfx
+
+/* GxEPD2's drawInvertedBitmap(), which draws the cleared bits of a bitmap,
+ * for a packed icon and any Adafruit_GFX target.
+ */
+static void drawIconGfx(Adafruit_GFX &gfx, const DisplayCommand &cmd)
+{
+  gfx.startWrite();
+  forEachIconRow(*cmd.icon, 0, cmd.h,
+                 [&](int16_t j, const uint8_t *row) {
+                   for (int16_t i = 0; i < cmd.w; i++)
+                   {
+                     if (!(row[i / 8] & (0x80 >> (i & 7))))
+                     {
+                       gfx.writePixel(cmd.x + i, cmd.y + j, cmd.color);
+                     }
+                   }
+                 });
+  gfx.endWrite();
+}
+
+/* Replays a single display list command on gfx, or straight into band when
+ * there is one.
+ */
+static void replayCommand(Adafruit_GFX &gfx, BandBuffer *band,
+                          const DisplayList &dl, const DisplayCommand &cmd)
+{
+  if (band && replayIntoBand(*band, dl, cmd))
   {
-    return battery_3_bar_90deg_24x24;
+    return;
   }
-  else if (batPercent >= 22)
+  switch (cmd.op)
   {
-    return battery_2_bar_90deg_24x24;
-  }
-  else if (batPercent >= 8)
+  case OP_FILL_RECT:
+    gfx.fillRect(cmd.x, cmd.y, cmd.w, cmd.h, cmd.color);
+    break;
+  case OP_FILL_ROUND_RECT:
+    fillRoundRectGfx(gfx, cmd);
+    break;
+  case OP_FILL_CIRCLE:
+    gfx.fillCircle(cmd.x, cmd.y, cmd.r, cmd.color);
+    break;
+  case OP_LINE:
+    gfx.drawLine(cmd.x, cmd.y, cmd.x + cmd.w, cmd.y + cmd.h, cmd.color);
+    break;
+  case OP_TEXT:
   {
-    return battery_1_bar_90deg_24x24;
+    const SparseFont &font = getFont((font_t)cmd.font);
+    const char *text = dl.textOf(cmd);
+    forEachTextGlyph(font, text, strlen(text),
+                     [&](const GFXglyph &glyph, int16_t dx) {
+                       drawGlyph(gfx, font, glyph, cmd.x + dx, cmd.y,
+                                 cmd.color);
+                     });
+    break;
   }
-  else
-  {  // batPercent < 8
-    return battery_0_bar_90deg_24x24;
+  case OP_ICON:
+    drawIconGfx(gfx, cmd);
+    break;
   }
-} // end getBatBitmap24
+} // end replayCommand
 
-/* Returns appropriate WiFi icon based on signal strength.
+/* Draws the rows [top, bottom) of a display list: first the rows of the
+ * background chrome inside them, then only the commands that have pixels
+ * inside them. band is the buffer gfx draws into, if it is a BandCanvas.
  */
-const uint8_t *getWiFiBitmap16(int rssi)
+static void drawBand(Adafruit_GFX &gfx, BandBuffer *band,
+                     const DisplayList &dl, int16_t top, int16_t bottom)
 {
-  if (rssi == 0)
-    return wifi_x_16x16;
-  else if (rssi >= -50)
-    return wifi_16x16;
-  else if (rssi >= -60)
-    return wifi_3_bar_16x16;
-  else if (rssi >= -70)
-    return wifi_2_bar_16x16;
-  else
-    return wifi_1_bar_16x16;
+  if (dl.background())
+  {
+    forEachChromeRun(*dl.background(), top, bottom,
+                     [&](int16_t x, int16_t y, int16_t w, uint8_t plane) {
+                       gfx.writeFastHLine(x, y, w,
+                                          plane == CHROME_PLANE_RED
+                                              ? GxEPD_RED
+                                              : GxEPD_BLACK);
+                     });
+  }
+  dl.forEachInBand(top, bottom,
+                   [&](const DisplayCommand &cmd) {
+                     replayCommand(gfx, band, dl, cmd);
+                   });
 }
 
-/* Returns WiFi signal quality description.
+/* Adafruit_GFX drawing into a heap allocated band, with the colors mapped
+ * the way GxEPD2_3C maps them. Horizontal spans and rectangles go to the
+ * band a byte at a time instead of pixel by pixel.
  */
-const char *getWiFidesc(int rssi)
-{
-  if (rssi == 0)
-    return TXT_WIFI_NO_CONNECTION;
-  else if (rssi >= -50)
-    return TXT_WIFI_EXCELLENT;
-  else if (rssi >= -60)
-    return TXT_WIFI_GOOD;
-  else if (rssi >= -70)
-    return TXT_WIFI_FAIR;
-  else
-    return TXT_WIFI_POOR;
-}
+class BandCanvas : public Adafruit_GFX {
+public:
+  explicit BandCanvas(BandBuffer &buffer)
+      : Adafruit_GFX(DISP_WIDTH, DISP_HEIGHT), band(buffer) {}
 
-// ============================================================================
-// Calendar Drawing Functions
-// ============================================================================
-
-// Helper function to calculate grid position from date string (YYYY-MM-DD)
-int calculateGridPosition(String date, String weekStart) {
-  // Extract components from date strings
-  int dateYear = date.substring(0, 4).toInt();
-  int dateMonth = date.substring(5, 7).toInt();
-  int dateDay = date.substring(8, 10).toInt();
-
-  int weekStartYear = weekStart.substring(0, 4).toInt();
-  int weekStartMonth = weekStart.substring(5, 7).toInt();
-  int weekStartDay = weekStart.substring(8, 10).toInt();
-
-  // Simple date calculation for same month
-  if (dateYear == weekStartYear && dateMonth == weekStartMonth) {
-    return dateDay - weekStartDay + 1;
-  }
-
-  // Handle month boundaries (simplified for common cases)
-  if (dateYear == weekStartYear) {
-    if (dateMonth == weekStartMonth + 1) {
-      // Next month - assume previous month had 31 days
-      return (31 - weekStartDay + 1) + dateDay;
-    } else if (dateMonth == weekStartMonth - 1) {
-      // Previous month case (shouldn't happen in normal calendar view)
-      return dateDay - weekStartDay + 1;
-    }
+  void drawPixel(int16_t x, int16_t y, uint16_t color) override
+  {
+    band.setPixel(x, y, inkOf(color));
   }
 
-  // Handle year boundary (December to January)
-  if (weekStartYear == dateYear - 1 && weekStartMonth == 12 && dateMonth == 1) {
-    return (31 - weekStartDay + 1) + dateDay;
+  void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+  {
+    band.fillSpan(x, y, w, inkOf(color));
   }
 
-  // Default fallback
-  return 1;
-}
+  void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) override
+  {
+    band.fillSpan(x, y, w, inkOf(color));
+  }
 
-// Helper function to calculate calendar day number for display
-int calculateCalendarDay(String weekStart, int weekNumber, int dayInWeek) {
-  int weekStartYear = weekStart.substring(0, 4).toInt();
-  int weekStartMonth = weekStart.substring(5, 7).toInt();
-  int weekStartDay = weekStart.substring(8, 10).toInt();
+  void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+  {
+    fillRect(x, y, 1, h, color);
+  }
 
-  // Calculate total days offset from week start
-  int totalDaysOffset = (weekNumber * 7) + dayInWeek;
+  void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) override
+  {
+    fillRect(x, y, 1, h, color);
+  }
 
-  // Add offset to week start day
-  int resultDay = weekStartDay + totalDaysOffset;
+  void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                     uint16_t color) override
+  {
+    fillRect(x, y, w, h, color);
+  }
 
-  // Simple month handling (assumes 31 days per month for simplicity)
-  // In production, you'd want proper date arithmetic with actual month lengths
-  if (resultDay > 31) {
-    resultDay = resultDay - 31; // Move to next month
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
+                uint16_t color) override
+  {
+    fillRectSpans(band, x, y, w, h, inkOf(color));
   }
 
-  return resultDay;
-}
+  void fillScreen(uint16_t color) override
+  {
+    band.fill(inkOf(color));
+  }
 
-void initDisplay() {
-  // Now initialize the display
-  display.init(115200, true, 10, false);
- 
-  // Configure SPI pins
-  SPI.end();
-  SPI.begin(EPD_SCK,
-            EPD_MISO,
-            EPD_MOSI,
-            EPD_CS);
-  display.setRotation(0);
-  display.setFont(&DongleLight15pt7b);
-  display.setTextColor(GxEPD_BLACK);
-  display.setFullWindow();
-  display.firstPage(); // use paged drawing mode, sets fillScreen(GxEPD_WHITE)
-  return;
-}
+private:
+  BandBuffer &band;
+};
 
-void powerOffDisplay() {
-   display.hibernate(); // turns powerOff() and sets controller to deep sleep for
-                       // minimum power use
+// The whole panel, as a refresh window
+static const DisplayRect FULL_WINDOW = {0, 0, DISP_WIDTH, DISP_HEIGHT};
+
+/* Writes the part of a band inside window to the panel's RAM, or with again
+ * to its copy of the previous frame, see display_backend.h. A red plane
+ * without ink is passed as nullptr when the window is the whole panel,
+ * which GxEPD2 sends as constant white instead of reading it from the
+ * buffer. Returns true if it was.
+ */
+static bool writeBand(const BandBuffer &band, const DisplayRect &window,
+                      bool again = false)
+{
+  int16_t top = std::max<int16_t>(window.y0, band.top());
+  int16_t bottom = std::min<int16_t>(window.y1, band.top() + band.rows());
+  if (top >= bottom)
+  {
+    return false;
+  }
+  if (again)
+  {
+    Backend::writeAgain(display, band.black(), top - band.top(), band.width(),
+                        band.rows(), window.x0, top, window.x1 - window.x0,
+                        bottom - top);
+    return false;
+  }
+  if (window.x0 == 0 && window.x1 == band.width())
+  {
+    bool blankRed = band.redBlank();
+    Backend::writeRows(display, band.black(),
+                       blankRed ? nullptr : band.red(), band.top(),
+                       band.width(), band.rows());
+    return blankRed;
+  }
+  Backend::writePart(display, band.black(), band.red(), top - band.top(),
+                     band.width(), band.rows(), window.x0, top,
+                     window.x1 - window.x0, bottom - top);
+  return false;
 }
 
-void drawRoundedRect(int x, int y, int width, int height, int radius, uint16_t color) {
-  display.fillRect(x + radius, y, width - 2 * radius, height, color);
-  display.fillRect(x, y + radius, width, height - 2 * radius, color);
-  display.fillCircle(x + radius, y + radius, radius, color);
-  display.fillCircle(x + width - radius - 1, y + radius, radius, color);
-  display.fillCircle(x + radius, y + height - radius - 1, radius, color);
-  display.fillCircle(x + width - radius - 1, y + height - radius - 1, radius, color);
+// Bands passed between sendBands() and the transfer task
+struct BandTransfer {
+  QueueHandle_t decoded;    // bands to write, nullptr ends the frame
+  QueueHandle_t written;    // bands free to fill again
+  DisplayRect window;
+  bool again;               // see writeBand()
+  unsigned long writeMicros;
+  uint16_t blankRed;
+};
+
+/* Writes the bands of a frame to the panel on RENDER_TRANSFER_CORE, while
+ * the loop task decodes or renders the next band on the other core.
+ */
+static void transferTask(void *arg)
+{
+  BandTransfer &transfer = *(BandTransfer *)arg;
+  BandBuffer *band = nullptr;
+  while (xQueueReceive(transfer.decoded, &band, portMAX_DELAY) == pdTRUE &&
+         band)
+  {
+    unsigned long start = micros();
+    transfer.blankRed += writeBand(*band, transfer.window, transfer.again);
+    transfer.writeMicros += micros() - start;
+    xQueueSend(transfer.written, &band, portMAX_DELAY);
+  }
+  xQueueSend(transfer.written, &band, portMAX_DELAY);   // nullptr: done
+  vTaskDelete(nullptr);
 }
 
-void drawSingleDayEvent(int x, int y, int width, int height, String startTime, String endTime, String title, uint16_t color, bool singleLineMode) {
-  drawRoundedRect(x, y, width, height, EVENT_BORDER_RADIUS, color);
-
-  // Display time range on first line
-  display.setTextColor(GxEPD_WHITE);
-  display.setFont(&DongleLight9pt7b);
-  display.setCursor(x + EVENT_TEXT_MARGIN, y + TIME_TEXT_Y_OFFSET);
-  display.print(startTime + "-" + endTime);
-
-  // Display title - supporting single-line mode for overflow
-  display.setFont(&DongleLight15pt7b);
-
-  // Calculate available characters per line
-  int charsPerLine = CHARS_PER_LINE;
-  String titleLine1 = "";
-  String titleLine2 = "";
-
-  if (singleLineMode || title.length() <= charsPerLine) {
-    // Single line mode or title fits on one line
-    if (title.length() <= charsPerLine) {
-      titleLine1 = title;
-    } else {
-      // Truncate for single line mode
-      titleLine1 = title.substring(0, charsPerLine - 1) + ".";
+/* Fills the bands of a frame that window touches with fill(band), which
+ * gets each band set to its rows, and writes them to the panel, or with
+ * again to its copy of the previous frame. With a second band buffer, band
+ * N is written while band N + 1 is filled; without, the bands are filled and
+ * written in turn. what names the filling in the log.
+ */
+template <class Fill>
+static void sendBands(Fill fill, const char *what, BandBuffer &first,
+                      BandBuffer *second, int16_t bandHeight,
+                      const DisplayRect &window, bool again = false)
+{
+  unsigned long start = micros();
+  unsigned long fillMicros = 0;
+  BandTransfer transfer = {nullptr, nullptr, window, again, 0, 0};
+  bool overlapped = false;
+  if (second)
+  {
+    transfer.decoded = xQueueCreate(2, sizeof(BandBuffer *));
+    transfer.written = xQueueCreate(3, sizeof(BandBuffer *));
+    overlapped = transfer.decoded && transfer.written &&
+                 xTaskCreatePinnedToCore(transferTask, "bandTransfer",
+                                         RENDER_TRANSFER_STACK, &transfer, 1,
+                                         nullptr, RENDER_TRANSFER_CORE) == pdPASS;
+  }
+
+  int16_t bands = 0;
+  for (int16_t top = window.y0 - window.y0 % bandHeight; top < window.y1;
+       top += bandHeight, bands++)
+  {
+    // The first two bands get a buffer each, later ones wait for a written one
+    BandBuffer *band = &first;
+    if (overlapped && bands == 1)
+    {
+      band = second;
     }
-  } else {
-    // Split title across two lines at word boundary if possible
-    int splitPos = charsPerLine;
-    // Try to find a space near the split point to avoid breaking words
-    for (int i = charsPerLine - 3; i < min((int)title.length(), charsPerLine + 3); i++) {
-      if (i < title.length() && title.charAt(i) == ' ') {
-        splitPos = i;
-        break;
-      }
+    else if (overlapped && bands > 1)
+    {
+      xQueueReceive(transfer.written, &band, portMAX_DELAY);
     }
-
-    titleLine1 = title.substring(0, splitPos);
-    if (splitPos < title.length()) {
-      titleLine2 = title.substring(splitPos + (title.charAt(splitPos) == ' ' ? 1 : 0));
-      // Truncate second line if too long
-      if (titleLine2.length() > charsPerLine) {
-        titleLine2 = titleLine2.substring(0, charsPerLine - 1) + ".";
-      }
+    unsigned long fillStart = micros();
+    band->setBand(top, std::min<int16_t>(bandHeight, DISP_HEIGHT - top));
+    fill(*band);
+    fillMicros += micros() - fillStart;
+    if (overlapped)
+    {
+      xQueueSend(transfer.decoded, &band, portMAX_DELAY);
+      continue;
     }
+    unsigned long writeStart = micros();
+    transfer.blankRed += writeBand(*band, window, again);
+    transfer.writeMicros += micros() - writeStart;
   }
 
-  // Draw first line of title
-  display.setCursor(x + EVENT_TEXT_MARGIN, y + TITLE_FIRST_LINE_Y_OFFSET);
-  display.print(titleLine1);
-
-  // Draw second line of title if it exists and not in single line mode
-  if (titleLine2.length() > 0 && !singleLineMode) {
-    display.setCursor(x + EVENT_TEXT_MARGIN, y + TITLE_SECOND_LINE_Y_OFFSET);
-    display.print(titleLine2);
+  if (overlapped)
+  {
+    // Wait for the task to write the last bands and end
+    BandBuffer *done = nullptr;
+    xQueueSend(transfer.decoded, &done, portMAX_DELAY);
+    do
+    {
+      xQueueReceive(transfer.written, &done, portMAX_DELAY);
+    } while (done);
   }
-
-  display.setTextColor(GxEPD_BLACK);
-  display.setFont(&DongleLight15pt7b);
+  if (transfer.decoded)
+  {
+    vQueueDelete(transfer.decoded);
+  }
+  if (transfer.written)
+  {
+    vQueueDelete(transfer.written);
+  }
+  Serial.printf("Sent %d bands in %lu ms %s: %s %lu ms, panel writes "
+                "%lu ms, %u without red\n",
+                bands, (micros() - start) / 1000,
+                overlapped ? "overlapped" : "in turn", what, fillMicros / 1000,
+                transfer.writeMicros / 1000, transfer.blankRed);
+} // end sendBands
+
+/* Decodes the bands of a compressed frame that window touches and writes
+ * them to the panel, see sendBands().
+ */
+static void sendFrame(const CompressedFrame &frame, BandBuffer &first,
+                      BandBuffer *second, int16_t bandHeight,
+                      const DisplayRect &window, bool again = false)
+{
+  sendBands([&](BandBuffer &band) { frame.decodeBand(band); }, "decoding",
+            first, second, bandHeight, window, again);
 }
 
-void drawMultiDayEvent(int x, int y, int width, int height, String title, bool isStart, bool isEnd, uint16_t color) {
-  if (isStart && isEnd) {
-    drawRoundedRect(x, y, width, height, EVENT_BORDER_RADIUS, color);
-  } else if (isStart) {
-    display.fillRect(x + EVENT_BORDER_RADIUS, y, width - EVENT_BORDER_RADIUS, height, color);
-    display.fillCircle(x + EVENT_BORDER_RADIUS, y + EVENT_BORDER_RADIUS, EVENT_BORDER_RADIUS, color);
-    display.fillCircle(x + EVENT_BORDER_RADIUS, y + height - EVENT_BORDER_RADIUS, EVENT_BORDER_RADIUS, color);
-  } else if (isEnd) {
-    display.fillRect(x, y, width - EVENT_BORDER_RADIUS, height, color);
-    display.fillCircle(x + width - EVENT_BORDER_RADIUS, y + EVENT_BORDER_RADIUS, EVENT_BORDER_RADIUS, color);
-    display.fillCircle(x + width - EVENT_BORDER_RADIUS, y + height - EVENT_BORDER_RADIUS, EVENT_BORDER_RADIUS, color);
-  } else {
-    display.fillRect(x, y, width, height, color);
-  }
-
-  display.setTextColor(GxEPD_WHITE);
-  display.setFont(&DongleLight15pt7b);
-  display.setCursor(x + EVENT_TEXT_MARGIN, y + 19);
-  display.print(title);
-
-  display.setTextColor(GxEPD_BLACK);
+/* A second band buffer of plan's size, if the heap still has room for it
+ * and the reserve.
+ */
+static bool allocateSecond(BandBuffer &second, const PagePlan &plan)
+{
+  size_t left = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  return left > RENDER_HEAP_RESERVE &&
+         plan.bytes <= left - RENDER_HEAP_RESERVE &&
+         second.allocate(DISP_WIDTH, plan.bandHeight, Backend::planes);
 }
 
-void drawCalendar(const std::vector<CalendarEvent>& events, String currentDate, String currentDay, String currentTime, String weekStart) {
-
-  // Calculate current day grid position relative to week start
-  int currentDayNumber = calculateGridPosition(currentDate, weekStart);
-
-    const char* weekdays[] = {TXT_MONDAY, TXT_TUESDAY, TXT_WEDNESDAY, TXT_THURSDAY, TXT_FRIDAY, TXT_SATURDAY, TXT_SUNDAY};
-
-    display.setTextColor(GxEPD_BLACK);
-
-    for (int day = 0; day < 7; day++) {
-      int x = day * DAY_WIDTH;
-      int y = HEADER_HEIGHT - HEADER_TEXT_Y_OFFSET;
-
-      // Calculate which weekday is current based on currentDayNumber
-      int currentWeekday = (currentDayNumber - 1) % 7; // Convert day number to weekday index
-
-      // Set color for current weekday
-      if (day == currentWeekday) {
-        display.setTextColor(GxEPD_RED);
-      } else {
-        display.setTextColor(GxEPD_BLACK);
-      }
+/* Refreshes the whole panel, or only the window of a partial plan. The
+ * frame has to be written already: from here on the wake waits on BUSY.
+ */
+static void refreshPanel(const RefreshPlan &refresh)
+{
+  markPhase(PHASE_REFRESH);
+  if (refresh.kind == REFRESH_PARTIAL)
+  {
+    const DisplayRect &w = refresh.window;
+    Serial.printf("Refreshing %d,%d to %d,%d only\n", w.x0, w.y0, w.x1, w.y1);
+    display.refresh(w.x0, w.y0, w.x1 - w.x0, w.y1 - w.y0);
+    return;
+  }
+  display.refresh(false);
+}
 
-      // Proper text width calculation for Dongle Light font centering
-      // Use font-specific character widths for accurate centering
-      int textWidth;
-      switch(day) {
-        case 0: textWidth = 52; break; // MONDAY (6 chars)
-        case 1: textWidth = 62; break; // TUESDAY (7 chars)
-        case 2: textWidth = 82; break; // WEDNESDAY (9 chars)
-        case 3: textWidth = 70; break; // THURSDAY (8 chars)
-        case 4: textWidth = 52; break; // FRIDAY (6 chars)
-        case 5: textWidth = 70; break; // SATURDAY (8 chars)
-        case 6: textWidth = 50; break; // SUNDAY (6 chars)
-        default: textWidth = 60; break;
+/* Compares a compressed frame, whose hash is complete, with the panel and
+ * writes and refreshes what changed, decoding it into buffer in bands of
+ * plan.bandHeight rows. Releases buffer. Returns false if the refresh was
+ * skipped.
+ */
+static bool showFrame(const CompressedFrame &frame, BandBuffer &buffer,
+                      const PagePlan &plan, const FrameHash &hash)
+{
+  RefreshPlan refresh = planRefresh(panel, hash, panelSeconds(),
+                                    FRAME_MAX_STATUS_AGE * 60UL,
+                                    PANEL_MAX_PARTIAL_REFRESHES);
+  if (refresh.kind == REFRESH_NONE)
+  {
+    Serial.println("Frame unchanged, refresh skipped");
+    buffer.release();
+    return false;
+  }
+  // A second band, if the heap still has room, to overlap the transfer
+  BandBuffer second;
+  bool overlap = allocateSecond(second, plan);
+  const DisplayRect &window = refresh.kind == REFRESH_PARTIAL
+                                  ? refresh.window : FULL_WINDOW;
+  sendFrame(frame, buffer, overlap ? &second : nullptr, plan.bandHeight,
+            window);
+  refreshPanel(refresh);
+  if (Backend::fastPartialUpdate)
+  {
+    sendFrame(frame, buffer, overlap ? &second : nullptr, plan.bandHeight,
+              window, true);
+  }
+  second.release();
+  buffer.release();
+  rememberRefresh(panel, hash, refresh.kind, panelSeconds());
+  return true;
+} // end showFrame
+
+/* Renders a display list into a frame buffer and refreshes the panel. Call
+ * initDisplay() first, and only once WiFi is off, as the buffer is sized from
+ * the largest free heap block at this point:
+ *  - when the refresh will be a full one anyway, two bands: one is written
+ *    to the panel while the next is rendered, see sendBands()
+ *  - a raw 96000 byte frame if it fits, rendered in a single pass
+ *  - otherwise a compressed frame: bands are rendered once into a small
+ *    buffer and compressed, then decoded again band by band while they are
+ *    written to the panel, see sendFrame()
+ *  - if not even the smallest band fits, the display's own page buffer
+ * The frame is hashed while it is rendered and compared with the one on the
+ * panel, see planRefresh(): unchanged frames aren't refreshed, and frames
+ * with a few changed cells only have those written and refreshed. Returns
+ * true if the panel was refreshed.
+ */
+bool drawDisplayList(const DisplayList &dl)
+{
+  unsigned long start = millis();
+  size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  size_t available = largest > RENDER_HEAP_RESERVE
+                         ? largest - RENDER_HEAP_RESERVE : 0;
+
+  BandBuffer buffer;
+  BandCanvas canvas(buffer);
+  DisplayRect regions[FRAME_MAX_REGIONS];
+  FrameHash hash;
+  hash.begin(regions, layoutRegions(regions));
+
+  // A full refresh doesn't wait for the hash to decide what to write, so
+  // each band is written while the next one is rendered. The bands are
+  // compressed only for the second write of fast partial updates.
+  if (fullRefreshAhead(panel, hash.regionCount()))
+  {
+    PagePlan plan = planPages(DISP_WIDTH, DISP_HEIGHT,
+                              available / (Backend::fastPartialUpdate ? 4 : 2),
+                              RENDER_MAX_PAGES, Backend::planes);
+    BandBuffer second;
+    if (plan.pages &&
+        buffer.allocate(DISP_WIDTH, plan.bandHeight, Backend::planes) &&
+        allocateSecond(second, plan))
+    {
+      BandCanvas secondCanvas(second);
+      CompressedFrame frame;
+      frame.begin(DISP_WIDTH, DISP_HEIGHT, Backend::planes);
+      sendBands([&](BandBuffer &band) {
+                  drawBand(&band == &buffer ? canvas : secondCanvas, &band, dl,
+                           band.top(), band.top() + band.rows());
+                  hash.addBand(band);
+                  if (Backend::fastPartialUpdate)
+                  {
+                    frame.appendBand(band);
+                  }
+                }, "rendering", buffer, &second, plan.bandHeight, FULL_WINDOW);
+      refreshPanel({REFRESH_FULL, FULL_WINDOW});
+      if (Backend::fastPartialUpdate)
+      {
+        sendFrame(frame, buffer, &second, plan.bandHeight, FULL_WINDOW, true);
       }
-      int centerX = x + (DAY_WIDTH - textWidth) / 2;
+      second.release();
+      buffer.release();
+      rememberRefresh(panel, hash, REFRESH_FULL, panelSeconds());
+      Serial.printf("Rendered %d bands of %d rows while sending, refreshed in "
+                    "%lu ms (largest free block %u bytes)\n",
+                    plan.pages, plan.bandHeight, millis() - start,
+                    (unsigned)largest);
+      return true;
+    }
+    buffer.release();
+  }
 
-      display.setCursor(centerX, y);
-      display.print(weekdays[day]);
+  if (planPages(DISP_WIDTH, DISP_HEIGHT, available, 1, Backend::planes).pages &&
+      buffer.allocate(DISP_WIDTH, DISP_HEIGHT, Backend::planes))
+  {
+    buffer.setBand(0, DISP_HEIGHT);
+    drawBand(canvas, &buffer, dl, 0, DISP_HEIGHT);
+    hash.addBand(buffer);
+    RefreshPlan refresh = planRefresh(panel, hash, panelSeconds(),
+                                      FRAME_MAX_STATUS_AGE * 60UL,
+                                      PANEL_MAX_PARTIAL_REFRESHES);
+    if (refresh.kind == REFRESH_NONE)
+    {
+      Serial.printf("Frame unchanged, refresh skipped (rendered in %lu ms)\n",
+                    millis() - start);
+      return false;
     }
-    display.setTextColor(GxEPD_BLACK); // Reset to black
-
-    display.drawLine(0, HEADER_HEIGHT, 800, HEADER_HEIGHT, GxEPD_BLACK);
-
-    // STEP 1: Assign consistent rows to all multi-day events globally
-    // Create a dynamic row assignment for multi-day events
-    std::vector<int> eventRows(events.size(), -1); // Initialize to -1 (unassigned)
-
-    // Sort multi-day events by start day and assign rows
-    for (int currentDay = 1; currentDay <= 14; currentDay++) {
-      for (int i = 0; i < events.size(); i++) {
-        if (events[i].isMultiDay && events[i].startDay == currentDay && eventRows[i] == -1) {
-          // Find the first available row for this event
-          int assignedRow = 0;
-          bool rowFound = false;
-
-          while (!rowFound) {
-            bool rowOccupied = false;
-            // Check if this row is occupied by any other event on any day this event spans
-            for (int checkDay = events[i].startDay; checkDay <= events[i].endDay; checkDay++) {
-              for (int j = 0; j < events.size(); j++) {
-                if (j != i && events[j].isMultiDay && eventRows[j] == assignedRow &&
-                    checkDay >= events[j].startDay && checkDay <= events[j].endDay) {
-                  rowOccupied = true;
-                  break;
-                }
-              }
-              if (rowOccupied) break;
-            }
-
-            if (!rowOccupied) {
-              eventRows[i] = assignedRow;
-              rowFound = true;
-            } else {
-              assignedRow++;
-            }
-          }
-        }
-      }
+    // What is written depends on the hash of the whole frame, so the write
+    // can only start once all of it is rendered
+    unsigned long rendered = millis();
+    const DisplayRect &window = refresh.kind == REFRESH_PARTIAL
+                                    ? refresh.window : FULL_WINDOW;
+    bool blankRed = writeBand(buffer, window);
+    Serial.printf("Sent the frame in %lu ms%s\n", millis() - rendered,
+                  blankRed ? " without red" : "");
+    refreshPanel(refresh);
+    if (Backend::fastPartialUpdate)
+    {
+      writeBand(buffer, window, true);
     }
+    buffer.release();
+    rememberRefresh(panel, hash, refresh.kind, panelSeconds());
+    Serial.printf("Rendered in one pass in %lu ms (largest free block %u bytes)\n",
+                  millis() - start, (unsigned)largest);
+    return true;
+  }
 
-    // STEP 2: Draw multi-day events as continuous boxes (only on their start day)
-    for (int i = 0; i < events.size(); i++) {
-      if (events[i].isMultiDay) {
-        int startDay = events[i].startDay;
-        int endDay = events[i].endDay;
-
-        // Calculate which week and day position the start day is in
-        int startWeek = (startDay - 1) / 7;
-        int startDayInWeek = (startDay - 1) % 7;
-
-        if (startWeek < 2) { // Only draw if it starts in our 2-week view
-          int startX = startDayInWeek * DAY_WIDTH + EVENT_MARGIN;
-          int startY = HEADER_HEIGHT + (startWeek * ROW_HEIGHT) + DAY_NUMBER_MARGIN + (eventRows[i] * MULTI_DAY_EVENT_SPACING);
-
-          // Calculate how many days this event spans in the visible calendar
-          int daysInCalendar = min(endDay, 14) - startDay + 1;
-          int daysToEndOfWeek = 7 - startDayInWeek;
-          int daysInFirstWeek = min(daysInCalendar, daysToEndOfWeek);
-
-          // Draw first week portion
-          int eventWidth = (daysInFirstWeek * DAY_WIDTH) - (2 * EVENT_MARGIN);
-
-          String titleToShow = events[i].title;
-          // Only truncate if title is longer than the total span allows
-          int totalAvailableChars = (daysInCalendar * DAY_WIDTH - 6) / 7;
-          if (titleToShow.length() > totalAvailableChars) {
-            titleToShow = titleToShow.substring(0, totalAvailableChars - 3) + "...";
-          }
-
-          bool isStart = true;
-          bool isEnd = (endDay <= startDay + daysInFirstWeek - 1);
-
-          uint16_t eventColor = (currentDayNumber >= events[i].startDay && currentDayNumber <= events[i].endDay) ? GxEPD_RED : GxEPD_BLACK;
-          drawMultiDayEvent(startX, startY, eventWidth, MULTI_DAY_EVENT_HEIGHT, titleToShow, isStart, isEnd, eventColor);
-
-          // If event continues to second week, draw continuation
-          if (daysInCalendar > daysInFirstWeek && startWeek == 0) {
-            int secondWeekDays = daysInCalendar - daysInFirstWeek;
-            int secondWeekX = EVENT_MARGIN;
-            int secondWeekY = HEADER_HEIGHT + ROW_HEIGHT + DAY_NUMBER_MARGIN + (eventRows[i] * MULTI_DAY_EVENT_SPACING);
-            int secondWeekWidth = (secondWeekDays * DAY_WIDTH) - (2 * EVENT_MARGIN);
-
-            drawMultiDayEvent(secondWeekX, secondWeekY, secondWeekWidth, MULTI_DAY_EVENT_HEIGHT, "", false, true, eventColor);
-          }
-        }
-      }
+  // Half of the block for the band, the rest for the compressed rows
+  PagePlan plan = planPages(DISP_WIDTH, DISP_HEIGHT, available / 2,
+                            RENDER_MAX_PAGES, Backend::planes);
+  if (plan.pages &&
+      buffer.allocate(DISP_WIDTH, plan.bandHeight, Backend::planes))
+  {
+    CompressedFrame frame;
+    frame.begin(DISP_WIDTH, DISP_HEIGHT, Backend::planes);
+    for (int16_t top = 0; top < DISP_HEIGHT; top += plan.bandHeight)
+    {
+      buffer.setBand(top, std::min<int16_t>(plan.bandHeight, DISP_HEIGHT - top));
+      drawBand(canvas, &buffer, dl, top, top + buffer.rows());
+      hash.addBand(buffer);
+      frame.appendBand(buffer);
     }
+    Serial.printf("Rendered %d bands of %d rows in %lu ms, compressed to %u "
+                  "of %u bytes (largest free block %u bytes)\n",
+                  plan.pages, plan.bandHeight, millis() - start,
+                  (unsigned)frame.bytes(), (unsigned)frame.rawBytes(),
+                  (unsigned)largest);
+    return showFrame(frame, buffer, plan, hash);
+  }
 
-    // STEP 3: Draw day numbers and single-day events
-    for (int week = 0; week < 2; week++) {
-      int y = HEADER_HEIGHT + (week * ROW_HEIGHT);
-
-      if (week < 1) {
-        display.drawLine(0, y + ROW_HEIGHT, 800, y + ROW_HEIGHT, GxEPD_BLACK);
-      }
-
-      for (int day = 0; day < 7; day++) {
-        int x = day * DAY_WIDTH;
-        int dayNumber = calculateCalendarDay(weekStart, week, day);
-
-        // Calculate the relative day number for event comparison
-        int relativeDayNumber = (week * 7) + day + 1;
-
-        // Draw day number with red background box if current day
-        if (relativeDayNumber == currentDayNumber) {
-          // Draw red background box for current day
-          display.fillRoundRect(x + CURRENT_DAY_BOX_X_OFFSET, y + CURRENT_DAY_BOX_Y_OFFSET,
-                               CURRENT_DAY_BOX_WIDTH, CURRENT_DAY_BOX_HEIGHT, EVENT_BORDER_RADIUS, GxEPD_RED);
-          display.setTextColor(GxEPD_WHITE);
-        } else {
-          display.setTextColor(GxEPD_BLACK);
-        }
-        display.setCursor(x + DAY_NUMBER_X_OFFSET, y + DAY_NUMBER_Y_OFFSET);
-        display.print(dayNumber);
-        display.setTextColor(GxEPD_BLACK); // Reset to black
-
-        // Count how many multi-day events affect this day to know where to start single-day events
-        int multiDayCount = 0;
-        for (int i = 0; i < events.size(); i++) {
-          if (events[i].isMultiDay && relativeDayNumber >= events[i].startDay && relativeDayNumber <= events[i].endDay) {
-            if (eventRows[i] + 1 > multiDayCount) {
-              multiDayCount = eventRows[i] + 1;
-            }
-          }
-        }
-
-        // Calculate available space for single-day events
-        int dayNumberMargin = 25; // Increased to 25px for better spacing
-        int availableHeight = ROW_HEIGHT - dayNumberMargin - (multiDayCount * 30);
-
-        // Collect single-day events for this day and sort by time
-        int singleDayEventIndices[30]; // Max 30 events
-        int singleDayEventCount = 0;
-
-        for (int i = 0; i < events.size(); i++) {
-          if (!events[i].isMultiDay && events[i].startDay == relativeDayNumber) {
-            singleDayEventIndices[singleDayEventCount] = i;
-            singleDayEventCount++;
-          }
-        }
-
-        // Sort single-day events by start time (simple bubble sort)
-        for (int i = 0; i < singleDayEventCount - 1; i++) {
-          for (int j = 0; j < singleDayEventCount - i - 1; j++) {
-            String time1 = events[singleDayEventIndices[j]].startTime;
-            String time2 = events[singleDayEventIndices[j + 1]].startTime;
-
-            // Compare times (HH:MM format)
-            if (time1.compareTo(time2) > 0) {
-              int temp = singleDayEventIndices[j];
-              singleDayEventIndices[j] = singleDayEventIndices[j + 1];
-              singleDayEventIndices[j + 1] = temp;
-            }
-          }
-        }
-
-        // Draw single-day events starting after all multi-day events
-        int eventY = y + dayNumberMargin + (multiDayCount * 30);
-        int singleDayEventsDrawn = 0;
-
-        // Calculate how many events we can actually show
-        // Simple approach: calculate how many full events fit, then check if we can add one reduced
-        int maxFullEvents = availableHeight / SINGLE_DAY_EVENT_SPACING;
-        int eventsToShow;
-
-        if (singleDayEventCount <= maxFullEvents) {
-          // All events fit with full height
-          eventsToShow = singleDayEventCount;
-        } else {
-          // Not all events fit - check if we can show maxFullEvents-1 full + 1 reduced + overflow
-          int spaceForReduced = ((maxFullEvents - 1) * SINGLE_DAY_EVENT_SPACING) +
-                               (SINGLE_DAY_EVENT_HEIGHT_REDUCED + 2) +
-                               OVERFLOW_TEXT_SPACING;
-
-          if (spaceForReduced <= availableHeight && maxFullEvents > 0) {
-            // We can fit maxFullEvents-1 full + 1 reduced + overflow text
-            eventsToShow = maxFullEvents;
-          } else {
-            // Show maxFullEvents-1 full events + overflow (no reduced event)
-            eventsToShow = max(1, maxFullEvents - 1);
-          }
-        }
-
-        for (int i = 0; i < eventsToShow; i++) {
-          int eventWidth = DAY_WIDTH - (2 * EVENT_MARGIN);
-          int eventX = x + EVENT_MARGIN;
-          int eventIndex = singleDayEventIndices[i];
-
-          // Determine if this is the last event and there's overflow
-          bool isLastEventWithOverflow = (i == eventsToShow - 1 && singleDayEventCount > eventsToShow);
-          bool singleLineMode = isLastEventWithOverflow;
-          int eventHeight = isLastEventWithOverflow ? SINGLE_DAY_EVENT_HEIGHT_REDUCED : SINGLE_DAY_EVENT_HEIGHT;
-
-          uint16_t singleEventColor = (relativeDayNumber == currentDayNumber) ? GxEPD_RED : GxEPD_BLACK;
-          drawSingleDayEvent(eventX, eventY, eventWidth, eventHeight,
-                            events[eventIndex].startTime, events[eventIndex].endTime, events[eventIndex].title, singleEventColor, singleLineMode);
-
-          if (isLastEventWithOverflow) {
-            // For reduced height event, use smaller spacing
-            eventY += SINGLE_DAY_EVENT_HEIGHT_REDUCED + 2; // 2px margin
-          } else {
-            eventY += SINGLE_DAY_EVENT_SPACING;
-          }
-          singleDayEventsDrawn++;
-        }
-
-        // Show overflow indicator if there are more events than we could display
-        if (singleDayEventCount > eventsToShow) {
-          int remainingEvents = singleDayEventCount - eventsToShow;
-          display.setTextColor(GxEPD_BLACK);
-          display.setFont(&DongleLight9pt7b);
-          display.setCursor(x + EVENT_MARGIN, eventY + OVERFLOW_TEXT_Y_OFFSET);
-          display.print(String(remainingEvents) + " more events...");
-          // Reset font back to default for subsequent day numbers
-          display.setFont(&DongleLight15pt7b);
-        }
-      }
+  // The page buffer is sent as it is drawn, so the frame can't be compared
+  panel.valid = false;
+  int16_t top = 0;
+  do
+  {
+    drawBand(display, nullptr, dl, top, top + display.pageHeight());
+    top += display.pageHeight();
+    if (top >= DISP_HEIGHT)
+    {
+      markPhase(PHASE_REFRESH);  // the last nextPage() refreshes the panel
     }
-}
-
-/* This function is responsible for drawing the status bar along the bottom of
- * the display.
+  } while (display.nextPage());
+  Serial.printf("Rendered %d pages of the display buffer in %lu ms "
+                "(largest free block %u bytes)\n",
+                display.pages(), millis() - start, (unsigned)largest);
+  return true;
+} // end drawDisplayList
+
+/* Refreshes the panel with a frame rendered off-device, see thin-client mode
+ * in config.h. The frame is hashed and compared with the panel like a
+ * rendered one; only a band or two of it is ever decoded at a time.
  */
-void drawStatusBar(const String &refreshTimeStr,
-                   int rssi, uint32_t batVoltage)
+bool drawCompressedFrame(const CompressedFrame &frame)
 {
-  String dataStr;
-  uint16_t dataColor = GxEPD_BLACK;
-  display.setFont(&DongleLight9pt7b);
-  int pos = DISP_WIDTH - 2;
-  const int sp = 2;
-
-#if BATTERY_MONITORING
-  // battery - (expecting 3.7v LiPo)
-  uint32_t batPercent = calcBatPercent(batVoltage,
-                                       MIN_BATTERY_VOLTAGE,
-                                       MAX_BATTERY_VOLTAGE);
-  if (batVoltage < WARN_BATTERY_VOLTAGE)
-  {
-    dataColor = ACCENT_COLOR;
-  }
-  dataStr = String(batPercent) + "%";
-  dataStr += " (" + String( std::round(batVoltage / 10.f) / 100.f, 2 ) + "v)";
-  drawString(pos, DISP_HEIGHT - 1 - 2, dataStr, RIGHT, dataColor);
-  pos -= getStringWidth(dataStr) + 25;
-  display.drawInvertedBitmap(pos, DISP_HEIGHT - 1 - 17,
-                             getBatBitmap24(batPercent), 24, 24, dataColor);
-  pos -= sp + 9;
-#endif
-
-  // WiFi
-  dataStr = String(getWiFidesc(rssi));
-  dataColor = rssi >= -70 ? GxEPD_BLACK : ACCENT_COLOR;
-  if (rssi != 0)
-  {
-    dataStr += " (" + String(rssi) + "dBm)";
-  }
-  // Calculate positions: icon first, then text to its right
-  int wifiIconPos = pos - getStringWidth(dataStr) - 19;
-  int wifiTextPos = wifiIconPos + 16 + 3; // icon width + small margin
-  display.drawInvertedBitmap(wifiIconPos, DISP_HEIGHT - 1 - 13, getWiFiBitmap16(rssi),
-                             16, 16, dataColor);
-  drawString(wifiTextPos, DISP_HEIGHT - 1 - 2, dataStr, LEFT, dataColor);
-  pos = wifiIconPos - sp;
-
-  // last refresh
-  dataColor = GxEPD_BLACK;
-  drawString(pos, DISP_HEIGHT - 1 - 2, refreshTimeStr, RIGHT, dataColor);
-  pos -= getStringWidth(refreshTimeStr) + 25;
-  display.drawInvertedBitmap(pos, DISP_HEIGHT - 1 - 21, wi_refresh_32x32,
-                             32, 32, dataColor);
-  pos -= sp;
-  return;
-} // end drawStatusBar
+  if (frame.width() != DISP_WIDTH || frame.height() != DISP_HEIGHT ||
+      frame.planes() != Backend::planes)
+  {
+    Serial.printf("Frame of %dx%d with %d planes doesn't fit the panel\n",
+                  frame.width(), frame.height(), frame.planes());
+    return false;
+  }
+  unsigned long start = millis();
+  size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+  size_t available = largest > RENDER_HEAP_RESERVE
+                         ? largest - RENDER_HEAP_RESERVE : 0;
+  // Half of the block for each of two bands
+  PagePlan plan = planPages(DISP_WIDTH, DISP_HEIGHT, available / 2,
+                            RENDER_MAX_PAGES, Backend::planes);
+  BandBuffer buffer;
+  if (!plan.pages ||
+      !buffer.allocate(DISP_WIDTH, plan.bandHeight, Backend::planes))
+  {
+    Serial.printf("No room for a band (largest free block %u bytes)\n",
+                  (unsigned)largest);
+    return false;
+  }
 
+  DisplayRect regions[FRAME_MAX_REGIONS];
+  FrameHash hash;
+  hash.begin(regions, layoutRegions(regions));
+  for (int16_t top = 0; top < DISP_HEIGHT; top += plan.bandHeight)
+  {
+    buffer.setBand(top, std::min<int16_t>(plan.bandHeight, DISP_HEIGHT - top));
+    frame.decodeBand(buffer);
+    hash.addBand(buffer);
+  }
+  Serial.printf("Hashed %u bytes of frame in %d bands in %lu ms\n",
+                (unsigned)frame.bytes(), plan.pages, millis() - start);
+  showFrame(frame, buffer, plan, hash);
+  return true;
+}
 
-/* This function is responsible for drawing prominent error messages to the
- * screen.
- *
- * If error message line 2 (errMsgLn2) is empty, line 1 will be automatically
- * wrapped.
- */
-void drawError(const uint8_t *bitmap_196x196,
-               const String &errMsgLn1, const String &errMsgLn2)
-{
-  display.setTextColor(GxEPD_BLACK);
-  display.setFont(&DongleLight15pt7b);
-  if (!errMsgLn2.isEmpty())
-  {
-    drawString(DISP_WIDTH / 2,
-               DISP_HEIGHT / 2 + 196 / 2 + 21,
-               errMsgLn1, CENTER);
-    drawString(DISP_WIDTH / 2,
-               DISP_HEIGHT / 2 + 196 / 2 + 21 + 55,
-               errMsgLn2, CENTER);
-  }
-  else
-  {
-    drawMultiLnString(DISP_WIDTH / 2,
-                      DISP_HEIGHT / 2 + 196 / 2 + 21,
-                      errMsgLn1, CENTER, DISP_WIDTH - 200, 2, 55);
-  }
-  display.drawInvertedBitmap(DISP_WIDTH / 2 - 196 / 2,
-                             DISP_HEIGHT / 2 - 196 / 2 - 21,
-                             bitmap_196x196, 196, 196, ACCENT_COLOR);
-  return;
-} // end drawError
\ No newline at end of file
+void powerOffDisplay() {
+  if (Backend::fastPartialUpdate)
+  {
+    // Hibernating would lose the previous frame the next fast partial
+    // update compares against: only power off, and keep RST high so the
+    // controller isn't reset while the ESP32 sleeps
+    display.powerOff();
+    gpio_hold_en(static_cast<gpio_num_t>(EPD_RST));
+    gpio_deep_sleep_hold_en();
+    return;
+  }
+  display.hibernate(); // turns powerOff() and sets controller to deep sleep for
+                       // minimum power use
+}
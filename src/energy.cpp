@@ -0,0 +1,144 @@
+#include "energy.h"
+
+// Microcoulombs in a milliamp hour
+#define UC_PER_MAH 3600000ULL
+
+/* Clears the counts since the last charge. The stretch and the phases of
+ * the running wake are kept. Without the time, the charge is dated to the
+ * last wake that had one, and the sleep since then is booked against it
+ * with the running wake, so no time is lost.
+ */
+void energyRestart(EnergyLedger &ledger, uint32_t now)
+{
+  ledger.usedUc = 0;
+  if (now)
+  {
+    ledger.lastTime = now;
+  }
+  ledger.chargedAt = ledger.lastTime;
+  ledger.windowUc = 0;
+  ledger.windowS = 0;
+  if (!ledger.stretch)
+  {
+    ledger.stretch = 100;
+  }
+}
+
+void energyAddPhase(EnergyLedger &ledger, power_phase_t phase,
+                    cpu_clock_t clock, uint32_t ms)
+{
+  ledger.phaseMs[phase] += ms;
+  // The panel refresh is spent in light sleep, where a lower clock saves
+  // next to nothing
+  if (phase != PHASE_REFRESH)
+  {
+    ledger.clockMs[clock] += ms;
+  }
+}
+
+void energyAddStep(EnergyLedger &ledger, uint32_t atMs, power_phase_t phase,
+                   cpu_clock_t clock)
+{
+  if (ledger.profileSteps < PROFILE_STEPS)
+  {
+    ClockStep &step = ledger.profile[ledger.profileSteps++];
+    step.atMs = atMs;
+    step.phase = phase;
+    step.clock = clock;
+  }
+}
+
+uint32_t energyTargetUa(const EnergyLedger &ledger, const EnergyModel &model,
+                        uint32_t now)
+{
+  const uint64_t capacity = model.capacityMah * UC_PER_MAH;
+  const uint32_t end = ledger.chargedAt + model.targetDays * 86400u;
+  if (ledger.usedUc >= capacity || now >= end)
+  {
+    return 1;
+  }
+  const uint64_t target = (capacity - ledger.usedUc) / (end - now);
+  return target > 1 ? (uint32_t)target : 1;
+}
+
+/* Books the wake charge, less what the lower clocks saved, and the sleep
+ * since lastTime. Wakes without a valid time only record phases, they are
+ * booked with the next one that has it.
+ * Once ENERGY_WINDOW seconds are booked the stretch moves by the ratio of
+ * the average current to the target, at most halving or doubling; the sleep
+ * current doesn't change with it, so it takes a few windows to settle.
+ */
+void energySettle(EnergyLedger &ledger, const EnergyModel &model,
+                  uint32_t now)
+{
+  if (!ledger.stretch)
+  {
+    energyRestart(ledger, now);
+  }
+  uint64_t wake = 0;
+  for (int p = 0; p < PHASE_COUNT; p++)
+  {
+    wake += (uint64_t)ledger.phaseMs[p] * model.phaseMa[p];
+    ledger.phaseMs[p] = 0;
+  }
+  uint64_t saved = 0;
+  for (int c = 0; c < CLOCK_COUNT; c++)
+  {
+    saved += (uint64_t)ledger.clockMs[c] * model.clockSavingMa[c];
+    ledger.clockMs[c] = 0;
+  }
+  wake = saved < wake ? wake - saved : 0;
+  ledger.profileSteps = 0;
+  ledger.lastWakeUc = (uint32_t)wake;
+  ledger.lastSavedUc = (uint32_t)saved;
+  ledger.usedUc += wake;
+  ledger.windowUc += wake;
+  if (!now)
+  {
+    return;
+  }
+  if (!ledger.chargedAt)
+  {
+    ledger.chargedAt = now;
+  }
+  if (ledger.lastTime && now > ledger.lastTime)
+  {
+    const uint32_t slept = now - ledger.lastTime;
+    ledger.usedUc += (uint64_t)slept * model.sleepUa;
+    ledger.windowUc += (uint64_t)slept * model.sleepUa;
+    ledger.windowS += slept;
+  }
+  ledger.lastTime = now;
+
+  if (!model.targetDays)
+  {
+    ledger.stretch = 100;
+    return;
+  }
+  if (ledger.windowS < ENERGY_WINDOW)
+  {
+    return;
+  }
+  const uint64_t averageUa = ledger.windowUc / ledger.windowS;
+  const uint64_t targetUa = energyTargetUa(ledger, model, now);
+  uint64_t stretch = ledger.stretch * averageUa / targetUa;
+  if (stretch < ledger.stretch / 2u)
+  {
+    stretch = ledger.stretch / 2u;
+  }
+  if (stretch > ledger.stretch * 2u)
+  {
+    stretch = ledger.stretch * 2u;
+  }
+  if (stretch < MIN_STRETCH)
+  {
+    stretch = MIN_STRETCH;
+  }
+  if (stretch > MAX_STRETCH)
+  {
+    stretch = MAX_STRETCH;
+  }
+  ledger.stretch = (uint16_t)stretch;
+  ledger.windowUc = 0;
+  ledger.windowS = 0;
+} // end energySettle
@@ -0,0 +1,91 @@
+#ifndef ENERGY_H
+#define ENERGY_H
+
+#include <stdint.h>
+
+/* Estimates the charge drawn from the battery, from how long each phase of a
+ * wake took and the current that phase draws, plus the sleep current in
+ * between, and stretches the refresh intervals so that a charge lasts the
+ * target lifetime. Charges are in microcoulombs, which are mA x ms or
+ * uA x s.
+ */
+
+// Phases of a wake, each drawing its own current
+typedef enum power_phase
+{
+  PHASE_BOOT,     // from reset until WiFi starts
+  PHASE_WIFI,     // connecting
+  PHASE_HTTP,     // fetching the calendar or frame
+  PHASE_PARSE,    // decoding what was fetched
+  PHASE_RENDER,   // layout, rendering bands and the panel transfer
+  PHASE_REFRESH,  // the panel refresh, waiting on BUSY
+  PHASE_COUNT
+} power_phase_t;
+
+// CPU clocks a phase can run at
+typedef enum cpu_clock
+{
+  CLOCK_80MHZ,
+  CLOCK_160MHZ,
+  CLOCK_240MHZ,
+  CLOCK_COUNT
+} cpu_clock_t;
+
+// Clock changes kept of a wake
+#define PROFILE_STEPS 16
+
+// A clock change at atMs after reset, to the clock of phase
+struct ClockStep {
+  uint32_t atMs;
+  uint8_t phase;
+  uint8_t clock;
+};
+
+// Every ENERGY_WINDOW seconds the stretch is adjusted
+#define ENERGY_WINDOW 86400
+// Percent of the scheduled intervals, 25% to 16 times
+#define MIN_STRETCH 25
+#define MAX_STRETCH 1600
+
+struct EnergyModel {
+  uint16_t phaseMa[PHASE_COUNT];          // at 240 MHz
+  uint16_t clockSavingMa[CLOCK_COUNT];    // drawn less than at 240 MHz
+  uint16_t sleepUa;
+  uint32_t capacityMah;
+  uint16_t targetDays;    // lifetime per charge, 0 keeps the schedule
+};
+
+// Kept in RTC memory across deep sleep
+struct EnergyLedger {
+  uint32_t phaseMs[PHASE_COUNT];  // not yet booked
+  uint32_t clockMs[CLOCK_COUNT];  // the same time by CPU clock, no refresh
+  ClockStep profile[PROFILE_STEPS];  // clock changes not yet booked
+  uint8_t profileSteps;
+  uint64_t usedUc;                // since the last charge
+  uint32_t chargedAt;             // time of the last charge, in seconds
+  uint32_t lastTime;              // of the last booking, 0 before the first
+  uint64_t windowUc;              // since the stretch was adjusted
+  uint32_t windowS;
+  uint32_t lastWakeUc;            // the phases of the last booking
+  uint32_t lastSavedUc;           // what their clocks saved over 240 MHz
+  uint16_t stretch;               // percent applied to refresh intervals
+};
+
+// Starts a ledger for a freshly charged battery at now (seconds, 0 if
+// unknown: then at the last time booked), keeping the stretch learnt so far
+void energyRestart(EnergyLedger &ledger, uint32_t now);
+void energyAddPhase(EnergyLedger &ledger, power_phase_t phase,
+                    cpu_clock_t clock, uint32_t ms);
+// Records a clock change in the wake profile
+void energyAddStep(EnergyLedger &ledger, uint32_t atMs, power_phase_t phase,
+                   cpu_clock_t clock);
+// Books the phases recorded since the last call and the sleep until now,
+// clears the profile and adjusts the stretch once a window is full
+void energySettle(EnergyLedger &ledger, const EnergyModel &model,
+                  uint32_t now);
+// Average current in microamps that drains what is left of the charge in
+// what is left of the target lifetime
+uint32_t energyTargetUa(const EnergyLedger &ledger, const EnergyModel &model,
+                        uint32_t now);
+
+#endif // ENERGY_H
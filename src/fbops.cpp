@@ -0,0 +1,287 @@
+#include "fbops.h"
+#include "fbops_kernels.h"
+#include <string.h>
+
+// Word loads and stores of pointers known to be 4 byte aligned; Xtensa
+// faults on unaligned 32-bit accesses
+static inline uint32_t loadWord(const uint8_t *p)
+{
+  uint32_t word;
+  memcpy(&word, __builtin_assume_aligned(p, 4), 4);
+  return word;
+}
+
+static inline void storeWord(uint8_t *p, uint32_t word)
+{
+  memcpy(__builtin_assume_aligned(p, 4), &word, 4);
+}
+
+static inline bool aligned(const void *p)
+{
+  return ((uintptr_t)p & 3) == 0;
+}
+
+static void fillPortable(uint8_t *dst, uint8_t value, size_t length)
+{
+  for (; length && !aligned(dst); length--)
+  {
+    *dst++ = value;
+  }
+  const uint32_t word = value * 0x01010101u;
+  for (; length >= 4; length -= 4, dst += 4)
+  {
+    storeWord(dst, word);
+  }
+  for (; length; length--)
+  {
+    *dst++ = value;
+  }
+}
+
+static bool xorDiffPortable(uint8_t *dst, const uint8_t *a, const uint8_t *b,
+                            size_t length)
+{
+  size_t i = 0;
+  uint32_t diff = 0;
+  // Words only when all three reach a word boundary at the same byte, as
+  // rows of the same width do
+  uintptr_t offset = (uintptr_t)a & 3;
+  if (((uintptr_t)b & 3) == offset &&
+      (!dst || ((uintptr_t)dst & 3) == offset))
+  {
+    for (; i < length && !aligned(a + i); i++)
+    {
+      uint8_t x = a[i] ^ b[i];
+      diff |= x;
+      if (dst)
+      {
+        dst[i] = x;
+      }
+    }
+    for (; i + 4 <= length; i += 4)
+    {
+      uint32_t x = loadWord(a + i) ^ loadWord(b + i);
+      diff |= x;
+      if (dst)
+      {
+        storeWord(dst + i, x);
+      }
+    }
+  }
+  for (; i < length; i++)
+  {
+    uint8_t x = a[i] ^ b[i];
+    diff |= x;
+    if (dst)
+    {
+      dst[i] = x;
+    }
+  }
+  return diff != 0;
+} // end xorDiffPortable
+
+static inline uint32_t popcountWord(uint32_t v)
+{
+  v = v - ((v >> 1) & 0x55555555u);
+  v = (v & 0x33333333u) + ((v >> 2) & 0x33333333u);
+  return (((v + (v >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24;
+}
+
+static size_t popcountPortable(const uint8_t *data, size_t length)
+{
+  size_t count = 0;
+  size_t i = 0;
+  for (; i < length && !aligned(data + i); i++)
+  {
+    count += popcountWord(data[i]);
+  }
+  for (; i + 4 <= length; i += 4)
+  {
+    count += popcountWord(loadWord(data + i));
+  }
+  for (; i < length; i++)
+  {
+    count += popcountWord(data[i]);
+  }
+  return count;
+}
+
+static size_t findBytePortable(const uint8_t *data, size_t length,
+                               uint8_t value, bool equal)
+{
+  size_t i = 0;
+  for (; i < length && !aligned(data + i); i++)
+  {
+    if ((data[i] == value) == equal)
+    {
+      return i;
+    }
+  }
+  // Skips words without a match, the byte loop below finds it in the word
+  const uint32_t pattern = value * 0x01010101u;
+  for (; i + 4 <= length; i += 4)
+  {
+    uint32_t x = loadWord(data + i) ^ pattern;
+    bool match = equal ? ((x - 0x01010101u) & ~x & 0x80808080u) != 0
+                       : x != 0;
+    if (match)
+    {
+      break;
+    }
+  }
+  for (; i < length; i++)
+  {
+    if ((data[i] == value) == equal)
+    {
+      return i;
+    }
+  }
+  return length;
+} // end findBytePortable
+
+static uint32_t hashBlocksPortable(uint32_t hash, const uint8_t *data,
+                                   size_t blocks)
+{
+  uint32_t lanes[FB_HASH_LANES];
+  for (int j = 0; j < FB_HASH_LANES; j++)
+  {
+    lanes[j] = hash ^ j;
+  }
+  for (; blocks; blocks--, data += FB_HASH_BLOCK)
+  {
+    for (int j = 0; j < FB_HASH_LANES; j++)
+    {
+      const uint8_t *p = data + 4 * j;
+      uint32_t word = p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+      lanes[j] = (lanes[j] ^ word) * FNV_PRIME;
+    }
+  }
+  return fbFoldLanes(hash, lanes);
+}
+
+const FbKernels fbPortableKernels = {
+  fillPortable,
+  xorDiffPortable,
+  popcountPortable,
+  findBytePortable,
+  hashBlocksPortable
+};
+
+#if FB_HAVE_X86
+static const FbKernels *active = nullptr;
+static fb_impl_t activeImpl = FB_PORTABLE;
+
+static const FbKernels &kernels()
+{
+  if (!active)
+  {
+    fbUseImpl(FB_AVX2) || fbUseImpl(FB_SSE2) || fbUseImpl(FB_PORTABLE);
+  }
+  return *active;
+}
+
+fb_impl_t fbImpl()
+{
+  kernels();
+  return activeImpl;
+}
+
+bool fbUseImpl(fb_impl_t impl)
+{
+  __builtin_cpu_init();
+  const FbKernels *chosen = nullptr;
+  switch (impl)
+  {
+  case FB_PORTABLE:
+    chosen = &fbPortableKernels;
+    break;
+  case FB_SSE2:
+    chosen = __builtin_cpu_supports("sse2") ? &fbSse2Kernels : nullptr;
+    break;
+  case FB_AVX2:
+    chosen = __builtin_cpu_supports("avx2") ? &fbAvx2Kernels : nullptr;
+    break;
+  }
+  if (!chosen)
+  {
+    return false;
+  }
+  active = chosen;
+  activeImpl = impl;
+  return true;
+}
+#else
+// Only the portable kernels, called directly
+static inline const FbKernels &kernels()
+{
+  return fbPortableKernels;
+}
+
+fb_impl_t fbImpl()
+{
+  return FB_PORTABLE;
+}
+
+bool fbUseImpl(fb_impl_t impl)
+{
+  return impl == FB_PORTABLE;
+}
+#endif
+
+void fbFillBits(uint8_t *row, int32_t from, int32_t to, bool set)
+{
+  if (from >= to)
+  {
+    return;
+  }
+  int32_t first = from >> 3;
+  int32_t last = (to - 1) >> 3;
+  uint8_t headMask = 0xFF >> (from & 7);
+  uint8_t tailMask = 0xFF << (7 - ((to - 1) & 7));
+  if (first == last)
+  {
+    headMask &= tailMask;
+  }
+  row[first] = set ? row[first] | headMask : row[first] & ~headMask;
+  if (first == last)
+  {
+    return;
+  }
+  if (last - first > 1)
+  {
+    kernels().fill(row + first + 1, set ? 0xFF : 0x00, last - first - 1);
+  }
+  row[last] = set ? row[last] | tailMask : row[last] & ~tailMask;
+}
+
+bool fbXorDiff(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t length)
+{
+  return kernels().xorDiff(dst, a, b, length);
+}
+
+size_t fbPopcount(const uint8_t *data, size_t length)
+{
+  return kernels().popcount(data, length);
+}
+
+FbRun fbFindRun(const uint8_t *data, size_t length, uint8_t background)
+{
+  FbRun run;
+  run.start = kernels().findByte(data, length, background, false);
+  run.end = run.start + kernels().findByte(data + run.start,
+                                           length - run.start, background,
+                                           true);
+  return run;
+}
+
+uint32_t fbHash(uint32_t hash, const uint8_t *data, size_t length)
+{
+  size_t blocks = length / FB_HASH_BLOCK;
+  if (blocks)
+  {
+    hash = kernels().hashBlocks(hash, data, blocks);
+    data += blocks * FB_HASH_BLOCK;
+    length -= blocks * FB_HASH_BLOCK;
+  }
+  return fnv1a(hash, data, length);
+}
@@ -0,0 +1,71 @@
+#ifndef FBOPS_H
+#define FBOPS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Operations on the 1 bit per pixel planes of a frame: span fills, diffs,
+ * bit counts, finding runs and hashing. Band rendering, the compressed and
+ * delta frames and the frame hash all share them.
+ *
+ * The portable kernels work on 32-bit words, the width of the ESP32's Xtensa
+ * cores. On x86, where the native tests and tools run, SSE2 and AVX2 kernels
+ * are picked at run time from what the CPU supports. Every kernel gives the
+ * same result, so a hash taken on the device matches one taken by a tool.
+ */
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME        16777619u
+
+// FNV-1a over length bytes, continuing from hash
+inline uint32_t fnv1a(uint32_t hash, const uint8_t *data, size_t length)
+{
+  for (size_t i = 0; i < length; i++)
+  {
+    hash = (hash ^ data[i]) * FNV_PRIME;
+  }
+  return hash;
+}
+
+typedef enum fb_impl {
+  FB_PORTABLE,    // 32-bit words, everywhere
+  FB_SSE2,        // 16 bytes, x86 only
+  FB_AVX2         // 32 bytes, x86 only
+} fb_impl_t;
+
+// Kernels in use, the best the CPU supports unless fbUseImpl() picked others
+fb_impl_t fbImpl();
+// Switches to the kernels of impl, for tests and benchmarks. Returns false,
+// keeping the current ones, if the CPU or build doesn't support them.
+bool fbUseImpl(fb_impl_t impl);
+
+// Sets bits [from, to) of an MSB first row to 1, or clears them
+void fbFillBits(uint8_t *row, int32_t from, int32_t to, bool set);
+
+// dst = a ^ b over length bytes and returns true if any byte differs. dst
+// may be a or b, or nullptr to only compare.
+bool fbXorDiff(uint8_t *dst, const uint8_t *a, const uint8_t *b, size_t length);
+
+// Number of set bits
+size_t fbPopcount(const uint8_t *data, size_t length);
+
+// First run of bytes other than background: [start, end), both length if
+// every byte is background
+struct FbRun {
+  size_t start;
+  size_t end;
+};
+FbRun fbFindRun(const uint8_t *data, size_t length, uint8_t background);
+
+/* Hash of length bytes continuing from hash, FNV-1a based. Whole 32 byte
+ * blocks are hashed as 8 lanes of little endian words, each lane its own
+ * FNV-1a, folded into hash afterwards; the bytes after the last block, and
+ * inputs shorter than a block, are plain FNV-1a. Lanes have no dependency
+ * on each other, which lets vector units and the Xtensa pipeline overlap
+ * their multiplies. Start from FNV_OFFSET_BASIS.
+ */
+#define FB_HASH_LANES 8
+#define FB_HASH_BLOCK (FB_HASH_LANES * 4)
+uint32_t fbHash(uint32_t hash, const uint8_t *data, size_t length);
+
+#endif // FBOPS_H
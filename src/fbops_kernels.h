@@ -0,0 +1,46 @@
+#ifndef FBOPS_KERNELS_H
+#define FBOPS_KERNELS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "fbops.h"
+
+/* One implementation of the fbops kernels, see fbops.h. Only fbops.cpp and
+ * the kernel files use this.
+ */
+
+struct FbKernels {
+  // Sets length bytes to value
+  void (*fill)(uint8_t *dst, uint8_t value, size_t length);
+  bool (*xorDiff)(uint8_t *dst, const uint8_t *a, const uint8_t *b,
+                  size_t length);
+  size_t (*popcount)(const uint8_t *data, size_t length);
+  // Index of the first byte that equals value, or that doesn't if !equal;
+  // length if there is none
+  size_t (*findByte)(const uint8_t *data, size_t length, uint8_t value,
+                     bool equal);
+  // Hashes blocks whole FB_HASH_BLOCK byte blocks: seeds the lanes from
+  // hash, runs them and folds them into hash
+  uint32_t (*hashBlocks)(uint32_t hash, const uint8_t *data, size_t blocks);
+};
+
+extern const FbKernels fbPortableKernels;
+#if defined(__x86_64__) || defined(__i386__)
+#define FB_HAVE_X86 1
+extern const FbKernels fbSse2Kernels;
+extern const FbKernels fbAvx2Kernels;
+#else
+#define FB_HAVE_X86 0
+#endif
+
+// Folds the lanes of fbHash() into hash
+inline uint32_t fbFoldLanes(uint32_t hash, const uint32_t *lanes)
+{
+  for (int j = 0; j < FB_HASH_LANES; j++)
+  {
+    hash = (hash ^ lanes[j]) * FNV_PRIME;
+  }
+  return hash;
+}
+
+#endif // FBOPS_KERNELS_H
@@ -0,0 +1,314 @@
+#include "fbops.h"
+#include "fbops_kernels.h"
+
+#if FB_HAVE_X86
+#include <immintrin.h>
+#include <string.h>
+
+/* SSE2 and AVX2 kernels for the native build. Each function is compiled for
+ * its instruction set with a target attribute, so the file builds with the
+ * default flags and fbops.cpp only calls it once the CPU reported support.
+ * Bytes after the last whole vector are done one at a time.
+ */
+
+#define SSE2 __attribute__((target("sse2")))
+#define AVX2 __attribute__((target("avx2")))
+
+/* Fills fewer than 16 bytes with two overlapping stores. Spans of event
+ * boxes are this short, so fills end here more often than in the loops.
+ */
+static inline void fillShort(uint8_t *dst, uint8_t value, size_t length)
+{
+  const uint64_t v = value * 0x0101010101010101ull;
+  if (length >= 8)
+  {
+    memcpy(dst, &v, 8);
+    memcpy(dst + length - 8, &v, 8);
+  }
+  else if (length >= 4)
+  {
+    memcpy(dst, &v, 4);
+    memcpy(dst + length - 4, &v, 4);
+  }
+  else
+  {
+    for (size_t i = 0; i < length; i++)
+    {
+      dst[i] = value;
+    }
+  }
+}
+
+// Fills 16 or more bytes, the last vector overlapping the one before
+SSE2 static void fillSse2(uint8_t *dst, uint8_t value, size_t length)
+{
+  if (length < 16)
+  {
+    fillShort(dst, value, length);
+    return;
+  }
+  const __m128i v = _mm_set1_epi8((char)value);
+  for (size_t i = 0; i + 16 < length; i += 16)
+  {
+    _mm_storeu_si128((__m128i *)(dst + i), v);
+  }
+  _mm_storeu_si128((__m128i *)(dst + length - 16), v);
+}
+
+SSE2 static bool xorDiffSse2(uint8_t *dst, const uint8_t *a, const uint8_t *b,
+                             size_t length)
+{
+  __m128i diff = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16)
+  {
+    __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)(a + i)),
+                              _mm_loadu_si128((const __m128i *)(b + i)));
+    diff = _mm_or_si128(diff, x);
+    if (dst)
+    {
+      _mm_storeu_si128((__m128i *)(dst + i), x);
+    }
+  }
+  __m128i zero = _mm_cmpeq_epi8(diff, _mm_setzero_si128());
+  bool differs = _mm_movemask_epi8(zero) != 0xFFFF;
+  for (; i < length; i++)
+  {
+    uint8_t x = a[i] ^ b[i];
+    differs |= x != 0;
+    if (dst)
+    {
+      dst[i] = x;
+    }
+  }
+  return differs;
+}
+
+// Bits set in each byte of v
+SSE2 static inline __m128i popcountBytesSse2(__m128i v)
+{
+  const __m128i m1 = _mm_set1_epi8(0x55);
+  const __m128i m2 = _mm_set1_epi8(0x33);
+  const __m128i m4 = _mm_set1_epi8(0x0F);
+  v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi16(v, 1), m1));
+  v = _mm_add_epi8(_mm_and_si128(v, m2),
+                   _mm_and_si128(_mm_srli_epi16(v, 2), m2));
+  return _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi16(v, 4)), m4);
+}
+
+SSE2 static size_t popcountSse2(const uint8_t *data, size_t length)
+{
+  __m128i sums = _mm_setzero_si128();
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16)
+  {
+    __m128i v = popcountBytesSse2(_mm_loadu_si128((const __m128i *)(data + i)));
+    sums = _mm_add_epi64(sums, _mm_sad_epu8(v, _mm_setzero_si128()));
+  }
+  uint64_t parts[2];
+  _mm_storeu_si128((__m128i *)parts, sums);
+  size_t count = parts[0] + parts[1];
+  for (; i < length; i++)
+  {
+    count += __builtin_popcount(data[i]);
+  }
+  return count;
+}
+
+SSE2 static size_t findByteSse2(const uint8_t *data, size_t length,
+                                uint8_t value, bool equal)
+{
+  const __m128i pattern = _mm_set1_epi8((char)value);
+  const int flip = equal ? 0 : 0xFFFF;
+  size_t i = 0;
+  for (; i + 16 <= length; i += 16)
+  {
+    __m128i v = _mm_loadu_si128((const __m128i *)(data + i));
+    int matches = _mm_movemask_epi8(_mm_cmpeq_epi8(v, pattern)) ^ flip;
+    if (matches)
+    {
+      return i + __builtin_ctz(matches);
+    }
+  }
+  for (; i < length; i++)
+  {
+    if ((data[i] == value) == equal)
+    {
+      return i;
+    }
+  }
+  return length;
+}
+
+// Low 32 bits of the products of the 32-bit lanes; SSE2 only multiplies
+// every other lane, to 64 bits
+SSE2 static inline __m128i mulloSse2(__m128i a, __m128i b)
+{
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+SSE2 static uint32_t hashBlocksSse2(uint32_t hash, const uint8_t *data,
+                                    size_t blocks)
+{
+  const __m128i prime = _mm_set1_epi32((int)FNV_PRIME);
+  const __m128i seed = _mm_set1_epi32((int)hash);
+  __m128i lo = _mm_xor_si128(seed, _mm_setr_epi32(0, 1, 2, 3));
+  __m128i hi = _mm_xor_si128(seed, _mm_setr_epi32(4, 5, 6, 7));
+  for (; blocks; blocks--, data += FB_HASH_BLOCK)
+  {
+    lo = mulloSse2(_mm_xor_si128(lo, _mm_loadu_si128((const __m128i *)data)),
+                   prime);
+    hi = mulloSse2(
+        _mm_xor_si128(hi, _mm_loadu_si128((const __m128i *)(data + 16))),
+        prime);
+  }
+  uint32_t lanes[FB_HASH_LANES];
+  _mm_storeu_si128((__m128i *)lanes, lo);
+  _mm_storeu_si128((__m128i *)(lanes + 4), hi);
+  return fbFoldLanes(hash, lanes);
+}
+
+const FbKernels fbSse2Kernels = {
+  fillSse2,
+  xorDiffSse2,
+  popcountSse2,
+  findByteSse2,
+  hashBlocksSse2
+};
+
+AVX2 static void fillAvx2(uint8_t *dst, uint8_t value, size_t length)
+{
+  if (length < 32)
+  {
+    fillSse2(dst, value, length);
+    return;
+  }
+  const __m256i v = _mm256_set1_epi8((char)value);
+  for (size_t i = 0; i + 32 < length; i += 32)
+  {
+    _mm256_storeu_si256((__m256i *)(dst + i), v);
+  }
+  _mm256_storeu_si256((__m256i *)(dst + length - 32), v);
+}
+
+AVX2 static bool xorDiffAvx2(uint8_t *dst, const uint8_t *a, const uint8_t *b,
+                             size_t length)
+{
+  __m256i diff = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32)
+  {
+    __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i *)(a + i)),
+                                 _mm256_loadu_si256((const __m256i *)(b + i)));
+    diff = _mm256_or_si256(diff, x);
+    if (dst)
+    {
+      _mm256_storeu_si256((__m256i *)(dst + i), x);
+    }
+  }
+  bool differs = !_mm256_testz_si256(diff, diff);
+  for (; i < length; i++)
+  {
+    uint8_t x = a[i] ^ b[i];
+    differs |= x != 0;
+    if (dst)
+    {
+      dst[i] = x;
+    }
+  }
+  return differs;
+}
+
+AVX2 static size_t popcountAvx2(const uint8_t *data, size_t length)
+{
+  // Bits set in each nibble, looked up with a byte shuffle
+  const __m256i table = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3,
+                                         2, 3, 3, 4, 0, 1, 1, 2, 1, 2, 2, 3,
+                                         1, 2, 2, 3, 2, 3, 3, 4);
+  const __m256i low = _mm256_set1_epi8(0x0F);
+  __m256i sums = _mm256_setzero_si256();
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32)
+  {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+    __m256i bits = _mm256_add_epi8(
+        _mm256_shuffle_epi8(table, _mm256_and_si256(v, low)),
+        _mm256_shuffle_epi8(table,
+                            _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+    sums = _mm256_add_epi64(sums,
+                            _mm256_sad_epu8(bits, _mm256_setzero_si256()));
+  }
+  uint64_t parts[4];
+  _mm256_storeu_si256((__m256i *)parts, sums);
+  size_t count = parts[0] + parts[1] + parts[2] + parts[3];
+  for (; i < length; i++)
+  {
+    count += __builtin_popcount(data[i]);
+  }
+  return count;
+}
+
+AVX2 static size_t findByteAvx2(const uint8_t *data, size_t length,
+                                uint8_t value, bool equal)
+{
+  const __m256i pattern = _mm256_set1_epi8((char)value);
+  const uint32_t flip = equal ? 0 : 0xFFFFFFFFu;
+  size_t i = 0;
+  for (; i + 32 <= length; i += 32)
+  {
+    __m256i v = _mm256_loadu_si256((const __m256i *)(data + i));
+    uint32_t matches =
+        (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, pattern)) ^ flip;
+    if (matches)
+    {
+      return i + __builtin_ctz(matches);
+    }
+  }
+  for (; i < length; i++)
+  {
+    if ((data[i] == value) == equal)
+    {
+      return i;
+    }
+  }
+  return length;
+}
+
+// As mulloSse2; shorter latency than vpmulld, and each lane of the hash is
+// one chain of multiplies
+AVX2 static inline __m256i mulloAvx2(__m256i a, __m256i b)
+{
+  __m256i even = _mm256_mul_epu32(a, b);
+  __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32),
+                                 _mm256_srli_epi64(b, 32));
+  return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+}
+
+AVX2 static uint32_t hashBlocksAvx2(uint32_t hash, const uint8_t *data,
+                                    size_t blocks)
+{
+  const __m256i prime = _mm256_set1_epi32((int)FNV_PRIME);
+  __m256i h = _mm256_xor_si256(_mm256_set1_epi32((int)hash),
+                               _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+  for (; blocks; blocks--, data += FB_HASH_BLOCK)
+  {
+    h = mulloAvx2(
+        _mm256_xor_si256(h, _mm256_loadu_si256((const __m256i *)data)), prime);
+  }
+  uint32_t lanes[FB_HASH_LANES];
+  _mm256_storeu_si256((__m256i *)lanes, h);
+  return fbFoldLanes(hash, lanes);
+}
+
+const FbKernels fbAvx2Kernels = {
+  fillAvx2,
+  xorDiffAvx2,
+  popcountAvx2,
+  findByteAvx2,
+  hashBlocksAvx2
+};
+
+#endif // FB_HAVE_X86
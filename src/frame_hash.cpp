@@ -0,0 +1,139 @@
+#include "frame_hash.h"
+#include <algorithm>
+
+void FrameHash::begin(const DisplayRect *regions, uint8_t count)
+{
+  hash = FNV_OFFSET_BASIS;
+  this->regions = regions;
+  this->count = std::min<uint8_t>(count, FRAME_MAX_REGIONS);
+  for (uint8_t i = 0; i < this->count; i++)
+  {
+    regionHashes[i] = FNV_OFFSET_BASIS;
+  }
+}
+
+DisplayRect FrameHash::region(uint8_t i) const
+{
+  const DisplayRect &r = regions[i];
+  return {(int16_t)(r.x0 & ~7), r.y0, (int16_t)((r.x1 + 7) & ~7), r.y1};
+}
+
+/* Adds bytes [from, to) of a row of the planes to region owner, or to the
+ * rest of the frame if owner is -1. red is nullptr for black and white panels.
+ */
+void FrameHash::addSpan(int owner, const uint8_t *black, const uint8_t *red,
+                        int16_t from, int16_t to)
+{
+  uint32_t &h = owner < 0 ? hash : regionHashes[owner];
+  h = fbHash(h, black + from, to - from);
+  if (red)
+  {
+    h = fbHash(h, red + from, to - from);
+  }
+}
+
+void FrameHash::addBand(const BandBuffer &band)
+{
+  const int16_t rowBytes = band.width() / 8;
+  for (int16_t row = 0; row < band.rows(); row++)
+  {
+    int16_t y = band.top() + row;
+    const uint8_t *black = band.blackRow(row);
+    const uint8_t *red = band.redRow(row);
+    // Each span runs up to where its owner ends or an earlier region starts
+    int16_t b = 0;
+    while (b < rowBytes)
+    {
+      int owner = -1;
+      int16_t end = rowBytes;
+      for (uint8_t i = 0; i < count; i++)
+      {
+        const DisplayRect &r = regions[i];
+        if (y < r.y0 || y >= r.y1)
+        {
+          continue;
+        }
+        int16_t b0 = std::max<int16_t>(r.x0 >> 3, 0);
+        int16_t b1 = std::min<int16_t>((r.x1 + 7) >> 3, rowBytes);
+        if (owner < 0 && b >= b0 && b < b1)
+        {
+          owner = i;
+          end = std::min(end, b1);
+        }
+        else if (owner < 0 && b0 > b)
+        {
+          end = std::min(end, b0);
+        }
+      }
+      addSpan(owner, black, red, b, end);
+      b = end;
+    }
+  }
+} // end addBand
+
+RefreshPlan planRefresh(PanelState &state, const FrameHash &hash,
+                        uint32_t now, uint32_t maxStatusAge,
+                        uint8_t maxPartial)
+{
+  RefreshPlan plan = {REFRESH_FULL, {0, 0, 0, 0}};
+  if (fullRefreshAhead(state, hash.regionCount()) ||
+      state.hash != hash.value())
+  {
+    return plan;
+  }
+
+  bool dirty = false;
+  DisplayRect window = {INT16_MAX, INT16_MAX, INT16_MIN, INT16_MIN};
+  for (uint8_t i = 1; i < hash.regionCount(); i++)
+  {
+    if (hash.regionValue(i) == state.regionHashes[i])
+    {
+      continue;
+    }
+    DisplayRect r = hash.region(i);
+    window = {std::min(window.x0, r.x0), std::min(window.y0, r.y0),
+              std::max(window.x1, r.x1), std::max(window.y1, r.y1)};
+    dirty = true;
+  }
+  bool statusChanged = hash.regionCount() &&
+                       hash.regionValue(0) != state.regionHashes[0];
+  // A clock behind statusShownAt wraps around to a large age and refreshes
+  if (!dirty && (!statusChanged || now - state.statusShownAt < maxStatusAge))
+  {
+    plan.kind = REFRESH_NONE;
+    return plan;
+  }
+  if (statusChanged)
+  {
+    // Fresh anyway while the panel refreshes
+    DisplayRect r = hash.region(0);
+    window = {std::min(window.x0, r.x0), std::min(window.y0, r.y0),
+              std::max(window.x1, r.x1), std::max(window.y1, r.y1)};
+  }
+  if (state.partialRefreshes < maxPartial)
+  {
+    plan.kind = REFRESH_PARTIAL;
+    plan.window = window;
+  }
+  return plan;
+} // end planRefresh
+
+bool fullRefreshAhead(const PanelState &state, uint8_t regionCount)
+{
+  return !state.valid || state.regionCount != regionCount;
+}
+
+void rememberRefresh(PanelState &state, const FrameHash &hash,
+                     refresh_kind_t kind, uint32_t now)
+{
+  state.valid = true;
+  state.regionCount = hash.regionCount();
+  state.statusShownAt = now;
+  state.partialRefreshes = kind == REFRESH_PARTIAL ? state.partialRefreshes + 1
+                                                   : 0;
+  state.hash = hash.value();
+  for (uint8_t i = 0; i < hash.regionCount(); i++)
+  {
+    state.regionHashes[i] = hash.regionValue(i);
+  }
+}
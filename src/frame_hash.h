@@ -0,0 +1,136 @@
+#ifndef FRAME_HASH_H
+#define FRAME_HASH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "band_buffer.h"
+#include "display_list.h"
+#include "fbops.h"
+
+/* Hashes of both planes of a rendered frame, built band by band while the
+ * frame is rendered. A three-color refresh takes about 20 seconds, so a frame
+ * whose pixels are identical to the ones on the panel is not refreshed again,
+ * and one that differs in a few places only has those written and refreshed.
+ *
+ * The frame is split into regions, the calendar cells, the header and the
+ * status bar, each hashed on its own; pixels outside all regions go into one
+ * more hash. Region edges are rounded out to whole bytes. Where rounded
+ * regions overlap, the bytes belong to the region listed first.
+ */
+
+// Most regions a frame is split into: header, 6 weeks of cells, status bar
+#define FRAME_MAX_REGIONS 44
+
+class FrameHash {
+public:
+  // Starts a new frame split into count regions, which must outlive it
+  void begin(const DisplayRect *regions = nullptr, uint8_t count = 0);
+  // Adds the rows of the current band of band, bands in order
+  void addBand(const BandBuffer &band);
+  // Hash of everything outside the regions
+  uint32_t value() const { return hash; }
+  // Hash of region i alone
+  uint32_t regionValue(uint8_t i) const { return regionHashes[i]; }
+  uint8_t regionCount() const { return count; }
+  // Region i rounded out to whole bytes, as it was hashed
+  DisplayRect region(uint8_t i) const;
+
+private:
+  void addSpan(int owner, const uint8_t *black, const uint8_t *red,
+               int16_t from, int16_t to);
+
+  uint32_t hash = FNV_OFFSET_BASIS;
+  uint32_t regionHashes[FRAME_MAX_REGIONS] = {};
+  const DisplayRect *regions = nullptr;
+  uint8_t count = 0;
+};
+
+typedef enum refresh_kind {
+  REFRESH_NONE,       // panel shows the frame already
+  REFRESH_PARTIAL,    // only the window changed
+  REFRESH_FULL
+} refresh_kind_t;
+
+struct RefreshPlan {
+  refresh_kind_t kind;
+  DisplayRect window;   // whole bytes, REFRESH_PARTIAL only
+};
+
+// What the panel shows, kept in RTC memory across deep sleep
+struct PanelState {
+  bool valid;
+  uint8_t regionCount;
+  uint8_t partialRefreshes;   // since the last full refresh
+  uint32_t hash;
+  uint32_t statusShownAt;     // seconds, when the status bar was refreshed
+  uint32_t regionHashes[FRAME_MAX_REGIONS];
+};
+
+/* Rows at the bottom of the cell in week and column of View, a
+ * CalendarGeometry, that lie in strip, the part of the frame kept for the
+ * status bar. The layout leaves them empty so that no cell pixels are hashed
+ * as status bar.
+ */
+template <class View>
+constexpr int stripRows(const DisplayRect &strip, int week, int column)
+{
+  return View::cellX(column) + View::dayWidth > strip.x0
+      && View::cellY(week) + View::rowHeight > strip.y0
+       ? View::cellY(week) + View::rowHeight
+         - (strip.y0 > View::cellY(week) ? strip.y0 : View::cellY(week))
+       : 0;
+}
+
+/* Splits a calendar frame into regions: the status bar first, as drawn
+ * (statusBar) but clipped to strip, then the header and the cells of View
+ * without their rows in strip. Status bar pixels outside strip are then
+ * hashed with the cells, which refreshes them, and the cells never share
+ * bytes with the status bar. Returns the number of regions.
+ */
+template <class View>
+uint8_t calendarRegions(DisplayRect *regions, const DisplayRect &statusBar,
+                        const DisplayRect &strip)
+{
+  uint8_t count = 0;
+  DisplayRect bar = {
+    statusBar.x0 > strip.x0 ? statusBar.x0 : strip.x0,
+    statusBar.y0 > strip.y0 ? statusBar.y0 : strip.y0,
+    statusBar.x1 < strip.x1 ? statusBar.x1 : strip.x1,
+    statusBar.y1 < strip.y1 ? statusBar.y1 : strip.y1};
+  if (bar.x0 >= bar.x1 || bar.y0 >= bar.y1)
+  {
+    bar = {0, 0, 0, 0};   // none, the region stays so indices don't move
+  }
+  regions[count++] = bar;
+  regions[count++] = {0, 0, (int16_t)View::width, (int16_t)View::headerHeight};
+  for (int day = 1; day <= View::days; day++)
+  {
+    int week = View::week(day);
+    int column = View::column(day);
+    int16_t x = View::cellX(column);
+    int16_t y = View::cellY(week);
+    regions[count++] = {x, y, (int16_t)(x + View::dayWidth),
+                        (int16_t)(y + View::rowHeight
+                                  - stripRows<View>(strip, week, column))};
+  }
+  return count;
+}
+
+/* Compares a rendered frame with the panel at now seconds. Region 0 is the
+ * status bar: when only it changed, the refresh is skipped until the panel
+ * shows it for maxStatusAge seconds.
+ * Otherwise the changed regions are refreshed as one partial window, unless
+ * maxPartial partial refreshes followed the last full one already or pixels
+ * outside the regions changed. maxPartial 0 always refreshes in full.
+ */
+RefreshPlan planRefresh(PanelState &state, const FrameHash &hash,
+                        uint32_t now, uint32_t maxStatusAge,
+                        uint8_t maxPartial);
+// True if a frame of regionCount regions is refreshed in full whatever its
+// hash: the panel content is unknown or was split differently
+bool fullRefreshAhead(const PanelState &state, uint8_t regionCount);
+// Records that the panel shows the frame of hash from now seconds on
+void rememberRefresh(PanelState &state, const FrameHash &hash,
+                     refresh_kind_t kind, uint32_t now);
+
+#endif // FRAME_HASH_H
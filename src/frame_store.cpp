@@ -0,0 +1,61 @@
+#include "frame_store.h"
+#include <Arduino.h>
+#include <LittleFS.h>
+#include <vector>
+#include "config.h"
+
+/* Mounts the data partition, formatting it on first use.
+ */
+static bool mountStore()
+{
+  if (!LittleFS.begin(true))
+  {
+    Serial.println("No LittleFS partition for the frame store");
+    return false;
+  }
+  return true;
+}
+
+bool loadStoredFrame(CompressedFrame &frame)
+{
+  frame.clear();
+  if (!mountStore() || !LittleFS.exists(FRAME_STORE_PATH))
+  {
+    return false;
+  }
+  File file = LittleFS.open(FRAME_STORE_PATH, "r");
+  size_t size = file ? file.size() : 0;
+  if (!size || size > FRAME_MAX_DOWNLOAD)
+  {
+    file.close();
+    return false;
+  }
+  std::vector<uint8_t> data(size);
+  bool loaded = file.read(data.data(), size) == size &&
+                frame.load(data.data(), size);
+  file.close();
+  Serial.printf("Stored frame of %u bytes %s\n", (unsigned)size,
+                loaded ? "loaded" : "is corrupt");
+  return loaded;
+}
+
+bool storeFrame(const CompressedFrame &frame)
+{
+  if (!mountStore())
+  {
+    return false;
+  }
+  std::vector<uint8_t> data;
+  frame.save(data);
+  File file = LittleFS.open(FRAME_STORE_PATH, "w");
+  bool stored = file && file.write(data.data(), data.size()) == data.size();
+  file.close();
+  if (!stored)
+  {
+    // A partial file would fail to load anyway
+    LittleFS.remove(FRAME_STORE_PATH);
+  }
+  Serial.printf("%s the frame, %u bytes\n", stored ? "Stored" : "Couldn't store",
+                (unsigned)data.size());
+  return stored;
+}
@@ -0,0 +1,21 @@
+#ifndef FRAME_STORE_H
+#define FRAME_STORE_H
+
+#include "compressed_frame.h"
+
+/* The last frame a thin client downloaded, kept in flash as a frame file
+ * (compressed_frame.h), so that the next download can be a delta against it.
+ * It lives in a LittleFS file on the data partition: the NVS partition behind
+ * Preferences is too small for a busy frame. The file is only written when
+ * the frame changed, so the flash sees a write per change, not per wake.
+ */
+
+#define FRAME_STORE_PATH "/frame.bin"
+
+// Loads the stored frame. Returns false, leaving frame empty, if there is
+// none or it can't be read.
+bool loadStoredFrame(CompressedFrame &frame);
+// Replaces the stored frame with frame
+bool storeFrame(const CompressedFrame &frame);
+
+#endif // FRAME_STORE_H
@@ -0,0 +1,33 @@
+#ifndef GFX_FONT_H
+#define GFX_FONT_H
+
+// Adafruit_GFX font structures. Native test builds have no Adafruit_GFX, so
+// the two structs from gfxfont.h are mirrored here for them.
+#ifdef UNIT_TEST
+#include <stdint.h>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+#else
+#include <Adafruit_GFX.h>
+#endif
+
+#endif // GFX_FONT_H
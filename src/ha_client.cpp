@@ -1,6 +1,8 @@
 #include "ha_client.h"
 #include "config.h"
 #include "sample_data.h"
+#include "utilities.h"
+#include "calendar_date.h"
 
 HAClient::HAClient() {
   // Constructor
@@ -38,6 +40,7 @@ HAResponse HAClient::fetchFromHA() {
       Serial.println("Successfully fetched calendar data from Home Assistant");
       Serial.printf("Response length: %d bytes\n", jsonResponse.length());
 
+      markPhase(PHASE_PARSE);
       response.success = parseResponse(jsonResponse, response);
     } else {
       Serial.printf("HTTP Error: %d\n", httpResponseCode);
@@ -51,6 +54,64 @@ HAResponse HAClient::fetchFromHA() {
   return response;
 }
 
+bool HAClient::download(const char *url, std::vector<uint8_t> &file,
+                        tm *timeInfo) {
+  const char *headers[] = {"Date"};
+
+  http.begin(url);
+  http.addHeader("Authorization", "Bearer " + String(HA_TOKEN));
+  http.collectHeaders(headers, 1);
+  http.setTimeout(10000); // 10 seconds
+
+  int httpResponseCode = http.GET();
+  int size = http.getSize();  // -1 without a Content-Length
+  bool received = false;
+  if (httpResponseCode == 200 && size > 0 && size <= FRAME_MAX_DOWNLOAD) {
+    // Only the compressed frame is held; it is decoded band by band later
+    file.resize(size);
+    received = http.getStream().readBytes(file.data(), size) == (size_t)size;
+    Serial.printf("Downloaded %d bytes from %s%s\n", size, url,
+                  received ? "" : ", cut short");
+  } else {
+    Serial.printf("Frame request failed: HTTP %d, %d bytes\n",
+                  httpResponseCode, size);
+  }
+  if (received && !parseHttpDate(http.header("Date"), timeInfo)) {
+    Serial.println("No usable Date header, sleeping a fixed interval");
+  }
+
+  http.end();
+  return received;
+}
+
+bool HAClient::fetchFrame(CompressedFrame &frame, const CompressedFrame &base,
+                          tm *timeInfo) {
+  Serial.println("Fetching the pre-rendered frame...");
+  std::vector<uint8_t> file;
+  if (base.rows() && FRAME_DELTA_URL[0] &&
+      download(FRAME_DELTA_URL, file, timeInfo)) {
+    markPhase(PHASE_PARSE);
+    if (frame.loadDelta(base, file.data(), file.size())) {
+      Serial.println("Frame rebuilt from the delta against the stored one");
+      return true;
+    }
+    // The server moved on more than a frame since, or the file is broken
+    Serial.println("Delta doesn't apply to the stored frame");
+  }
+
+  file.clear();
+  markPhase(PHASE_HTTP);
+  bool loaded = download(FRAME_URL, file, timeInfo);
+  if (loaded) {
+    markPhase(PHASE_PARSE);
+    loaded = frame.load(file.data(), file.size());
+  }
+  if (!loaded) {
+    Serial.println("Not a valid frame file");
+  }
+  return loaded;
+}
+
 HAResponse HAClient::parseSampleData(const String& sampleJson) {
   HAResponse response;
   response.success = parseResponse(sampleJson, response);
@@ -123,8 +184,8 @@ bool HAClient::parseResponse(const String& jsonResponse, HAResponse& response) {
           event.isMultiDay = (event.startDay != event.endDay);
         }
 
-        // Only add events that fall within our 14-day calendar view
-        if (event.startDay >= 1 && event.startDay <= 14) {
+        // Only add events that start within the calendar view
+        if (CalendarView::contains(event.startDay)) {
           response.events.push_back(event);
         }
       }
@@ -144,43 +205,9 @@ bool HAClient::isFullDayEvent(const String& start, const String& end) {
 }
 
 int HAClient::calculateDayNumber(const String& dateStr, const String& weekStart) {
-  // Extract date portion (handles both "YYYY-MM-DD" and "YYYY-MM-DDTHH:MM:SS+TZ" formats)
-  String date = dateStr;
-  int tIndex = date.indexOf('T');
-  if (tIndex != -1) {
-    date = date.substring(0, tIndex);
-  }
-
-  // Simple day calculation relative to week start
-  // This is a simplified version - you may want to use a proper date library
-  int dateYear = date.substring(0, 4).toInt();
-  int dateMonth = date.substring(5, 7).toInt();
-  int dateDay = date.substring(8, 10).toInt();
-
-  int weekStartYear = weekStart.substring(0, 4).toInt();
-  int weekStartMonth = weekStart.substring(5, 7).toInt();
-  int weekStartDay = weekStart.substring(8, 10).toInt();
-
-  // Simple calculation for same month
-  if (dateYear == weekStartYear && dateMonth == weekStartMonth) {
-    return dateDay - weekStartDay + 1;
-  }
-
-  // Handle month boundaries (simplified)
-  if (dateYear == weekStartYear) {
-    if (dateMonth == weekStartMonth + 1) {
-      // Next month - assume previous month had 31 days
-      return (31 - weekStartDay + 1) + dateDay;
-    }
-  }
-
-  // Handle year boundary (December to January)
-  if (weekStartYear == dateYear - 1 && weekStartMonth == 12 && dateMonth == 1) {
-    return (31 - weekStartDay + 1) + dateDay;
-  }
-
-  // Default fallback
-  return 1;
+  // Only the date counts, "YYYY-MM-DD" and "YYYY-MM-DDTHH:MM:SS+TZ" alike;
+  // days before weekStart come out below 1 and are dropped by the caller
+  return parseDateDays(dateStr.c_str()) - parseDateDays(weekStart.c_str()) + 1;
 }
 
 String HAClient::extractTime(const String& datetime) {
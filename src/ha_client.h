@@ -5,7 +5,8 @@
 #include <HTTPClient.h>
 #include <ArduinoJson.h>
 #include <vector>
-#include "drawing.h"
+#include "calendar_view.h"
+#include "compressed_frame.h"
 
 // Home Assistant API response structure
 struct HAResponse {
@@ -26,6 +27,13 @@ public:
   // Main method - fetches calendar data (from HA or sample based on config)
   HAResponse fetchCalendarData();
 
+  // Downloads the frame for thin-client mode: the delta file at
+  // FRAME_DELTA_URL if it applies to base, the frame on the panel, else the
+  // frame file at FRAME_URL. Sets timeInfo from the Date header of the
+  // response, if it has one.
+  bool fetchFrame(CompressedFrame &frame, const CompressedFrame &base,
+                  tm *timeInfo);
+
   // Parse sample data for fallback
   HAResponse parseSampleData(const String& sampleJson);
 
@@ -35,6 +43,8 @@ private:
 
   // Parse JSON response and extract events
   bool parseResponse(const String& jsonResponse, HAResponse& response);
+  // Reads the file at url, at most FRAME_MAX_DOWNLOAD bytes
+  bool download(const char *url, std::vector<uint8_t> &file, tm *timeInfo);
   HTTPClient http;
 
   // Helper functions
@@ -1,10 +1,19 @@
 #include "icons.h"
 
+/* Compresses name_bitmap, a byte padded w x h bitmap, into the icon name at
+ * compile time, see packed_icon.h.
+ */
+#define PACK_ICON(name, w, h)                                                \
+  static constexpr auto name##_packed =                                      \
+      buildStaticIcon<encodeIcon(name##_bitmap, w, h, nullptr)>(             \
+          name##_bitmap, w, h);                                              \
+  const PackedIcon name = name##_packed.icon()
+
 // ============================================================================
 // 32x32 Icons
 // ============================================================================
 
-const uint8_t wi_refresh_32x32[] PROGMEM = {
+static constexpr uint8_t wi_refresh_32x32_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
@@ -17,46 +26,52 @@ const uint8_t wi_refresh_32x32[] PROGMEM = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xe3, 0xc7, 0xff,
   0xff, 0xe7, 0xe7, 0xff, 0xff, 0xef, 0xf7, 0xff
 };
+PACK_ICON(wi_refresh_32x32, 32, 32);
 
 // ============================================================================
 // 16x16 WiFi Icons
 // ============================================================================
 
-const uint8_t wifi_x_16x16[] PROGMEM = {
+static constexpr uint8_t wifi_x_16x16_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x6b, 0xe7, 0xe3, 0x9f, 0xe3,
   0xf8, 0x6b, 0xe7, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff,
   0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
+PACK_ICON(wifi_x_16x16, 16, 16);
 
-const uint8_t wifi_16x16[] PROGMEM = {
+static constexpr uint8_t wifi_16x16_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xe7, 0xe7, 0x9f, 0xf9,
   0xf8, 0x1f, 0xe7, 0xc7, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff,
   0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
+PACK_ICON(wifi_16x16, 16, 16);
 
-const uint8_t wifi_1_bar_16x16[] PROGMEM = {
+static constexpr uint8_t wifi_1_bar_16x16_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
+PACK_ICON(wifi_1_bar_16x16, 16, 16);
 
-const uint8_t wifi_2_bar_16x16[] PROGMEM = {
+static constexpr uint8_t wifi_2_bar_16x16_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff,
+  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
+PACK_ICON(wifi_2_bar_16x16, 16, 16);
 
-const uint8_t wifi_3_bar_16x16[] PROGMEM = {
+static constexpr uint8_t wifi_3_bar_16x16_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xf8, 0x1f, 0xe7, 0xc7, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff,
   0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
+PACK_ICON(wifi_3_bar_16x16, 16, 16);
 
 // ============================================================================
 // 24x24 Battery Icons (90 degree rotation)
 // ============================================================================
 // 24 x 24
-const unsigned char battery_6_bar_90deg_24x24[] PROGMEM = {
+static constexpr uint8_t battery_6_bar_90deg_24x24_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
   0xc0, 0x00, 0x0f, 0xc0, 0x00, 0xcf, 0xc0, 0x00, 0xc3, 0xc0, 0x00, 0xc3,
@@ -64,7 +79,8 @@ const unsigned char battery_6_bar_90deg_24x24[] PROGMEM = {
   0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-const unsigned char battery_5_bar_90deg_24x24[] PROGMEM = {
+PACK_ICON(battery_6_bar_90deg_24x24, 24, 24);
+static constexpr uint8_t battery_5_bar_90deg_24x24_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
   0xc0, 0x00, 0x0f, 0xc0, 0x03, 0xcf, 0xc0, 0x03, 0xc3, 0xc0, 0x03, 0xc3,
@@ -72,7 +88,8 @@ const unsigned char battery_5_bar_90deg_24x24[] PROGMEM = {
   0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-const unsigned char battery_4_bar_90deg_24x24[] PROGMEM = {
+PACK_ICON(battery_5_bar_90deg_24x24, 24, 24);
+static constexpr uint8_t battery_4_bar_90deg_24x24_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
   0xc0, 0x00, 0x0f, 0xc0, 0x0f, 0xcf, 0xc0, 0x0f, 0xc3, 0xc0, 0x0f, 0xc3,
@@ -80,7 +97,8 @@ const unsigned char battery_4_bar_90deg_24x24[] PROGMEM = {
   0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-const unsigned char battery_3_bar_90deg_24x24[] PROGMEM = {
+PACK_ICON(battery_4_bar_90deg_24x24, 24, 24);
+static constexpr uint8_t battery_3_bar_90deg_24x24_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
   0xc0, 0x00, 0x0f, 0xc0, 0x3f, 0xcf, 0xc0, 0x3f, 0xc3, 0xc0, 0x3f, 0xc3,
@@ -88,7 +106,8 @@ const unsigned char battery_3_bar_90deg_24x24[] PROGMEM = {
   0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-const unsigned char battery_2_bar_90deg_24x24[] PROGMEM = {
+PACK_ICON(battery_3_bar_90deg_24x24, 24, 24);
+static constexpr uint8_t battery_2_bar_90deg_24x24_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
   0xc0, 0x00, 0x0f, 0xc0, 0xff, 0xcf, 0xc0, 0xff, 0xc3, 0xc0, 0xff, 0xc3,
@@ -96,7 +115,8 @@ const unsigned char battery_2_bar_90deg_24x24[] PROGMEM = {
   0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-const unsigned char battery_1_bar_90deg_24x24[] PROGMEM = {
+PACK_ICON(battery_2_bar_90deg_24x24, 24, 24);
+static constexpr uint8_t battery_1_bar_90deg_24x24_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
   0xc0, 0x00, 0x0f, 0xc3, 0xff, 0xcf, 0xc3, 0xff, 0xc3, 0xc3, 0xff, 0xc3,
@@ -104,7 +124,8 @@ const unsigned char battery_1_bar_90deg_24x24[] PROGMEM = {
   0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
-const unsigned char battery_0_bar_90deg_24x24[] PROGMEM = {
+PACK_ICON(battery_1_bar_90deg_24x24, 24, 24);
+static constexpr uint8_t battery_0_bar_90deg_24x24_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
   0xc0, 0x00, 0x0f, 0xcf, 0xff, 0xcf, 0xcf, 0xff, 0xc3, 0xcf, 0xff, 0xc3,
@@ -112,8 +133,9 @@ const unsigned char battery_0_bar_90deg_24x24[] PROGMEM = {
   0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
+PACK_ICON(battery_0_bar_90deg_24x24, 24, 24);
 
-const unsigned char battery_full_90deg_24x24[] PROGMEM = {
+static constexpr uint8_t battery_full_90deg_24x24_bitmap[] = {
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
   0xc0, 0x00, 0x0f, 0xc0, 0x00, 0x0f, 0xc0, 0x00, 0x03, 0xc0, 0x00, 0x03,
@@ -121,26 +143,35 @@ const unsigned char battery_full_90deg_24x24[] PROGMEM = {
   0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 };
+PACK_ICON(battery_full_90deg_24x24, 24, 24);
 
 // ============================================================================
 // 196x196 Icons (Placeholders - all white for now)
 // ============================================================================
 
-// WiFi X icon placeholder (196x196 = 4802 bytes)
-const uint8_t wifi_x_196x196[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-  // Note: This is a minimal placeholder. Full implementation would be 4802 bytes
+// A blank 196x196 bitmap, 25 bytes per row
+struct BlankBitmap196 {
+  uint8_t data[25 * 196];
+
+  constexpr BlankBitmap196() : data()
+  {
+    for (uint8_t &b : data)
+    {
+      b = 0xFF;
+    }
+  }
 };
 
+static constexpr BlankBitmap196 blank_196x196;
+static constexpr auto blank_196x196_packed =
+    buildStaticIcon<encodeIcon(blank_196x196.data, 196, 196, nullptr)>(
+        blank_196x196.data, 196, 196);
+
+// WiFi X icon placeholder
+const PackedIcon wifi_x_196x196 = blank_196x196_packed.icon();
+
 // Time/Clock icon placeholder
-const uint8_t wi_time_4_196x196[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-};
+const PackedIcon wi_time_4_196x196 = blank_196x196_packed.icon();
 
 // Battery alert icon placeholder
-const uint8_t battery_alert_0deg_196x196[] PROGMEM = {
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
-};
+const PackedIcon battery_alert_0deg_196x196 = blank_196x196_packed.icon();
@@ -2,30 +2,33 @@
 #define ICONS_H
 
 #include <Arduino.h>
+#include "packed_icon.h"
+
+// Inverted bitmaps, a cleared bit is ink, compressed at compile time
 
 // 196x196 Icons
-extern const uint8_t wi_time_4_196x196[];
-extern const uint8_t battery_alert_0deg_196x196[];
-extern const uint8_t wifi_x_196x196[];
+extern const PackedIcon wi_time_4_196x196;
+extern const PackedIcon battery_alert_0deg_196x196;
+extern const PackedIcon wifi_x_196x196;
 
 // 32x32 Icons
-extern const uint8_t wi_refresh_32x32[];
+extern const PackedIcon wi_refresh_32x32;
 
 // 16x16 WiFi Icons
-extern const uint8_t wifi_x_16x16[];
-extern const uint8_t wifi_16x16[];
-extern const uint8_t wifi_1_bar_16x16[];
-extern const uint8_t wifi_2_bar_16x16[];
-extern const uint8_t wifi_3_bar_16x16[];
+extern const PackedIcon wifi_x_16x16;
+extern const PackedIcon wifi_16x16;
+extern const PackedIcon wifi_1_bar_16x16;
+extern const PackedIcon wifi_2_bar_16x16;
+extern const PackedIcon wifi_3_bar_16x16;
 
 // 24x24 Battery Icons (horizontal orientation)
-extern const uint8_t battery_0_bar_90deg_24x24[];
-extern const uint8_t battery_1_bar_90deg_24x24[];
-extern const uint8_t battery_2_bar_90deg_24x24[];
-extern const uint8_t battery_3_bar_90deg_24x24[];
-extern const uint8_t battery_4_bar_90deg_24x24[];
-extern const uint8_t battery_5_bar_90deg_24x24[];
-extern const uint8_t battery_6_bar_90deg_24x24[];
-extern const uint8_t battery_full_90deg_24x24[];
+extern const PackedIcon battery_0_bar_90deg_24x24;
+extern const PackedIcon battery_1_bar_90deg_24x24;
+extern const PackedIcon battery_2_bar_90deg_24x24;
+extern const PackedIcon battery_3_bar_90deg_24x24;
+extern const PackedIcon battery_4_bar_90deg_24x24;
+extern const PackedIcon battery_5_bar_90deg_24x24;
+extern const PackedIcon battery_6_bar_90deg_24x24;
+extern const PackedIcon battery_full_90deg_24x24;
 
 #endif
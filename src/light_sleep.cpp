@@ -0,0 +1,74 @@
+#include "light_sleep.h"
+#include "config.h"
+#include <WiFi.h>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+#include <esp_pm.h>
+#endif
+
+#define WIFI_GOT_IP_BIT BIT0
+
+static EventGroupHandle_t wifiEvents = nullptr;
+static wifi_event_id_t wifiHandler = 0;
+
+void sleepWhilePanelBusy(const void *)
+{
+  if (digitalRead(EPD_BUSY) != EPD_BUSY_LEVEL)
+  {
+    return;
+  }
+  if (WiFi.getMode() != WIFI_OFF)
+  {
+    delay(1);     // GxEPD2's own wait
+    return;
+  }
+  gpio_num_t busy = (gpio_num_t)EPD_BUSY;
+  Serial.flush();
+  gpio_wakeup_enable(busy, EPD_BUSY_LEVEL == LOW ? GPIO_INTR_HIGH_LEVEL
+                                                 : GPIO_INTR_LOW_LEVEL);
+  esp_sleep_enable_gpio_wakeup();
+  esp_sleep_enable_timer_wakeup(WAIT_SLEEP_SLICE_MS * 1000ULL);
+  esp_light_sleep_start();
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_TIMER);
+  gpio_wakeup_disable(busy);
+}
+
+static void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t)
+{
+  if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP)
+  {
+    xEventGroupSetBits(wifiEvents, WIFI_GOT_IP_BIT);
+  }
+}
+
+void watchWiFi()
+{
+  if (!wifiEvents)
+  {
+    wifiEvents = xEventGroupCreate();
+  }
+  xEventGroupClearBits(wifiEvents, WIFI_GOT_IP_BIT);
+  wifiHandler = WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+}
+
+wait_result_t waitForWiFi(uint32_t timeoutMs)
+{
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+  // The WiFi driver keeps the connection through automatic light sleep
+  esp_pm_config_esp32_t pm = {getCpuFrequencyMhz(), getCpuFrequencyMhz(),
+                              true};
+  esp_pm_configure(&pm);
+#endif
+  EventBits_t bits = xEventGroupWaitBits(wifiEvents, WIFI_GOT_IP_BIT, pdTRUE,
+                                         pdFALSE, pdMS_TO_TICKS(timeoutMs));
+#if CONFIG_PM_ENABLE && CONFIG_FREERTOS_USE_TICKLESS_IDLE
+  pm.light_sleep_enable = false;
+  esp_pm_configure(&pm);
+#endif
+  WiFi.removeEvent(wifiHandler);
+  return bits & WIFI_GOT_IP_BIT ? WAIT_DONE : WAIT_TIMEOUT;
+}
@@ -0,0 +1,33 @@
+#ifndef LIGHT_SLEEP_H
+#define LIGHT_SLEEP_H
+
+#include <Arduino.h>
+
+/* Waits for slow hardware with the CPU asleep instead of polling it.
+ *
+ * A three-color refresh keeps the panel busy for many seconds. GxEPD2 calls
+ * sleepWhilePanelBusy() while it polls BUSY, which puts the CPU into light
+ * sleep until a GPIO wakeup on BUSY ends it, or at most WAIT_SLEEP_SLICE_MS
+ * so GxEPD2 still sees its own timeout. Light sleep would drop a WiFi
+ * connection, so it is only entered once WiFi is off.
+ *
+ * WiFi association is waited for on the WiFi events instead of polling
+ * WiFi.status(). The loop task blocks on an event group and the CPU idles
+ * until the connection is up or the timeout passes; with automatic light
+ * sleep enabled in the ESP-IDF configuration, it light sleeps in between.
+ */
+
+typedef enum wait_result {
+  WAIT_DONE,
+  WAIT_TIMEOUT
+} wait_result_t;
+
+// Busy callback for GxEPD2, see GxEPD2_EPD::setBusyCallback()
+void sleepWhilePanelBusy(const void *);
+
+// Call before WiFi.begin() so no event is missed
+void watchWiFi();
+// Waits until WiFi has an IP address or timeoutMs passed
+wait_result_t waitForWiFi(uint32_t timeoutMs);
+
+#endif // LIGHT_SLEEP_H
@@ -1,21 +1,22 @@
 #include <Arduino.h>
-#include <GxEPD2_BW.h>
-#include <GxEPD2_3C.h>
 #include <ArduinoJson.h>
 #include "drawing.h"
 #include "utilities.h"
+#include "battery.h"
 #include "icons.h"
 #include "config.h"
 #include "ha_client.h"
+#include "frame_store.h"
+#include "wake_graph.h"
 #include <WiFi.h>
 #include <ESPmDNS.h>
 #include <esp_sleep.h>
 #include <Preferences.h>
 #include <vector>
 
-// Display instance - using GxEPD2_750c_Z08 for GDEY075Z08
+// Display instance - the panel driver is DISPLAY_PANEL, see display_backend.h
 // Pin definitions and configuration are in config.h
-GxEPD2_3C<GxEPD2_750c_Z08, GxEPD2_750c_Z08::HEIGHT / 2> display(GxEPD2_750c_Z08(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
+Display display(DISPLAY_PANEL(EPD_CS, EPD_DC, EPD_RST, EPD_BUSY));
 
 // Home Assistant client
 HAClient haClient;
@@ -23,52 +24,238 @@ HAClient haClient;
 // Non-volatile storage for configuration
 Preferences prefs;
 
-/* Program entry point.
- */
-void setup()
-{
-  unsigned long startTime = millis();
-  Serial.begin(SERIAL_BAUDRATE);
+// Everything drawn on this wake, laid out once and replayed per band
+DisplayList frame;
 
-  disableBuiltinLED();
+// What the steps of a wake hand on to each other
+struct Wake {
+  uint32_t batteryVoltage = UINT32_MAX;
+  bool lowBatFirst = false;   // the battery was found low for the first time
+  int wifiRSSI = 0; // “Received Signal Strength Indicator"
+  wl_status_t wifiStatus = WL_IDLE_STATUS;
+  tm timeInfo = {};
+#if THIN_CLIENT
+  CompressedFrame storedFrame;
+  CompressedFrame remoteFrame;
+#else
+  HAResponse response;
+#endif
+};
 
+/* Reads the battery and the low battery flag from NVS. Fails when the
+ * battery is low, so that WiFi is never started on it.
+ */
+static bool checkBattery(void *arg)
+{
   // Open namespace for read/write to non-volatile storage
   prefs.begin("calendar", false);
+  bool low = false;
 
 #if BATTERY_MONITORING
-  uint32_t batteryVoltage = readBatteryVoltage();
+  Wake &wake = *(Wake *)arg;
+  wake.batteryVoltage = readBatteryVoltage();
   Serial.print(TXT_BATTERY_VOLTAGE);
-  Serial.println(": " + String(batteryVoltage) + "mv");
+  Serial.println(": " + String(wake.batteryVoltage) + "mv");
+
+  noteBatteryPercent(batteryPercent(wake.batteryVoltage));
 
+  // The voltage thresholds are the fallback for when the energy budget in
+  // beginDeepSleep() was estimated wrong.
   // When the battery is low, the display should be updated to reflect that, but
   // only the first time we detect low voltage. The next time the display will
   // refresh is when voltage is no longer low. To keep track of that we will
   // make use of non-volatile storage.
   bool lowBat = prefs.getBool("lowBat", false);
+  low = wake.batteryVoltage <= LOW_BATTERY_VOLTAGE;
+  if (low != lowBat)
+  { // battery is now low for the first time, or no longer low
+    prefs.putBool("lowBat", low);
+    wake.lowBatFirst = low;
+  }
+#endif
 
+  // All data should have been loaded from NVS. Close filesystem.
+  prefs.end();
+  return !low;
+}
+
+static bool startDisplay(void *)
+{
+  initDisplay();
+  return true;
+}
+
+static bool connectWiFi(void *arg)
+{
+  Wake &wake = *(Wake *)arg;
+  markPhase(PHASE_WIFI);
+  wake.wifiStatus = startWiFi(wake.wifiRSSI);
+  if (wake.wifiStatus != WL_CONNECTED)
+  {
+    killWiFi();
+    return false;
+  }
+  markPhase(PHASE_HTTP);
+  return true;
+}
+
+#if BATTERY_MONITORING
+/* The radio draws most while WiFi is up, which shows how much the battery
+ * sags. Runs once the panel is initialized too, so that its reset doesn't
+ * add to the current.
+ */
+static bool measureSag(void *)
+{
+  measureBatterySag();
+  return true;
+}
+#endif
+
+#if THIN_CLIENT
+// Thin client: the frame is rendered off-device, so there is nothing to
+// parse or lay out, only a download to stream to the panel
+
+static bool loadFrame(void *arg)
+{
+  Wake &wake = *(Wake *)arg;
+  loadStoredFrame(wake.storedFrame);  // without one the full frame is fetched
+  return true;
+}
+
+static bool fetchFrame(void *arg)
+{
+  Wake &wake = *(Wake *)arg;
+  bool fetched = haClient.fetchFrame(wake.remoteFrame, wake.storedFrame,
+                                     &wake.timeInfo);
+  killWiFi();
+  markPhase(PHASE_RENDER);
+  return fetched;
+}
+
+static void showFrame(Wake &wake)
+{
+  bool shown = drawCompressedFrame(wake.remoteFrame);
+  powerOffDisplay();
+  // The next delta is made against this frame, refreshed or not. Rows the
+  // delta left alone are copied packed, so an unchanged frame compares
+  // equal without decoding either.
+  if (shown && !wake.remoteFrame.samePacking(wake.storedFrame))
+  {
+    storeFrame(wake.remoteFrame);
+  }
+}
+#else
+
+static bool fetchCalendar(void *arg)
+{
+  Wake &wake = *(Wake *)arg;
+  // Fetch calendar data (HA API or sample data based on config)
+  Serial.println("Fetching calendar data...");
+  wake.response = haClient.fetchCalendarData();
+
+  // Disconnect WiFi to save power
+  killWiFi();
+  markPhase(PHASE_RENDER);
+  return wake.response.success;
+}
+
+static bool layOutCalendar(void *arg)
+{
+  Wake &wake = *(Wake *)arg;
+  HAResponse &response = wake.response;
+  Serial.printf("Successfully loaded %d events\n", response.events.size());
+
+  // Parse time from Home Assistant response (no need for NTP!)
+  if (!parseHADateTime(response.currentDate, response.currentTime,
+                       &wake.timeInfo))
+  {
+    return false;
+  }
+
+    // LAYOUT ONCE, THEN RENDER FULL REFRESH PAGE BY PAGE
+  // Draw calendar grid with events using response object directly
+  drawCalendar(frame, response.events, response.currentDate, response.currentDay,
+               response.currentTime, response.weekStart);
+  drawStatusBar(frame, response.currentTime, wake.wifiRSSI,
+                wake.batteryVoltage);
+  Serial.printf("Laid out %d draw commands\n", frame.size());
+  return true;
+}
+
+static void showCalendar()
+{
+  drawDisplayList(frame);
+  powerOffDisplay();
+}
+#endif
+
+/* Shows the error laid out in frame on the panel, which the wake graph has
+ * initialized already.
+ */
+static void showError()
+{
+  drawDisplayList(frame);
+  powerOffDisplay();
+}
+
+/* Program entry point. The steps of the wake up to the refresh run as a
+ * dependency graph, see wake_graph.h: the panel is reset while WiFi
+ * associates. The first step that fails decides the error shown instead of
+ * the frame.
+ */
+void setup()
+{
+  unsigned long startTime = millis();
+  markPhase(PHASE_BOOT);  // drops to the boot clock
+  Serial.begin(SERIAL_BAUDRATE);
+
+  disableBuiltinLED();
+
+  Wake wake;
+  WakeGraph graph = {};
+  // The path to the refresh first, the first task that can run is taken
+  int battery = graphAdd(graph, "battery", checkBattery, &wake);
+  int wifi = graphAdd(graph, "wifi", connectWiFi, &wake, GRAPH_BIT(battery));
+  // A low battery leaves the panel as it is, unless it shows the warning
+  int panel = graphAdd(graph, "display", startDisplay, &wake,
+                       GRAPH_BIT(battery));
+  // The download turns WiFi off, so it waits for the sag to be read
+  uint16_t online = GRAPH_BIT(wifi);
+#if BATTERY_MONITORING
+  online = GRAPH_BIT(graphAdd(graph, "battery sag", measureSag, &wake,
+                              GRAPH_BIT(wifi) | GRAPH_BIT(panel)));
+#endif
+#if THIN_CLIENT
+  int stored = graphAdd(graph, "stored frame", loadFrame, &wake);
+  int fetch = graphAdd(graph, "fetch", fetchFrame, &wake,
+                       online | GRAPH_BIT(stored));
+#else
+  int fetch = graphAdd(graph, "fetch", fetchCalendar, &wake, online);
+  int layout = graphAdd(graph, "layout", layOutCalendar, &wake,
+                        GRAPH_BIT(fetch));
+#endif
+  graphRunTasks(graph, WAKE_GRAPH_WORKERS);
+
+#if BATTERY_MONITORING
   // low battery, deep sleep now
-  if (batteryVoltage <= LOW_BATTERY_VOLTAGE)
+  if (!graphSucceeded(graph, battery))
   {
-    if (lowBat == false)
+    if (wake.lowBatFirst)
     { // battery is now low for the first time
-      prefs.putBool("lowBat", true);
-      prefs.end();
       initDisplay();
-      do
-      {
-        drawError(battery_alert_0deg_196x196, TXT_LOW_BATTERY);
-      } while (display.nextPage());
+      drawError(frame, battery_alert_0deg_196x196, TXT_LOW_BATTERY);
+      drawDisplayList(frame);
       powerOffDisplay();
     }
 
-    if (batteryVoltage <= CRIT_LOW_BATTERY_VOLTAGE)
+    if (wake.batteryVoltage <= CRIT_LOW_BATTERY_VOLTAGE)
     { // critically low battery
       // don't set esp_sleep_enable_timer_wakeup();
       // We won't wake up again until someone manually presses the RST button.
       Serial.println(TXT_CRIT_LOW_BATTERY_VOLTAGE);
       Serial.println(TXT_HIBERNATING_INDEFINITELY_NOTICE);
     }
-    else if (batteryVoltage <= VERY_LOW_BATTERY_VOLTAGE)
+    else if (wake.batteryVoltage <= VERY_LOW_BATTERY_VOLTAGE)
     { // very low battery
       esp_sleep_enable_timer_wakeup(VERY_LOW_BATTERY_SLEEP_INTERVAL
                                     * 60ULL * 1000000ULL);
@@ -86,106 +273,71 @@ void setup()
     }
     esp_deep_sleep_start();
   }
-  // battery is no longer low, reset variable in non-volatile storage
-  if (lowBat == true)
-  {
-    prefs.putBool("lowBat", false);
-  }
-#else
-  uint32_t batteryVoltage = UINT32_MAX;
 #endif
 
-  // All data should have been loaded from NVS. Close filesystem.
-  prefs.end();
-
-  String refreshTimeStr = {};
-  tm timeInfo = {};
-
-
-    // START WIFI
-  int wifiRSSI = 0; // “Received Signal Strength Indicator"
-  wl_status_t wifiStatus = startWiFi(wifiRSSI);
-  if (wifiStatus != WL_CONNECTED)
+  if (!graphSucceeded(graph, wifi))
   { // WiFi Connection Failed
-    killWiFi();
-    initDisplay();
-    if (wifiStatus == WL_NO_SSID_AVAIL)
+    if (wake.wifiStatus == WL_NO_SSID_AVAIL)
     {
       Serial.println(TXT_NETWORK_NOT_AVAILABLE);
-      do
-      {
-        drawError(wifi_x_196x196, TXT_NETWORK_NOT_AVAILABLE);
-      } while (display.nextPage());
+      drawError(frame, wifi_x_196x196, TXT_NETWORK_NOT_AVAILABLE);
     }
     else
     {
       Serial.println(TXT_WIFI_CONNECTION_FAILED);
-      do
-      {
-        drawError(wifi_x_196x196, TXT_WIFI_CONNECTION_FAILED);
-      } while (display.nextPage());
+      drawError(frame, wifi_x_196x196, TXT_WIFI_CONNECTION_FAILED);
     }
-    powerOffDisplay();
-    beginDeepSleep(startTime, &timeInfo);
+    showError();
+    beginDeepSleep(startTime, &wake.timeInfo);
   }
 
-  // Fetch calendar data (HA API or sample data based on config)
-  Serial.println("Fetching calendar data...");
-  HAResponse response = haClient.fetchCalendarData();
-
-  // Disconnect WiFi to save power
-  killWiFi();
-
-  if (!response.success) {
+  if (!graphSucceeded(graph, fetch))
+  {
+#if THIN_CLIENT
+    drawError(frame, wifi_x_196x196, "Frame Download Error", "Check FRAME_URL");
+#else
     Serial.println("Failed to fetch calendar data");
 
     // Display error on screen
-    initDisplay();
-    do {
-      drawError(wifi_x_196x196, "Calendar Data Error", "Check configuration");
-    } while (display.nextPage());
-    powerOffDisplay();
+    drawError(frame, wifi_x_196x196, "Calendar Data Error", "Check configuration");
+#endif
+    showError();
 
     // Sleep for 2 minutes before retry
     esp_sleep_enable_timer_wakeup(2 * 60 * 1000000ULL);
     esp_deep_sleep_start();
   }
 
-  Serial.printf("Successfully loaded %d events\n", response.events.size());
-
-  // Parse time from Home Assistant response (no need for NTP!)
-  if (!parseHADateTime(response.currentDate, response.currentTime, &timeInfo)) {
+#if !THIN_CLIENT
+  if (!graphSucceeded(graph, layout))
+  {
     Serial.println("Failed to parse time from Home Assistant");
 
     // Display error on screen
-    initDisplay();
-    do {
-      drawError(wi_time_4_196x196, TXT_TIME_SYNCHRONIZATION_FAILED);
-    } while (display.nextPage());
-    powerOffDisplay();
+    drawError(frame, wi_time_4_196x196, TXT_TIME_SYNCHRONIZATION_FAILED);
+    showError();
 
     // Sleep for 2 minutes before retry
     esp_sleep_enable_timer_wakeup(2 * 60 * 1000000ULL);
     esp_deep_sleep_start();
   }
+#endif
 
-  // Format refresh time string from response
-  refreshTimeStr = response.currentTime;
-
-    // RENDER FULL REFRESH
-  initDisplay();
-  do
+  // The refresh runs on this task once the workers are gone: their stacks
+  // are back on the heap the frame buffer is sized from, and the panel
+  // transfer has RENDER_TRANSFER_CORE to itself
+  if (graphSucceeded(graph, panel))
   {
-   // Draw calendar grid with events using response object directly
-  drawCalendar(response.events, response.currentDate, response.currentDay,
-                   response.currentTime, response.weekStart);
-    drawStatusBar(refreshTimeStr, wifiRSSI, batteryVoltage);
-  } while (display.nextPage());
-  powerOffDisplay();
+#if THIN_CLIENT
+    showFrame(wake);
+#else
+    showCalendar();
+#endif
+  }
 
   // DEEP SLEEP
-  beginDeepSleep(startTime, &timeInfo);
-}
+  beginDeepSleep(startTime, &wake.timeInfo);
+} // end setup
 
 void loop() {
   // This should never be reached because the device enters deep sleep
@@ -0,0 +1,68 @@
+#include "packbits.h"
+#include <string.h>
+
+size_t packbitsDecode(const uint8_t *src, uint8_t *dst, size_t length)
+{
+  const uint8_t *in = src;
+  size_t out = 0;
+  while (out < length)
+  {
+    int8_t n = (int8_t)*in++;
+    if (n >= 0)
+    {
+      size_t count = n + 1;
+      if (count > length - out)
+      {
+        count = length - out;
+      }
+      memcpy(dst + out, in, count);
+      in += n + 1;
+      out += count;
+    }
+    else if (n != -128)
+    {
+      size_t count = 1 - n;
+      if (count > length - out)
+      {
+        count = length - out;
+      }
+      memset(dst + out, *in++, count);
+      out += count;
+    }
+  }
+  return in - src;
+} // end packbitsDecode
+
+void PackbitsReader::read(uint8_t *dst, size_t length)
+{
+  size_t out = 0;
+  while (out < length)
+  {
+    if (!pending)
+    {
+      int8_t n = (int8_t)*in++;
+      if (n == -128)
+      {
+        continue;
+      }
+      literal = n >= 0;
+      pending = literal ? n + 1 : 1 - n;
+    }
+    size_t count = pending < length - out ? pending : length - out;
+    if (literal)
+    {
+      memcpy(dst + out, in, count);
+      in += count;
+    }
+    else
+    {
+      memset(dst + out, *in, count);
+    }
+    out += count;
+    pending -= count;
+    if (!pending && !literal)
+    {
+      in++;     // past the repeated byte
+    }
+  }
+} // end PackbitsReader::read
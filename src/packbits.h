@@ -0,0 +1,96 @@
+#ifndef PACKBITS_H
+#define PACKBITS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* PackBits run length coding, as used by TIFF and MacPaint. Each packet
+ * starts with a header byte n:
+ *   0 ... 127    n + 1 literal bytes follow
+ *   -127 ... -1  one byte follows, repeated 1 - n times
+ *   -128         no operation
+ * Mostly white bitmap rows shrink to a couple of bytes, and decoding needs no
+ * state beyond the input and output pointers.
+ */
+
+// Longest run or literal a single packet can hold
+#define PACKBITS_MAX_PACKET 128
+
+/* Encodes length bytes from src. Returns the encoded size; dst may be
+ * nullptr to only compute it. constexpr so that tables can be compressed at
+ * compile time.
+ */
+constexpr size_t packbitsEncode(const uint8_t *src, size_t length,
+                                uint8_t *dst)
+{
+  size_t out = 0;
+  size_t i = 0;
+  while (i < length)
+  {
+    size_t run = 1;
+    while (i + run < length && run < PACKBITS_MAX_PACKET &&
+           src[i + run] == src[i])
+    {
+      run++;
+    }
+    if (run >= 2)
+    {
+      if (dst)
+      {
+        dst[out] = (uint8_t)(1 - (int)run);
+        dst[out + 1] = src[i];
+      }
+      out += 2;
+      i += run;
+      continue;
+    }
+
+    // Literal packet up to the next run of three or more equal bytes; a
+    // run of two inside a literal costs no more than its own packet
+    size_t literal = 1;
+    while (i + literal < length && literal < PACKBITS_MAX_PACKET)
+    {
+      size_t j = i + literal;
+      if (j + 2 < length && src[j] == src[j + 1] && src[j] == src[j + 2])
+      {
+        break;
+      }
+      literal++;
+    }
+    if (dst)
+    {
+      dst[out] = (uint8_t)(literal - 1);
+      for (size_t k = 0; k < literal; k++)
+      {
+        dst[out + 1 + k] = src[i + k];
+      }
+    }
+    out += 1 + literal;
+    i += literal;
+  }
+  return out;
+} // end packbitsEncode
+
+/* Decodes packets from src until length bytes have been written to dst.
+ * Returns the number of input bytes consumed. A packet that would overrun
+ * dst is cut short.
+ */
+size_t packbitsDecode(const uint8_t *src, uint8_t *dst, size_t length);
+
+/* Decodes a PackBits stream in pieces of any length. Unlike
+ * packbitsDecode(), a packet may span the end of a piece, as it does when a
+ * whole bitmap was encoded in one go and is then read a row at a time.
+ */
+class PackbitsReader {
+public:
+  explicit PackbitsReader(const uint8_t *src) : in(src) {}
+  // Writes the next length bytes of the stream to dst
+  void read(uint8_t *dst, size_t length);
+
+private:
+  const uint8_t *in;      // next header, literal byte or repeated byte
+  uint8_t pending = 0;    // bytes of the current packet still to write
+  bool literal = false;
+};
+
+#endif // PACKBITS_H
@@ -0,0 +1,85 @@
+#ifndef PACKED_ICON_H
+#define PACKED_ICON_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "packbits.h"
+
+/* Icons are stored in flash PackBits compressed. They are drawn as inverted
+ * bitmaps, mostly white with a few strokes of ink. Their rows are only two
+ * to four bytes wide for the status icons, too short to compress on their
+ * own, so each icon is encoded as one stream and runs of white continue
+ * across rows. The stream is built at compile time from the byte padded
+ * bitmaps in icons.cpp, like the chrome in static_chrome.h; the bitmaps
+ * themselves are only used by the compiler and never reach flash.
+ *
+ * Drawing reads the stream a row at a time into a single row buffer, see
+ * PackbitsReader, and hands each row to the blitter, so no icon is ever
+ * unpacked whole.
+ */
+
+// Widest icon supported, in pixels
+#define ICON_MAX_WIDTH 200
+
+struct PackedIcon {
+  int16_t width;
+  int16_t height;
+  const uint8_t *data;    // height rows of (width + 7) / 8 bytes, packed
+};
+
+/* Compresses a byte padded w x h bitmap. Returns the compressed size; data
+ * may be nullptr to only compute it.
+ */
+constexpr size_t encodeIcon(const uint8_t *bitmap, int16_t w, int16_t h,
+                            uint8_t *data)
+{
+  return packbitsEncode(bitmap, (size_t)(w + 7) / 8 * h, data);
+}
+
+template <size_t Bytes>
+struct StaticIcon {
+  int16_t width;
+  int16_t height;
+  uint8_t data[Bytes];
+
+  constexpr PackedIcon icon() const { return {width, height, data}; }
+};
+
+/* Builds the compressed icon of a w x h bitmap. Bytes must come from
+ * encodeIcon(bitmap, w, h, nullptr).
+ */
+template <size_t Bytes>
+constexpr StaticIcon<Bytes> buildStaticIcon(const uint8_t *bitmap, int16_t w,
+                                            int16_t h)
+{
+  StaticIcon<Bytes> icon = {w, h, {}};
+  encodeIcon(bitmap, w, h, icon.data);
+  return icon;
+}
+
+/* Calls fn(y, row) for the rows [first, last) of icon, y counting from its
+ * top, row being (width + 7) / 8 bytes. Rows above first are decoded too,
+ * as the stream can only be read in order.
+ */
+template <typename Fn>
+void forEachIconRow(const PackedIcon &icon, int16_t first, int16_t last,
+                    Fn fn)
+{
+  const int16_t rowBytes = (icon.width + 7) / 8;
+  uint8_t row[(ICON_MAX_WIDTH + 7) / 8];
+  PackbitsReader reader(icon.data);
+  if (last > icon.height)
+  {
+    last = icon.height;
+  }
+  for (int16_t y = 0; y < last; y++)
+  {
+    reader.read(row, rowBytes);
+    if (y >= first)
+    {
+      fn(y, (const uint8_t *)row);
+    }
+  }
+}
+
+#endif // PACKED_ICON_H
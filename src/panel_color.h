@@ -0,0 +1,14 @@
+#ifndef PANEL_COLOR_H
+#define PANEL_COLOR_H
+
+// GxEPD2's colors, which display lists are recorded in. Native builds have no
+// GxEPD2, so the three a panel shows are mirrored here for them.
+#ifdef UNIT_TEST
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+#define GxEPD_RED   0xF800
+#else
+#include <GxEPD2.h>
+#endif
+
+#endif // PANEL_COLOR_H
@@ -0,0 +1,60 @@
+#include "span_raster.h"
+
+static constexpr CornerTable cornerTable = makeCornerTable();
+
+void fillRectSpans(BandBuffer &band, int16_t x, int16_t y, int16_t w,
+                   int16_t h, ink_t ink)
+{
+  fillRoundRectSpans(band, x, y, w, h, 0, 0, ink);
+}
+
+bool fillRoundRectSpans(BandBuffer &band, int16_t x, int16_t y, int16_t w,
+                        int16_t h, int16_t r, uint8_t corners, ink_t ink)
+{
+  int16_t maxRadius = (w < h ? w : h) / 2;
+  if (r > maxRadius)
+  {
+    r = maxRadius;
+  }
+  if (r > SPAN_MAX_RADIUS)
+  {
+    return false;
+  }
+  if (r <= 0)
+  {
+    corners = 0;
+  }
+
+  // Rows of the shape inside the band
+  int16_t first = band.top() > y ? band.top() - y : 0;
+  int16_t last = band.top() + band.rows() - y;
+  if (last > h)
+  {
+    last = h;
+  }
+  const uint8_t *inset = cornerTable.of(r);
+  for (int16_t dy = first; dy < last; dy++)
+  {
+    int16_t left = 0;
+    int16_t right = 0;
+    if (dy < r)
+    {
+      left = corners & CORNER_TOP_LEFT ? inset[dy] : 0;
+      right = corners & CORNER_TOP_RIGHT ? inset[dy] : 0;
+    }
+    else if (dy >= h - r)
+    {
+      left = corners & CORNER_BOTTOM_LEFT ? inset[h - 1 - dy] : 0;
+      right = corners & CORNER_BOTTOM_RIGHT ? inset[h - 1 - dy] : 0;
+    }
+    band.fillRowSpan(y + dy - band.top(), x + left, w - left - right, ink);
+  }
+  return true;
+} // end fillRoundRectSpans
+
+bool fillCircleSpans(BandBuffer &band, int16_t x0, int16_t y0, int16_t r,
+                     ink_t ink)
+{
+  return fillRoundRectSpans(band, x0 - r, y0 - r, 2 * r + 1, 2 * r + 1, r,
+                            CORNERS_ALL, ink);
+}
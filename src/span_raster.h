@@ -0,0 +1,115 @@
+#ifndef SPAN_RASTER_H
+#define SPAN_RASTER_H
+
+#include <stdint.h>
+#include "band_buffer.h"
+
+/* Filled shapes written straight into the planes of a BandBuffer as one
+ * horizontal span per row. Adafruit_GFX builds a rounded rectangle from
+ * overlapping rectangles and circles that end up pixel by pixel in
+ * drawPixel(); here the rows are clipped to the band once per shape and
+ * each row is a single byte-wise fill.
+ *
+ * The corners are the quarter circles Adafruit_GFX draws, precomputed at
+ * compile time for every radius up to SPAN_MAX_RADIUS, so shapes come out
+ * pixel identical to the GFX ones.
+ */
+
+#define SPAN_MAX_RADIUS 15
+
+// Corners of fillRoundRectSpans()
+#define CORNER_TOP_LEFT     0x01
+#define CORNER_TOP_RIGHT    0x02
+#define CORNER_BOTTOM_LEFT  0x04
+#define CORNER_BOTTOM_RIGHT 0x08
+#define CORNERS_LEFT        (CORNER_TOP_LEFT | CORNER_BOTTOM_LEFT)
+#define CORNERS_RIGHT       (CORNER_TOP_RIGHT | CORNER_BOTTOM_RIGHT)
+#define CORNERS_ALL         (CORNERS_LEFT | CORNERS_RIGHT)
+
+/* Writes the r insets of a top left corner of radius r: for each row from
+ * the top, the pixels left blank from the edge. Follows the midpoint circle
+ * of Adafruit_GFX's fillCircleHelper().
+ */
+constexpr void cornerInsets(int16_t r, uint8_t *inset)
+{
+  for (int16_t row = 0; row < r; row++)
+  {
+    inset[row] = r;
+  }
+  // Column and rows relative to the centre of the corner circle
+  auto vline = [&](int16_t column, int16_t top, int16_t height) {
+    for (int16_t y = top; y < top + height && y < 0; y++)
+    {
+      if (r + column < inset[r + y])
+      {
+        inset[r + y] = r + column;
+      }
+    }
+  };
+  int16_t f = 1 - r;
+  int16_t ddFx = 1;
+  int16_t ddFy = -2 * r;
+  int16_t x = 0;
+  int16_t y = r;
+  int16_t px = x;
+  int16_t py = y;
+  while (x < y)
+  {
+    if (f >= 0)
+    {
+      y--;
+      ddFy += 2;
+      f += ddFy;
+    }
+    x++;
+    ddFx += 2;
+    f += ddFx;
+    if (x < y + 1)
+    {
+      vline(-x, -y, 2 * y + 1);
+    }
+    if (y != py)
+    {
+      vline(-py, -px, 2 * px + 1);
+      py = y;
+    }
+    px = x;
+  }
+} // end cornerInsets
+
+// Insets of all radii, those of radius r start at offset r * (r - 1) / 2
+struct CornerTable {
+  uint8_t insets[SPAN_MAX_RADIUS * (SPAN_MAX_RADIUS + 1) / 2];
+
+  constexpr const uint8_t *of(int16_t r) const
+  {
+    return insets + r * (r - 1) / 2;
+  }
+};
+
+constexpr CornerTable makeCornerTable()
+{
+  CornerTable table = {};
+  for (int16_t r = 1; r <= SPAN_MAX_RADIUS; r++)
+  {
+    cornerInsets(r, table.insets + r * (r - 1) / 2);
+  }
+  return table;
+}
+
+// Fills a rectangle, clipped to the band
+void fillRectSpans(BandBuffer &band, int16_t x, int16_t y, int16_t w,
+                   int16_t h, ink_t ink);
+
+/* Fills a rectangle with the given corners rounded, the way
+ * Adafruit_GFX::fillRoundRect() does with all four. Returns false without
+ * drawing if r is larger than SPAN_MAX_RADIUS.
+ */
+bool fillRoundRectSpans(BandBuffer &band, int16_t x, int16_t y, int16_t w,
+                        int16_t h, int16_t r, uint8_t corners, ink_t ink);
+
+// Fills a circle the way Adafruit_GFX::fillCircle() does
+bool fillCircleSpans(BandBuffer &band, int16_t x0, int16_t y0, int16_t r,
+                     ink_t ink);
+
+#endif // SPAN_RASTER_H
@@ -0,0 +1,182 @@
+#ifndef SPARSE_FONT_H
+#define SPARSE_FONT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "gfx_font.h"
+
+/* Adafruit GFX fonts index their glyphs by first ... last, so a handful of
+ * accented letters would need the whole Latin-1 block. A sparse font keeps
+ * the GFX bitmap and glyph tables but maps code points to glyphs through a
+ * sorted list of ranges. The first range is printable ASCII and is indexed
+ * directly; other code points binary search the remaining ranges.
+ *
+ * The font headers are written by tools/fontsubset.py.
+ */
+
+// Code points first ... last, whose glyphs start at glyphs[glyph]
+struct GlyphRange {
+  uint16_t first;
+  uint16_t last;
+  uint16_t glyph;
+};
+
+struct SparseFont {
+  const uint8_t *bitmap;
+  const GFXglyph *glyphs;
+  const GlyphRange *ranges;   // sorted, ranges[0] is ASCII
+  uint16_t rangeCount;
+  uint8_t yAdvance;
+};
+
+#define UTF8_REPLACEMENT 0xFFFD
+
+/* Decodes the UTF-8 sequence starting at text[i] and advances i past it.
+ * Malformed or truncated sequences decode as U+FFFD.
+ */
+constexpr uint32_t decodeUtf8(const char *text, size_t length, size_t &i)
+{
+  uint8_t c = text[i++];
+  if (c < 0x80)
+  {
+    return c;
+  }
+  int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : c >= 0xC0 ? 1 : 0;
+  if (extra == 0 || c >= 0xF8)
+  {
+    return UTF8_REPLACEMENT;   // stray continuation byte or invalid lead
+  }
+  uint32_t cp = c & (0x3F >> extra);
+  for (int k = 0; k < extra; k++)
+  {
+    if (i >= length || ((uint8_t)text[i] & 0xC0) != 0x80)
+    {
+      return UTF8_REPLACEMENT;
+    }
+    cp = (cp << 6) | ((uint8_t)text[i++] & 0x3F);
+  }
+  return cp;
+}
+
+/* Returns the glyph for cp, or nullptr if the font has none.
+ */
+constexpr const GFXglyph *findGlyph(const SparseFont &font, uint32_t cp)
+{
+  const GlyphRange &ascii = font.ranges[0];
+  if (cp >= ascii.first && cp <= ascii.last)
+  {
+    return &font.glyphs[ascii.glyph + cp - ascii.first];
+  }
+  uint16_t lo = 1;
+  uint16_t hi = font.rangeCount;
+  while (lo < hi)
+  {
+    uint16_t mid = (lo + hi) / 2;
+    const GlyphRange &range = font.ranges[mid];
+    if (cp < range.first)
+    {
+      hi = mid;
+    }
+    else if (cp > range.last)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      return &font.glyphs[range.glyph + cp - range.first];
+    }
+  }
+  return nullptr;
+}
+
+/* ASCII drawn instead of a code point the font has no glyph for.
+ */
+constexpr const char *glyphFallback(uint32_t cp)
+{
+  switch (cp)
+  {
+  case 0x00A0:              // no-break space
+    return " ";
+  case 0x00DF:              // sharp s
+    return "ss";
+  case 0x2010: case 0x2011: case 0x2012: case 0x2013: case 0x2014:
+    return "-";
+  case 0x2018: case 0x2019: case 0x201A:
+    return "'";
+  case 0x00AB: case 0x00BB: case 0x201C: case 0x201D: case 0x201E:
+    return "\"";
+  case 0x2026:
+    return "...";
+  default:
+    return "?";
+  }
+}
+
+/* Calls fn(glyph, dx) for each glyph drawn for cp, dx being its offset from
+ * the pen position of cp. That is the glyph of cp itself or, if the font has
+ * none, the glyphs of its fallback.
+ */
+template <typename Fn>
+constexpr void forEachCodepointGlyph(const SparseFont &font, uint32_t cp,
+                                     Fn fn)
+{
+  const GFXglyph *glyph = findGlyph(font, cp);
+  if (glyph)
+  {
+    fn(*glyph, 0);
+    return;
+  }
+  int16_t dx = 0;
+  for (const char *s = glyphFallback(cp); *s; s++)
+  {
+    const GFXglyph *fallback = findGlyph(font, (uint8_t)*s);
+    if (fallback)
+    {
+      fn(*fallback, dx);
+      dx += fallback->xAdvance;
+    }
+  }
+}
+
+// Horizontal extent of one code point
+struct CodepointMetrics {
+  int16_t advance;
+  int16_t inkRight;   // right edge of the ink from the pen, 0 if blank
+};
+
+constexpr CodepointMetrics measureCodepoint(const SparseFont &font,
+                                            uint32_t cp)
+{
+  CodepointMetrics m = {0, 0};
+  forEachCodepointGlyph(font, cp, [&](const GFXglyph &glyph, int16_t dx) {
+    if (glyph.width)
+    {
+      m.inkRight = dx + glyph.xOffset + glyph.width;
+    }
+    m.advance = dx + glyph.xAdvance;
+  });
+  return m;
+}
+
+/* Calls fn(glyph, x) for every glyph of length bytes of UTF-8 text, x being
+ * the pen position of the glyph.
+ */
+template <typename Fn>
+constexpr void forEachTextGlyph(const SparseFont &font, const char *text,
+                                size_t length, Fn fn)
+{
+  int16_t pen = 0;
+  size_t i = 0;
+  while (i < length)
+  {
+    int16_t advance = 0;
+    forEachCodepointGlyph(font, decodeUtf8(text, length, i),
+                          [&](const GFXglyph &glyph, int16_t dx) {
+                            fn(glyph, (int16_t)(pen + dx));
+                            advance = dx + glyph.xAdvance;
+                          });
+    pen += advance;
+  }
+}
+
+#endif // SPARSE_FONT_H
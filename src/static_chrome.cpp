@@ -0,0 +1,51 @@
+#include "static_chrome.h"
+#include "calendar_view.h"
+#include "DongleLight9pt15b.h"
+
+/* Chrome of a calendar grid: a weekday label centred over every column, the
+ * header line and a separator between consecutive weeks.
+ */
+template <class View>
+static constexpr ChromeSpec makeCalendarChromeSpec()
+{
+  ChromeSpec spec = {};
+  spec.width = View::width;
+  spec.height = View::cellY(View::weeks - 1) + 1;
+  spec.font = &Dongle_Light15pt;
+  const char *weekdays[] = {TXT_MONDAY, TXT_TUESDAY, TXT_WEDNESDAY,
+                            TXT_THURSDAY, TXT_FRIDAY, TXT_SATURDAY, TXT_SUNDAY};
+  for (int i = 0; i < View::columns; i++)
+  {
+    spec.labels[i] = weekdays[i];
+  }
+  spec.labelCount = View::columns;
+  spec.labelPlane = CHROME_PLANE_BLACK;
+  spec.cellWidth = View::dayWidth;
+  spec.baseline = View::headerHeight - HEADER_TEXT_Y_OFFSET;
+  spec.lines[spec.lineCount++] = View::headerHeight;
+  for (int week = 1; week < View::weeks; week++)
+  {
+    spec.lines[spec.lineCount++] = View::cellY(week);
+  }
+  spec.linePlane = CHROME_PLANE_BLACK;
+  return spec;
+}
+
+static constexpr ChromeSpec calendarChromeSpec =
+    makeCalendarChromeSpec<CalendarView>();
+
+static constexpr ChromeSize calendarChromeSize =
+    encodeChrome(calendarChromeSpec, nullptr, nullptr);
+
+// Generated by the compiler, no pixels are rendered at run time
+static constexpr auto calendarChrome =
+    buildStaticChrome<calendarChromeSize.rows, calendarChromeSize.bytes>(
+        calendarChromeSpec);
+
+static const ChromeImage calendarChromeImage =
+    calendarChrome.image(CalendarView::width);
+
+const ChromeImage &getCalendarChrome()
+{
+  return calendarChromeImage;
+}
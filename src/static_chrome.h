@@ -0,0 +1,256 @@
+#ifndef STATIC_CHROME_H
+#define STATIC_CHROME_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sparse_font.h"
+#include "packbits.h"
+
+/* The weekday headers, the header line and the week separators look the same
+ * on every wake. They are rasterized at compile time from the layout
+ * constants and locale strings in config.h, PackBits compressed row by row
+ * and stored in flash. Drawing a page band then only decodes the rows inside
+ * it instead of rendering the glyphs through Adafruit_GFX again.
+ *
+ * Only rows that contain ink are stored. Each stored row belongs to one of
+ * the two panel planes and uses the GxEPD2 bit order: MSB first, a cleared
+ * bit is ink.
+ */
+
+// Widest chrome supported, in pixels
+#define CHROME_MAX_WIDTH  800
+#define CHROME_MAX_LABELS 7
+#define CHROME_MAX_LINES  8
+
+// Panel planes
+#define CHROME_PLANE_BLACK 0
+#define CHROME_PLANE_RED   1
+
+struct ChromeSpec {
+  int16_t width;                          // multiple of 8
+  int16_t height;                         // rows covered by the chrome
+  const SparseFont *font;                 // constexpr glyph tables
+  const char *labels[CHROME_MAX_LABELS];  // centred in cells left to right
+  uint8_t labelCount;
+  uint8_t labelPlane;
+  int16_t cellWidth;
+  int16_t baseline;                       // y of the label baseline
+  int16_t lines[CHROME_MAX_LINES];        // y of full width lines
+  uint8_t lineCount;
+  uint8_t linePlane;
+};
+
+struct ChromeRow {
+  int16_t y;
+  uint8_t plane;
+  uint16_t offset;    // of the packed row in the data array
+};
+
+struct ChromeSize {
+  uint16_t rows;
+  uint16_t bytes;
+};
+
+// Compressed chrome as used at run time
+struct ChromeImage {
+  int16_t width;
+  const ChromeRow *rows;    // sorted by y
+  uint16_t rowCount;
+  const uint8_t *data;
+};
+
+/* Width of UTF-8 text from the pen origin to the right edge of its ink, the
+ * same measure getTextWidth() uses.
+ */
+constexpr int16_t chromeTextWidth(const SparseFont &font, const char *text)
+{
+  size_t length = 0;
+  while (text[length])
+  {
+    length++;
+  }
+  int16_t pen = 0;
+  int16_t right = 0;
+  size_t i = 0;
+  while (i < length)
+  {
+    CodepointMetrics m = measureCodepoint(font, decodeUtf8(text, length, i));
+    if (m.inkRight && pen + m.inkRight > right)
+    {
+      right = pen + m.inkRight;
+    }
+    pen += m.advance;
+  }
+  return right;
+}
+
+/* Rasterizes one row of one plane into row, width / 8 bytes.
+ */
+constexpr void renderChromeRow(const ChromeSpec &spec, int16_t y,
+                               uint8_t plane, uint8_t *row)
+{
+  const int16_t rowBytes = spec.width / 8;
+  for (int16_t i = 0; i < rowBytes; i++)
+  {
+    row[i] = 0xFF;
+  }
+
+  if (plane == spec.linePlane)
+  {
+    for (uint8_t i = 0; i < spec.lineCount; i++)
+    {
+      if (spec.lines[i] == y)
+      {
+        for (int16_t b = 0; b < rowBytes; b++)
+        {
+          row[b] = 0x00;
+        }
+        return;
+      }
+    }
+  }
+
+  if (plane != spec.labelPlane)
+  {
+    return;
+  }
+  const SparseFont &font = *spec.font;
+  for (uint8_t i = 0; i < spec.labelCount; i++)
+  {
+    const char *label = spec.labels[i];
+    size_t length = 0;
+    while (label[length])
+    {
+      length++;
+    }
+    int16_t left = i * spec.cellWidth +
+                   (spec.cellWidth - chromeTextWidth(font, label)) / 2;
+    forEachTextGlyph(font, label, length,
+                     [&](const GFXglyph &g, int16_t pen) {
+      int16_t gy = y - (spec.baseline + g.yOffset);
+      if (gy < 0 || gy >= g.height)
+      {
+        return;
+      }
+      for (int16_t gx = 0; gx < g.width; gx++)
+      {
+        uint32_t bit = g.bitmapOffset * 8u + gy * g.width + gx;
+        int16_t x = left + pen + g.xOffset + gx;
+        if ((font.bitmap[bit >> 3] & (0x80 >> (bit & 7))) &&
+            x >= 0 && x < spec.width)
+        {
+          row[x >> 3] &= ~(0x80 >> (x & 7));
+        }
+      }
+    });
+  }
+} // end renderChromeRow
+
+/* Renders and compresses every row with ink. rows and data may be nullptr
+ * to only compute the size of the result.
+ */
+constexpr ChromeSize encodeChrome(const ChromeSpec &spec, ChromeRow *rows,
+                                  uint8_t *data)
+{
+  ChromeSize size = {0, 0};
+  uint8_t row[CHROME_MAX_WIDTH / 8] = {};
+  for (int16_t y = 0; y < spec.height; y++)
+  {
+    for (uint8_t plane = CHROME_PLANE_BLACK; plane <= CHROME_PLANE_RED; plane++)
+    {
+      renderChromeRow(spec, y, plane, row);
+      bool ink = false;
+      for (int16_t i = 0; i < spec.width / 8; i++)
+      {
+        ink = ink || row[i] != 0xFF;
+      }
+      if (!ink)
+      {
+        continue;
+      }
+      if (rows)
+      {
+        rows[size.rows] = {y, plane, size.bytes};
+      }
+      size.rows++;
+      size.bytes += packbitsEncode(row, spec.width / 8,
+                                   data ? data + size.bytes : nullptr);
+    }
+  }
+  return size;
+}
+
+template <uint16_t Rows, uint16_t Bytes>
+struct StaticChrome {
+  ChromeRow rows[Rows];
+  uint8_t data[Bytes];
+
+  constexpr ChromeImage image(int16_t width) const
+  {
+    return {width, rows, Rows, data};
+  }
+};
+
+/* Builds the compressed chrome for spec. Rows and Bytes must come from
+ * encodeChrome(spec, nullptr, nullptr).
+ */
+template <uint16_t Rows, uint16_t Bytes>
+constexpr StaticChrome<Rows, Bytes> buildStaticChrome(const ChromeSpec &spec)
+{
+  StaticChrome<Rows, Bytes> chrome = {};
+  encodeChrome(spec, chrome.rows, chrome.data);
+  return chrome;
+}
+
+/* Calls fn(x, y, width, plane) for every horizontal run of ink in the rows
+ * [top, bottom) of chrome.
+ */
+template <typename Fn>
+void forEachChromeRun(const ChromeImage &chrome, int16_t top, int16_t bottom,
+                      Fn fn)
+{
+  const int16_t rowBytes = chrome.width / 8;
+  uint8_t row[CHROME_MAX_WIDTH / 8];
+  for (uint16_t r = 0; r < chrome.rowCount; r++)
+  {
+    const ChromeRow &info = chrome.rows[r];
+    if (info.y < top)
+    {
+      continue;
+    }
+    if (info.y >= bottom)
+    {
+      break;
+    }
+    packbitsDecode(chrome.data + info.offset, row, rowBytes);
+
+    int16_t runStart = -1;
+    for (int16_t b = 0; b <= rowBytes; b++)
+    {
+      uint8_t bits = b < rowBytes ? row[b] : 0xFF;
+      if ((bits == 0xFF && runStart < 0) || (bits == 0x00 && runStart >= 0))
+      {
+        continue;     // whole byte continues the current state
+      }
+      for (int16_t bit = 0; bit < 8; bit++)
+      {
+        bool ink = !(bits & (0x80 >> bit));
+        int16_t x = b * 8 + bit;
+        if (ink && runStart < 0)
+        {
+          runStart = x;
+        }
+        else if (!ink && runStart >= 0)
+        {
+          fn(runStart, info.y, x - runStart, info.plane);
+          runStart = -1;
+        }
+      }
+    }
+  }
+} // end forEachChromeRun
+
+// Chrome of the calendar view, built from config.h
+const ChromeImage &getCalendarChrome();
+
+#endif // STATIC_CHROME_H
@@ -0,0 +1,213 @@
+#include "text_layout.h"
+#include "DongleLight9pt7b.h"
+#include "DongleLight9pt15b.h"
+#include <string.h>
+
+// Vertical and left extents shared by all glyphs of a font, generated at
+// compile time from the glyph tables.
+//
+// Adafruit GFX fonts carry no kerning pairs, so the pen advances by
+// xAdvance only. Measuring and drawing therefore agree exactly.
+struct FontMetrics {
+  int8_t inkLeft;     // smallest xOffset of all glyphs
+  int8_t ascent;      // smallest yOffset, negative
+  int8_t descent;     // largest yOffset + height
+};
+
+template <size_t N>
+static constexpr FontMetrics makeFontMetrics(const GFXglyph (&glyphs)[N])
+{
+  FontMetrics m = {};
+  for (size_t i = 0; i < N; i++)
+  {
+    const GFXglyph &g = glyphs[i];
+    if (g.width && g.xOffset < m.inkLeft)
+    {
+      m.inkLeft = g.xOffset;
+    }
+    if (g.height && g.yOffset < m.ascent)
+    {
+      m.ascent = g.yOffset;
+    }
+    if (g.height && g.yOffset + g.height > m.descent)
+    {
+      m.descent = g.yOffset + g.height;
+    }
+  }
+  return m;
+}
+
+static constexpr FontMetrics fontMetrics[] = {
+  makeFontMetrics(Dongle_Light11ptGlyphs),    // FONT_SMALL
+  makeFontMetrics(Dongle_Light15ptGlyphs)     // FONT_LARGE
+};
+
+static const SparseFont *const fonts[] = {
+  &Dongle_Light11pt,    // FONT_SMALL
+  &Dongle_Light15pt     // FONT_LARGE
+};
+
+/* Returns the glyph tables of a font id.
+ */
+const SparseFont &getFont(font_t font)
+{
+  return *fonts[font];
+}
+
+/* Width of the first length bytes of UTF-8 text: the pen position of the
+ * last code point plus the right edge of its ink.
+ */
+int16_t getTextWidth(const char *text, uint16_t length, font_t font)
+{
+  const SparseFont &f = getFont(font);
+  int16_t pen = 0;
+  int16_t right = 0;
+  size_t i = 0;
+  while (i < length)
+  {
+    CodepointMetrics m = measureCodepoint(f, decodeUtf8(text, length, i));
+    if (m.inkRight && pen + m.inkRight > right)
+    {
+      right = pen + m.inkRight;
+    }
+    pen += m.advance;
+  }
+  return right;
+}
+
+int16_t getTextWidth(const char *text, font_t font)
+{
+  return getTextWidth(text, strlen(text), font);
+}
+
+int16_t getEllipsisWidth(font_t font)
+{
+  return getTextWidth(TEXT_ELLIPSIS, sizeof(TEXT_ELLIPSIS) - 1, font);
+}
+
+/* Box covered by text of the given width drawn with its baseline at x, y.
+ * Uses the font wide ascent and descent, which is all band culling needs.
+ */
+DisplayRect getTextBox(int16_t x, int16_t y, int16_t width, font_t font)
+{
+  const FontMetrics &m = fontMetrics[font];
+  return {(int16_t)(x + m.inkLeft), (int16_t)(y + m.ascent),
+          (int16_t)(x + width), (int16_t)(y + m.descent)};
+}
+
+/* Scans the text once, keeping the pen position, the last break opportunity
+ * and, on the last line, the last position where an ellipsis still fits.
+ * When a code point would overflow the line, the line ends at the last break
+ * opportunity and the code points already measured after it are carried
+ * over to the next line by subtracting their start pen position. Lines only
+ * end between UTF-8 sequences. Nothing is copied or allocated; the lines
+ * reference the input string.
+ */
+uint16_t wrapText(const char *text, font_t font, int16_t maxWidth,
+                  uint16_t maxLines, TextLine *lines)
+{
+  const SparseFont &f = getFont(font);
+  const int16_t ellipsisWidth = getEllipsisWidth(font);
+  const uint16_t length = strlen(text);
+  if (maxLines == 0)
+  {
+    return 0;
+  }
+
+  uint16_t count = 0;
+  uint16_t lineStart = 0;
+  uint16_t breakEnd = 0;      // line end at the last break opportunity
+  uint16_t breakNext = 0;     // where the following line starts
+  int16_t breakPen = 0;       // pen position at breakNext
+  uint16_t ellipsisEnd = 0;   // last line end that leaves room for ellipsis
+  int16_t pen = 0;
+  bool lastLine = (maxLines == 1);
+
+  uint16_t i = 0;
+  while (i < length)
+  {
+    size_t next = i;
+    const uint32_t cp = decodeUtf8(text, length, next);
+    if (cp == ' ' && i == lineStart)
+    {
+      // no leading spaces
+      lineStart = i = next;
+      continue;
+    }
+    const CodepointMetrics m = measureCodepoint(f, cp);
+
+    if (m.inkRight && pen + m.inkRight > maxWidth && i > lineStart)
+    {
+      TextLine &line = lines[count++];
+      line.start = lineStart;
+      if (lastLine)
+      {
+        line.length = ellipsisEnd > lineStart ? ellipsisEnd - lineStart : 0;
+        line.ellipsis = true;
+        return count;
+      }
+      line.ellipsis = false;
+      if (breakEnd > lineStart)
+      {
+        line.length = breakEnd - lineStart;
+        lineStart = breakNext;
+        pen -= breakPen;
+      }
+      else
+      {
+        // a single word wider than the line, break it between code points
+        line.length = i - lineStart;
+        lineStart = i;
+        pen = 0;
+      }
+      breakEnd = lineStart;
+      lastLine = (count == maxLines - 1);
+      if (lastLine)
+      {
+        // find where an ellipsis would fit in the carried over code points
+        int16_t carriedPen = 0;
+        ellipsisEnd = lineStart;
+        size_t j = lineStart;
+        while (j < i)
+        {
+          const uint32_t carried = decodeUtf8(text, length, j);
+          carriedPen += measureCodepoint(f, carried).advance;
+          if (carried != ' ' && carriedPen + ellipsisWidth <= maxWidth)
+          {
+            ellipsisEnd = j;
+          }
+        }
+      }
+      // measure code point i again on the new line
+      continue;
+    }
+
+    if (cp == ' ')
+    {
+      breakEnd = i;
+      breakNext = next;
+      breakPen = pen + m.advance;
+    }
+    pen += m.advance;
+    if (cp == '-' && !lastLine)
+    {
+      breakEnd = next;
+      breakNext = next;
+      breakPen = pen;
+    }
+    if (lastLine && cp != ' ' && pen + ellipsisWidth <= maxWidth)
+    {
+      ellipsisEnd = next;
+    }
+    i = next;
+  }
+
+  if (lineStart < length)
+  {
+    TextLine &line = lines[count++];
+    line.start = lineStart;
+    line.length = length - lineStart;
+    line.ellipsis = false;
+  }
+  return count;
+} // end wrapText
@@ -0,0 +1,37 @@
+#ifndef TEXT_LAYOUT_H
+#define TEXT_LAYOUT_H
+
+#include <stdint.h>
+#include "display_list.h"
+#include "sparse_font.h"
+
+// Text appended to a line that had to be cut short
+#define TEXT_ELLIPSIS "..."
+
+// One line produced by wrapText(), referencing the wrapped string
+struct TextLine {
+  uint16_t start;
+  uint16_t length;
+  bool ellipsis;    // draw TEXT_ELLIPSIS after the line
+};
+
+// Returns the glyph tables of a font id
+const SparseFont &getFont(font_t font);
+
+// Width in pixels of UTF-8 text, from the pen origin to the right edge of
+// the last glyph
+int16_t getTextWidth(const char *text, font_t font);
+int16_t getTextWidth(const char *text, uint16_t length, font_t font);
+int16_t getEllipsisWidth(font_t font);
+
+// Box covered by text drawn with its baseline starting at x, y
+DisplayRect getTextBox(int16_t x, int16_t y, int16_t width, font_t font);
+
+// Greedy word wrap of UTF-8 text into at most maxLines lines of maxWidth
+// pixels. Lines break after spaces and hyphens, words wider than a line are
+// broken between code points and the last line is cut with an ellipsis when
+// text remains. Returns the number of lines written to lines.
+uint16_t wrapText(const char *text, font_t font, int16_t maxWidth,
+                  uint16_t maxLines, TextLine *lines);
+
+#endif // TEXT_LAYOUT_H
@@ -1,32 +1,26 @@
 #include "utilities.h"
 #include "config.h"
+#include "light_sleep.h"
+#include "wake_schedule.h"
+#include "energy.h"
 
 #include <esp_sleep.h>
-#include <GxEPD2_BW.h>
-#include <GxEPD2_3C.h>
 #include <ESPmDNS.h>
-#include <esp_adc_cal.h>
-#include <driver/adc.h>
-
-extern GxEPD2_3C<GxEPD2_750c_Z08, GxEPD2_750c_Z08::HEIGHT / 2> display;
+#include <string.h>
 
 // WiFi functions
 wl_status_t startWiFi(int &wifiRSSI) {
   WiFi.mode(WIFI_STA);
   Serial.printf("%s '%s'\n", TXT_CONNECTING_TO, WIFI_SSID);
 
+  watchWiFi();
   WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
 
   // timeout if WiFi does not connect in WIFI_TIMEOUT ms from now
-  unsigned long timeout = millis() + WIFI_TIMEOUT;
+  unsigned long start = millis();
+  waitForWiFi(WIFI_TIMEOUT);
   wl_status_t connection_status = WiFi.status();
-
-  while ((connection_status != WL_CONNECTED) && (millis() < timeout)) {
-    Serial.print(".");
-    delay(50);
-    connection_status = WiFi.status();
-  }
-  Serial.println();
+  Serial.printf("Waited %lu ms for WiFi\n", millis() - start);
 
   if (connection_status == WL_CONNECTED) {
     wifiRSSI = WiFi.RSSI(); // get WiFi signal strength now
@@ -56,72 +50,6 @@ void killWiFi() {
   WiFi.disconnect();
   WiFi.mode(WIFI_OFF);
 }
-/* Returns battery voltage in millivolts (mv).
- */
-uint32_t readBatteryVoltage()
-{
-  esp_adc_cal_characteristics_t adc_chars;
-  // __attribute__((unused)) disables compiler warnings about this variable
-  // being unused (Clang, GCC) which is the case when DEBUG_LEVEL == 0.
-  esp_adc_cal_value_t val_type __attribute__((unused));
-
-  uint16_t adc_val = analogRead(PIN_BAT_ADC);
-
-  // We will use the eFuse ADC calibration bits, to get accurate voltage
-  // readings. The DFRobot FireBeetle Esp32-E V1.0's ADC is 12 bit, and uses
-  // 11db attenuation, which gives it a measurable input voltage range of 150mV
-  // to 2450mV.
-  val_type = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_12,
-                                      ADC_WIDTH_BIT_12, 1100, &adc_chars);
-
-#if DEBUG_LEVEL >= 1
-  if (val_type == ESP_ADC_CAL_VAL_EFUSE_VREF)
-  {
-    Serial.println("[debug] ADC Cal eFuse Vref");
-  }
-  else if (val_type == ESP_ADC_CAL_VAL_EFUSE_TP)
-  {
-    Serial.println("[debug] ADC Cal Two Point");
-  }
-  else
-  {
-    Serial.println("[debug] ADC Cal Default");
-  }
-#endif
-
-  uint32_t batteryVoltage = esp_adc_cal_raw_to_voltage(adc_val, &adc_chars);
-  // DFRobot FireBeetle Esp32-E V1.0 voltage divider (1M+1M), so readings are
-  // multiplied by 2.
-  batteryVoltage *= 2;
-  return batteryVoltage;
-} // end readBatteryVoltage
-
-
-/* Returns battery percentage, rounded to the nearest integer.
- * Takes a voltage in millivolts and uses a sigmoidal approximation to find an
- * approximation of the battery life percentage remaining.
- * 
- * This function contains LGPLv3 code from 
- * <https://github.com/rlogiacco/BatterySense>.
- * 
- * Symmetric sigmoidal approximation
- * <https://www.desmos.com/calculator/7m9lu26vpy>
- *
- * c - c / (1 + k*x/v)^3
- */
-uint32_t calcBatPercent(uint32_t v, uint32_t minv, uint32_t maxv)
-{
-  // slow
-  //uint32_t p = 110 - (110 / (1 + pow(1.468 * (v - minv)/(maxv - minv), 6)));
-
-  // steep
-  //uint32_t p = 102 - (102 / (1 + pow(1.621 * (v - minv)/(maxv - minv), 8.1)));
-
-  // normal
-  uint32_t p = 105 - (105 / (1 + pow(1.724 * (v - minv)/(maxv - minv), 5.5)));
-  return p >= 100 ? 100 : p;
-} // end calcBatPercent
-
 /* This function sets the builtin LED to LOW and disables it even during deep
  * sleep.
  */
@@ -135,13 +63,104 @@ void disableBuiltinLED()
 } // end disableBuiltinLED
 
 
+static constexpr uint16_t refreshTable[7][24] = REFRESH_SCHEDULE;
+static constexpr WeeklySchedule refreshSchedule =
+    makeWeeklySchedule(refreshTable);
+
+static const EnergyModel energyModel = {
+  {ENERGY_BOOT_MA, ENERGY_WIFI_MA, ENERGY_HTTP_MA, ENERGY_PARSE_MA,
+   ENERGY_RENDER_MA, ENERGY_REFRESH_MA},
+  {ENERGY_SAVING_80MHZ_MA, ENERGY_SAVING_160MHZ_MA, 0},
+  ENERGY_SLEEP_UA, BATTERY_CAPACITY, BATTERY_LIFE_TARGET
+};
+RTC_DATA_ATTR static EnergyLedger energy = {};
+static power_phase_t phase = PHASE_BOOT;
+static unsigned long phaseStart = 0;
+
+// The CPU clock of each phase
+static const uint16_t phaseMhz[PHASE_COUNT] = {
+  CPU_MHZ_BOOT, CPU_MHZ_WIFI, CPU_MHZ_HTTP, CPU_MHZ_PARSE, CPU_MHZ_RENDER,
+  CPU_MHZ_REFRESH
+};
+static const char *const phaseNames[PHASE_COUNT] = {
+  "boot", "wifi", "http", "parse", "render", "refresh"
+};
+
+static cpu_clock_t clockOf(uint32_t mhz)
+{
+  return mhz >= 240 ? CLOCK_240MHZ : mhz >= 160 ? CLOCK_160MHZ : CLOCK_80MHZ;
+}
+
+/* Books the time since the last mark, or since reset, to the phase that ran
+ * and the clock it ran at, and starts the next one at its clock: low while
+ * waiting on the network, high to parse and rasterize. Clock changes are
+ * recorded in the wake profile.
+ */
+void markPhase(power_phase_t next)
+{
+  unsigned long now = millis();
+  uint32_t mhz = getCpuFrequencyMhz();
+  energyAddPhase(energy, phase, clockOf(mhz), now - phaseStart);
+  phase = next;
+  phaseStart = now;
+  if (phaseMhz[next] != mhz && setCpuFrequencyMhz(phaseMhz[next]))
+  {
+    energyAddStep(energy, now, next, clockOf(phaseMhz[next]));
+  }
+}
+
+/* Starts the energy ledger again when the battery reads full after a
+ * tenth of its capacity had been used, i.e. after it was charged.
+ */
+void noteBatteryPercent(uint32_t percent)
+{
+  if (percent >= 98
+   && energy.usedUc > BATTERY_CAPACITY * 3600000ULL / 10)
+  {
+    Serial.println("Battery charged, energy ledger restarted");
+    // The time isn't known this early in the wake, the ledger carries on
+    // from the last one that had it
+    energyRestart(energy, 0);
+  }
+}
+
+/* Books this wake into the energy ledger, with the time from timeInfo if it
+ * has one, and returns the percentage the refresh intervals are stretched to.
+ */
+static uint16_t settleEnergy(const tm *timeInfo)
+{
+  markPhase(PHASE_BOOT);
+  for (int i = 0; i < energy.profileSteps; i++)
+  {
+    const ClockStep &step = energy.profile[i];
+    Serial.printf("  %6lu ms %-8s %u MHz\n", (unsigned long)step.atMs,
+                  phaseNames[step.phase], phaseMhz[step.phase]);
+  }
+  uint32_t now = 0;
+  if (timeInfo->tm_year != 0)
+  {
+    tm local = *timeInfo;
+    now = (uint32_t)mktime(&local);
+  }
+  energySettle(energy, energyModel, now);
+  Serial.printf("Energy: %.3f mAh this wake, %.3f mAh saved by the clock, "
+                "%.1f mAh used, intervals at %u%%\n",
+                energy.lastWakeUc / 3.6e6, energy.lastSavedUc / 3.6e6,
+                energy.usedUc / 3.6e6, energy.stretch);
+  return energy.stretch;
+}
+
 /* Put esp32 into ultra low-power deep sleep (<11μA).
- * Aligns wake time to the minute. Sleep times defined in config.cpp.
+ * Sleeps until the next refresh in REFRESH_SCHEDULE, stretched for the
+ * battery life target, or midnight, see planWake(). Sleep times defined in
+ * config.h.
  * timeInfo should already be populated with current time from HA.
  * If timeInfo is empty (error case), falls back to simple fixed sleep.
  */
 void beginDeepSleep(unsigned long startTime, tm *timeInfo)
 {
+  const uint16_t stretch = settleEnergy(timeInfo);
+
   // Check if timeInfo has valid data (year will be 0 if uninitialized)
   if (timeInfo->tm_year == 0) {
     // Error case - no valid time available, use simple fixed sleep
@@ -156,53 +175,17 @@ void beginDeepSleep(unsigned long startTime, tm *timeInfo)
     return; // Never reached, but explicit
   }
 
-  // timeInfo is already populated from Home Assistant time
-  // To simplify sleep time calculations, the current time stored by timeInfo
-  // will be converted to time relative to the WAKE_TIME. This way if a
-  // SLEEP_DURATION is not a multiple of 60 minutes it can be more trivially,
-  // aligned and it can easily be deterimined whether we must sleep for
-  // additional time due to bedtime.
-  // i.e. when curHour == 0, then timeInfo->tm_hour == WAKE_TIME
-  int bedtimeHour = INT_MAX;
-  if (BED_TIME != WAKE_TIME)
-  {
-    bedtimeHour = (BED_TIME - WAKE_TIME + 24) % 24;
-  }
-
-  // time is relative to wake time
-  int curHour = (timeInfo->tm_hour - WAKE_TIME + 24) % 24;
-  const int curMinute = curHour * 60 + timeInfo->tm_min;
-  const int curSecond = curHour * 3600
-                      + timeInfo->tm_min * 60
-                      + timeInfo->tm_sec;
-  const int desiredSleepSeconds = SLEEP_DURATION * 60;
-  const int offsetMinutes = curMinute % SLEEP_DURATION;
-  const int offsetSeconds = curSecond % desiredSleepSeconds;
-
-  // align wake time to nearest multiple of SLEEP_DURATION
-  int sleepMinutes = SLEEP_DURATION - offsetMinutes;
-  if (desiredSleepSeconds - offsetSeconds < 120
-   || offsetSeconds / (float)desiredSleepSeconds > 0.95f)
-  { // if we have a sleep time less than 2 minutes OR less 5% SLEEP_DURATION,
-    // skip to next alignment
-    sleepMinutes += SLEEP_DURATION;
-  }
-
-  // estimated wake time, if this falls in a sleep period then sleepDuration
-  // must be adjusted
-  const int predictedWakeHour = ((curMinute + sleepMinutes) / 60) % 24;
-
-  uint64_t sleepDuration;
-  if (predictedWakeHour < bedtimeHour)
-  {
-    sleepDuration = sleepMinutes * 60 - timeInfo->tm_sec;
-  }
-  else
-  {
-    const int hoursUntilWake = 24 - curHour;
-    sleepDuration = hoursUntilWake * 3600ULL
-                    - (timeInfo->tm_min * 60ULL + timeInfo->tm_sec);
-  }
+  // timeInfo is already populated from Home Assistant time. Sleep until the
+  // display would next show something different.
+  const WakePlan plan = planWake(refreshSchedule,
+                                 timeInfo->tm_wday * SECONDS_PER_DAY
+                                 + timeInfo->tm_hour * 3600
+                                 + timeInfo->tm_min * 60
+                                 + timeInfo->tm_sec,
+                                 stretch);
+  static const char *const reasons[] = {"refresh", "midnight", "resume"};
+  Serial.printf("Next wake: %s\n", reasons[plan.reason]);
+  uint64_t sleepDuration = plan.seconds;
 
   // add extra delay to compensate for esp32's with fast RTCs.
   sleepDuration += 3ULL;
@@ -268,4 +251,43 @@ bool parseHADateTime(const String &date, const String &time, tm *timeInfo)
                 timeInfo->tm_hour, timeInfo->tm_min, timeInfo->tm_sec);
 
   return true;
-} // end parseHADateTime
\ No newline at end of file
+} // end parseHADateTime
+
+/* Parses the Date header of an HTTP response, "Sun, 18 Oct 2026 10:00:00
+ * GMT", into local time in TIME_ZONE.
+ */
+bool parseHttpDate(const String &date, tm *timeInfo)
+{
+  static const char months[] = "JanFebMarAprMayJunJulAugSepOctNovDec";
+  char month[4] = {};
+  int day, year, hour, minute, second;
+  if (sscanf(date.c_str(), "%*3s, %d %3s %d %d:%d:%d GMT", &day, month,
+             &year, &hour, &minute, &second) != 6 || year < 1970)
+  {
+    return false;
+  }
+  const char *found = strstr(months, month);
+  if (!found || (found - months) % 3)
+  {
+    return false;
+  }
+  int mon = (found - months) / 3 + 1;
+
+  // Days since 1970-01-01, counting years from March so that leap days come
+  // last
+  int y = year - (mon <= 2);
+  int era = y / 400;
+  int yearOfEra = y - era * 400;
+  int dayOfYear = (153 * (mon > 2 ? mon - 3 : mon + 9) + 2) / 5 + day - 1;
+  int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+  time_t t = (time_t)(era * 146097L + dayOfEra - 719468) * 86400 +
+             hour * 3600 + minute * 60 + second;
+
+  setenv("TZ", TIME_ZONE, 1);
+  tzset();
+  localtime_r(&t, timeInfo);
+  Serial.printf("Parsed server time: %04d-%02d-%02d %02d:%02d:%02d\n",
+                timeInfo->tm_year + 1900, timeInfo->tm_mon + 1, timeInfo->tm_mday,
+                timeInfo->tm_hour, timeInfo->tm_min, timeInfo->tm_sec);
+  return true;
+} // end parseHttpDate
\ No newline at end of file
@@ -3,21 +3,21 @@
 
 #include <Arduino.h>
 #include <WiFi.h>
+#include "energy.h"
 
 // WiFi functions
 wl_status_t startWiFi(int &wifiRSSI);
 void killWiFi();
 
-// Battery monitoring functions
-uint32_t readBatteryVoltage();
-uint32_t calcBatPercent(uint32_t v, uint32_t minv, uint32_t maxv);
-
 // Power management functions
+void markPhase(power_phase_t next);
+void noteBatteryPercent(uint32_t percent);
 void beginDeepSleep(unsigned long startTime, tm *timeInfo);
 void powerOffDisplay();
 void disableBuiltinLED();
 
 // Time parsing functions
 bool parseHADateTime(const String &date, const String &time, tm *timeInfo);
+bool parseHttpDate(const String &date, tm *timeInfo);
 
 #endif
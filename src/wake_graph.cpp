@@ -0,0 +1,73 @@
+#include "wake_graph.h"
+
+int graphAdd(WakeGraph &graph, const char *name, graph_fn_t run, void *arg,
+             uint16_t after)
+{
+  if (graph.count >= GRAPH_MAX_TASKS || after >> graph.count)
+  {
+    return -1;
+  }
+  GraphTask &task = graph.tasks[graph.count];
+  task.name = name;
+  task.run = run;
+  task.arg = arg;
+  task.after = after;
+  task.state = TASK_WAITING;
+  return graph.count++;
+}
+
+/* Tasks only run after earlier ones, so a task skipped here has already
+ * been finished when a later one that runs after it is looked at.
+ */
+int graphNext(WakeGraph &graph)
+{
+  for (int i = 0; i < graph.count; i++)
+  {
+    GraphTask &task = graph.tasks[i];
+    if (task.state != TASK_WAITING || (task.after & ~graph.finished))
+    {
+      continue;
+    }
+    bool blocked = false;
+    for (int j = 0; j < i; j++)
+    {
+      blocked |= (task.after & GRAPH_BIT(j))
+              && graph.tasks[j].state != TASK_DONE;
+    }
+    if (blocked)
+    {
+      task.state = TASK_SKIPPED;
+      graph.finished |= GRAPH_BIT(i);
+      continue;
+    }
+    task.state = TASK_RUNNING;
+    return i;
+  }
+  return -1;
+} // end graphNext
+
+void graphFinish(WakeGraph &graph, int task, bool ok)
+{
+  graph.tasks[task].state = ok ? TASK_DONE : TASK_FAILED;
+  graph.finished |= GRAPH_BIT(task);
+}
+
+bool graphFinished(const WakeGraph &graph)
+{
+  return graph.finished == (uint16_t)((1u << graph.count) - 1);
+}
+
+bool graphSucceeded(const WakeGraph &graph, int task)
+{
+  return task >= 0 && task < graph.count
+      && graph.tasks[task].state == TASK_DONE;
+}
+
+void graphRun(WakeGraph &graph)
+{
+  int task;
+  while ((task = graphNext(graph)) >= 0)
+  {
+    graphFinish(graph, task, graph.tasks[task].run(graph.tasks[task].arg));
+  }
+}
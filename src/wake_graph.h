@@ -0,0 +1,60 @@
+#ifndef WAKE_GRAPH_H
+#define WAKE_GRAPH_H
+
+#include <stdint.h>
+
+/* The steps of a wake as a dependency graph, so that steps which don't need
+ * each other run at the same time: the panel resets while WiFi associates,
+ * and the layout starts as soon as its data is there. The graph only keeps
+ * the state; graphRun() walks it in order on the host, graphRunTasks() on
+ * the device runs it on several FreeRTOS tasks.
+ */
+
+// Most tasks a graph holds, one bit each in a mask
+#define GRAPH_MAX_TASKS 16
+#define GRAPH_BIT(task) ((uint16_t)(1u << (task)))
+
+typedef enum task_state
+{
+  TASK_WAITING,   // for the tasks it runs after
+  TASK_RUNNING,
+  TASK_DONE,
+  TASK_FAILED,    // returned false
+  TASK_SKIPPED    // a task it runs after didn't succeed
+} task_state_t;
+
+// Returns false on failure, which skips every task that runs after it
+typedef bool (*graph_fn_t)(void *arg);
+
+struct GraphTask {
+  const char *name;
+  graph_fn_t run;
+  void *arg;
+  uint16_t after;   // mask of the tasks that must succeed first
+  uint8_t state;
+};
+
+struct WakeGraph {
+  GraphTask tasks[GRAPH_MAX_TASKS];
+  uint8_t count;
+  uint16_t finished;  // mask of the tasks done, failed or skipped
+};
+
+// Adds a task that runs after the tasks in mask after, which must have been
+// added before it so that the graph has no cycles. Returns its index, or -1
+// if the graph is full or after names a task that doesn't exist.
+int graphAdd(WakeGraph &graph, const char *name, graph_fn_t run, void *arg,
+             uint16_t after = 0);
+// Marks the first task that can run as running and returns it, skipping
+// those that can't anymore; -1 if none can run until a task finishes
+int graphNext(WakeGraph &graph);
+void graphFinish(WakeGraph &graph, int task, bool ok);
+bool graphFinished(const WakeGraph &graph);
+bool graphSucceeded(const WakeGraph &graph, int task);
+// Runs the tasks one after the other in the calling thread
+void graphRun(WakeGraph &graph);
+// Runs the tasks on the calling task and workers - 1 more FreeRTOS tasks
+// until all are finished. Device only, in wake_graph_tasks.cpp.
+void graphRunTasks(WakeGraph &graph, int workers);
+
+#endif // WAKE_GRAPH_H
@@ -0,0 +1,139 @@
+#include "wake_graph.h"
+#include "config.h"
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <freertos/semphr.h>
+
+// The graph shared by the workers, and what they wait on
+struct GraphWorkers {
+  WakeGraph *graph;
+  SemaphoreHandle_t lock;
+  SemaphoreHandle_t exited;
+  TaskHandle_t handles[WAKE_GRAPH_WORKERS];
+  int count;
+};
+
+/* Takes tasks from the graph until all are finished. A worker with nothing
+ * to run blocks on its task notification, which every finished task gives
+ * to all workers; notifications count, so one given while the worker was
+ * still looking isn't lost. They are given under the lock, and a worker
+ * clears its handle under it when it leaves, so none goes to a task that
+ * has been deleted.
+ */
+static void work(GraphWorkers &workers)
+{
+  WakeGraph &graph = *workers.graph;
+  for (;;)
+  {
+    xSemaphoreTake(workers.lock, portMAX_DELAY);
+    int task = graphNext(graph);
+    if (task < 0 && graphFinished(graph))
+    {
+      for (int i = 0; i < workers.count; i++)
+      {
+        if (workers.handles[i] == xTaskGetCurrentTaskHandle())
+        {
+          workers.handles[i] = nullptr;
+        }
+      }
+      xSemaphoreGive(workers.lock);
+      return;
+    }
+    xSemaphoreGive(workers.lock);
+    if (task < 0)
+    {
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      continue;
+    }
+
+    unsigned long start = millis();
+    bool ok = graph.tasks[task].run(graph.tasks[task].arg);
+    Serial.printf("Task %s %s after %lu ms\n", graph.tasks[task].name,
+                  ok ? "done" : "failed", millis() - start);
+
+    xSemaphoreTake(workers.lock, portMAX_DELAY);
+    graphFinish(graph, task, ok);
+    for (int i = 0; i < workers.count; i++)
+    {
+      if (workers.handles[i])
+      {
+        xTaskNotifyGive(workers.handles[i]);
+      }
+    }
+    xSemaphoreGive(workers.lock);
+  }
+} // end work
+
+/* Waits to be deleted by graphRunTasks() once it has worked: a task that
+ * deletes itself leaves its stack to the idle task to free, some time later.
+ */
+static void workerTask(void *arg)
+{
+  GraphWorkers &workers = *(GraphWorkers *)arg;
+  work(workers);
+  xSemaphoreGive(workers.exited);
+  vTaskSuspend(nullptr);
+}
+
+/* The calling task is the first worker. The others wait on the lock until
+ * all handles are known, and are waited for before the shared state on this
+ * stack goes away. They are deleted before this returns, so their stacks are
+ * back on the heap. Without the semaphores the calling task runs the graph
+ * alone.
+ */
+void graphRunTasks(WakeGraph &graph, int workers)
+{
+  GraphWorkers shared = {&graph, xSemaphoreCreateMutex(),
+                         xSemaphoreCreateCounting(WAKE_GRAPH_WORKERS, 0),
+                         {}, 1};
+  if (!shared.lock || !shared.exited)
+  {
+    graphRun(graph);
+  }
+  else
+  {
+    // The handles are cleared as the workers leave, these stay for deleting
+    TaskHandle_t created[WAKE_GRAPH_WORKERS] = {};
+    shared.handles[0] = xTaskGetCurrentTaskHandle();
+    xSemaphoreTake(shared.lock, portMAX_DELAY);
+    for (int i = 1; i < workers && i < WAKE_GRAPH_WORKERS; i++)
+    {
+      if (xTaskCreatePinnedToCore(workerTask, "wakeWorker",
+                                  WAKE_GRAPH_STACK, &shared, 1,
+                                  &shared.handles[shared.count],
+                                  tskNO_AFFINITY) == pdPASS)
+      {
+        created[shared.count] = shared.handles[shared.count];
+        shared.count++;
+      }
+    }
+    xSemaphoreGive(shared.lock);
+    work(shared);
+    // Nothing is given once the graph is finished: drop what the calling
+    // task was given while it ran tasks itself, so that it doesn't wake a
+    // later wait on its notification
+    ulTaskNotifyTake(pdTRUE, 0);
+    for (int i = 1; i < shared.count; i++)
+    {
+      xSemaphoreTake(shared.exited, portMAX_DELAY);
+    }
+    // Deleting a task that isn't running frees its stack right away
+    for (int i = 1; i < shared.count; i++)
+    {
+      while (eTaskGetState(created[i]) != eSuspended)
+      {
+        vTaskDelay(1);
+      }
+      vTaskDelete(created[i]);
+    }
+  }
+  if (shared.lock)
+  {
+    vSemaphoreDelete(shared.lock);
+  }
+  if (shared.exited)
+  {
+    vSemaphoreDelete(shared.exited);
+  }
+} // end graphRunTasks
@@ -0,0 +1,65 @@
+#include "wake_schedule.h"
+
+// A refresh closer than this, or than 5% of the interval, is skipped for
+// the one after it
+#define MIN_REFRESH_SLEEP 120
+// Shortest interval a stretch below 100% can shrink one to
+#define MIN_REFRESH_INTERVAL 300
+
+/* Plans the next wake. Refreshes are aligned to multiples of their interval
+ * counted from the start of the run of hours that share it, so they land on
+ * the same times every week, and a new run starts with a refresh.
+ */
+WakePlan planWake(const WeeklySchedule &schedule, uint32_t secondOfWeek,
+                  uint16_t stretch)
+{
+  const uint32_t now = secondOfWeek % SECONDS_PER_WEEK;
+  const uint32_t hour = now / 3600;
+  const uint32_t runEnd = (hour + schedule.runLeft[hour]) * 3600;
+
+  WakePlan plan;
+  plan.reason = WAKE_REFRESH;
+  uint32_t wake = runEnd;
+  if (schedule.minutes[hour])
+  {
+    const uint32_t scheduled = schedule.minutes[hour] * 60u;
+    uint32_t interval = scheduled * stretch / 100;
+    if (interval < scheduled && interval < MIN_REFRESH_INTERVAL)
+    {
+      interval = scheduled < MIN_REFRESH_INTERVAL ? scheduled
+                                                  : MIN_REFRESH_INTERVAL;
+    }
+    const uint32_t sinceStart = now - (hour - schedule.runStart[hour]) * 3600;
+    uint32_t refresh = now + interval - sinceStart % interval;
+    if (refresh - now < MIN_REFRESH_SLEEP || refresh - now < interval / 20)
+    {
+      refresh += interval;
+    }
+    if (refresh < runEnd)
+    {
+      wake = refresh;
+    }
+  }
+  else
+  {
+    plan.reason = WAKE_RESUME;
+  }
+
+  // Sleeps through hours without refreshes; they only follow each other
+  // across the end of the week, and twice for a schedule without any
+  for (int i = 0; i < 2 && !schedule.minutes[wake / 3600 % HOURS_PER_WEEK]; i++)
+  {
+    wake += schedule.runLeft[wake / 3600 % HOURS_PER_WEEK] * 3600;
+    plan.reason = WAKE_RESUME;
+  }
+
+  const uint32_t midnight = (now / SECONDS_PER_DAY + 1) * SECONDS_PER_DAY;
+  if (midnight <= wake
+   && schedule.minutes[midnight / 3600 % HOURS_PER_WEEK])
+  {
+    wake = midnight;
+    plan.reason = WAKE_ROLLOVER;
+  }
+  plan.seconds = wake - now;
+  return plan;
+} // end planWake
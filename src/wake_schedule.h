@@ -0,0 +1,61 @@
+#ifndef WAKE_SCHEDULE_H
+#define WAKE_SCHEDULE_H
+
+#include <stdint.h>
+
+#define SECONDS_PER_DAY 86400
+#define HOURS_PER_WEEK (7 * 24)
+#define SECONDS_PER_WEEK (7 * SECONDS_PER_DAY)
+
+// Why the device wakes next
+typedef enum wake_reason
+{
+  WAKE_REFRESH,   // the next refresh of the schedule
+  WAKE_ROLLOVER,  // midnight moves the day highlight
+  WAKE_RESUME     // the end of hours without refreshes
+} wake_reason_t;
+
+// Minutes between refreshes for every hour of the week, 0 for none, with
+// the runs of equal hours around each hour so that planWake() doesn't have
+// to search. Build it with makeWeeklySchedule().
+struct WeeklySchedule {
+  uint16_t minutes[HOURS_PER_WEEK];  // Sunday 00:00 first, as tm_wday
+  uint8_t runStart[HOURS_PER_WEEK];  // hours since its run began
+  uint8_t runLeft[HOURS_PER_WEEK];   // hours from this one to its run end
+};
+
+struct WakePlan {
+  uint32_t seconds;  // from now
+  wake_reason_t reason;
+};
+
+/* Builds the schedule from a table of minutes per weekday and hour, at
+ * compile time for a constexpr table. Runs end at the end of the week.
+ */
+constexpr WeeklySchedule makeWeeklySchedule(const uint16_t (&minutes)[7][24])
+{
+  WeeklySchedule schedule{};
+  for (int h = 0; h < HOURS_PER_WEEK; h++)
+  {
+    schedule.minutes[h] = minutes[h / 24][h % 24];
+    schedule.runStart[h] = h && schedule.minutes[h] == schedule.minutes[h - 1]
+                         ? schedule.runStart[h - 1] + 1 : 0;
+  }
+  for (int h = HOURS_PER_WEEK - 1; h >= 0; h--)
+  {
+    schedule.runLeft[h] = h + 1 < HOURS_PER_WEEK
+                       && schedule.minutes[h] == schedule.minutes[h + 1]
+                        ? schedule.runLeft[h + 1] + 1 : 1;
+  }
+  return schedule;
+}
+
+// Plans the sleep from secondOfWeek (local time, Sunday 00:00 is 0) until
+// the next instant the display would change: the next refresh in the
+// schedule or midnight, whichever is first. Midnight only counts in an hour
+// with refreshes. The intervals are stretched to stretch percent, for the
+// energy budget. O(1).
+WakePlan planWake(const WeeklySchedule &schedule, uint32_t secondOfWeek,
+                  uint16_t stretch = 100);
+
+#endif // WAKE_SCHEDULE_H
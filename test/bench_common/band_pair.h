@@ -0,0 +1,26 @@
+#ifndef BENCH_BAND_PAIR_H
+#define BENCH_BAND_PAIR_H
+
+/* A band drawn by a fast path and the same band drawn pixel by pixel, for
+ * the tests that compare the two. The test allocates both in main().
+ */
+
+#include <unity.h>
+#include "band_buffer.h"
+
+static BandBuffer fast;
+static BandBuffer pixels;
+
+static void startBands(int16_t top, int16_t rows) {
+    fast.setBand(top, rows);
+    pixels.setBand(top, rows);
+}
+
+static void assertSameBands() {
+    for (int16_t row = 0; row < fast.rows(); row++) {
+        TEST_ASSERT_EQUAL_MEMORY(pixels.blackRow(row), fast.blackRow(row), 100);
+        TEST_ASSERT_EQUAL_MEMORY(pixels.redRow(row), fast.redRow(row), 100);
+    }
+}
+
+#endif // BENCH_BAND_PAIR_H
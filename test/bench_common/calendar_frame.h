@@ -0,0 +1,134 @@
+#ifndef BENCH_CALENDAR_FRAME_H
+#define BENCH_CALENDAR_FRAME_H
+
+/* Paints frames that look like the two week calendar view into a BandBuffer,
+ * for the native benchmarks. Only the hardware independent modules are
+ * available natively, so the shapes are drawn with BandBuffer spans and the
+ * text with the real fonts and wrapping; sizes follow config.h.template.
+ *
+ * Every call paints the whole frame clipped to the current band, so frames
+ * can be painted band by band.
+ */
+
+#include <chrono>
+#include <math.h>
+#include <string.h>
+#include "band_buffer.h"
+#include "calendar_geometry.h"
+#include "text_layout.h"
+
+typedef CalendarGeometry<2, 800, 480, 20> BenchView;
+
+static const char *const benchTitles[] = {
+    "House cleaning service", "School parent meeting", "Swimming lesson",
+    "Book parent teacher meeting", "Child flu vaccine at school",
+    "Reception Parents Reading and Phonics Meeting", "Coffee Meeting",
+    "Wear Red Day 2025: Charity Event", "School Disco; Years 4, 5, 6",
+    "Harvest Festival Competition", "Dentist", "Grocery run"};
+
+static inline uint32_t benchRandom(uint32_t &state) {
+    state = state * 1664525u + 1013904223u;
+    return state >> 16;
+}
+
+static inline void benchText(BandBuffer &band, int16_t x, int16_t y,
+                             const char *text, uint16_t length, font_t font,
+                             ink_t ink) {
+    const SparseFont &f = getFont(font);
+    forEachTextGlyph(f, text, length, [&](const GFXglyph &g, int16_t pen) {
+        uint32_t bit = g.bitmapOffset * 8u;
+        for (int16_t gy = 0; gy < g.height; gy++) {
+            for (int16_t gx = 0; gx < g.width; gx++, bit++) {
+                if (f.bitmap[bit >> 3] & (0x80 >> (bit & 7))) {
+                    band.setPixel(x + pen + g.xOffset + gx, y + g.yOffset + gy, ink);
+                }
+            }
+        }
+    });
+}
+
+static inline void benchRoundRect(BandBuffer &band, int16_t x, int16_t y,
+                                  int16_t w, int16_t h, int16_t r, ink_t ink) {
+    for (int16_t row = 0; row < h; row++) {
+        int16_t dy = row < r ? r - row : row >= h - r ? row - (h - r - 1) : 0;
+        int16_t inset = dy ? r - (int16_t)sqrtf((float)(r * r - dy * dy)) : 0;
+        band.fillSpan(x + inset, y + row, w - 2 * inset, ink);
+    }
+}
+
+static inline void benchWrapped(BandBuffer &band, int16_t x, int16_t y,
+                                const char *title, int16_t width,
+                                uint16_t maxLines, ink_t ink) {
+    TextLine lines[2];
+    uint16_t count = wrapText(title, FONT_LARGE, width, maxLines, lines);
+    for (uint16_t i = 0; i < count; i++) {
+        benchText(band, x, y + i * 17, title + lines[i].start, lines[i].length,
+                  FONT_LARGE, ink);
+        if (lines[i].ellipsis) {
+            int16_t w = getTextWidth(title + lines[i].start, lines[i].length, FONT_LARGE);
+            benchText(band, x + w, y + i * 17, TEXT_ELLIPSIS, 3, FONT_LARGE, ink);
+        }
+    }
+}
+
+/* Paints a calendar frame. busyness is the most single day events per day,
+ * seed picks titles and counts.
+ */
+static inline void paintCalendarFrame(BandBuffer &band, uint32_t seed,
+                                      int busyness, int today = 3,
+                                      const char *status =
+                                          "22:14   Good (-63dBm)   87% (4.03v)") {
+    static const char *const weekdays[] = {"MONDAY", "TUESDAY", "WEDNESDAY",
+                                           "THURSDAY", "FRIDAY", "SATURDAY",
+                                           "SUNDAY"};
+    uint32_t rnd = seed;
+    for (int c = 0; c < BenchView::columns; c++) {
+        int16_t w = getTextWidth(weekdays[c], FONT_LARGE);
+        benchText(band, BenchView::cellX(c) + (BenchView::dayWidth - w) / 2, 15,
+                  weekdays[c], strlen(weekdays[c]), FONT_LARGE,
+                  c == today - 1 ? INK_RED : INK_BLACK);
+    }
+    band.fillSpan(0, BenchView::headerHeight, BenchView::width, INK_BLACK);
+    band.fillSpan(0, BenchView::cellY(1), BenchView::width, INK_BLACK);
+
+    // One multi-day event across the middle of the first week
+    benchRoundRect(band, BenchView::cellX(1) + 3, BenchView::cellY(0) + 25,
+                   3 * BenchView::dayWidth - 6, 28, 3, INK_BLACK);
+    benchWrapped(band, BenchView::cellX(1) + 6, BenchView::cellY(0) + 44,
+                 benchTitles[benchRandom(rnd) % 12], 3 * BenchView::dayWidth - 12,
+                 1, INK_WHITE);
+
+    for (int day = 1; day <= BenchView::days; day++) {
+        int16_t x = BenchView::cellX(BenchView::column(day));
+        int16_t y = BenchView::cellY(BenchView::week(day));
+        char number[4];
+        snprintf(number, sizeof(number), "%d", 10 + day);
+        ink_t numberInk = INK_BLACK;
+        if (day == today) {
+            benchRoundRect(band, x + 3, y + 5, 25, 18, 3, INK_RED);
+            numberInk = INK_WHITE;
+        }
+        benchText(band, x + 5, y + 20, number, strlen(number), FONT_LARGE, numberInk);
+
+        int multiDay = BenchView::week(day) == 0 && day >= 2 && day <= 4;
+        int16_t eventY = y + 25 + multiDay * 30;
+        int events = busyness ? benchRandom(rnd) % (busyness + 1) : 0;
+        for (int e = 0; e < events && eventY + 48 <= y + BenchView::rowHeight; e++) {
+            ink_t ink = day == today ? INK_RED : INK_BLACK;
+            benchRoundRect(band, x + 3, eventY, BenchView::dayWidth - 6, 48, 3, ink);
+            benchText(band, x + 6, eventY + 11, "09:00-10:30", 11, FONT_SMALL, INK_WHITE);
+            benchWrapped(band, x + 6, eventY + 27, benchTitles[benchRandom(rnd) % 12],
+                         BenchView::dayWidth - 12, 2, INK_WHITE);
+            eventY += 50;
+        }
+    }
+
+    // Status bar
+    benchText(band, 520, 477, status, strlen(status), FONT_SMALL, INK_BLACK);
+}
+
+static inline double benchSeconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#endif // BENCH_CALENDAR_FRAME_H
@@ -0,0 +1,90 @@
+#ifndef BENCH_GFX_REFERENCE_H
+#define BENCH_GFX_REFERENCE_H
+
+/* The filled shape algorithms of Adafruit_GFX, drawing pixel by pixel
+ * through a virtual drawPixel() with the rotation and bounds checks GxEPD2
+ * does, into a BandBuffer. Adafruit_GFX itself isn't available natively;
+ * this is the reference the span rasterizer is compared and benchmarked
+ * against.
+ */
+
+#include "band_buffer.h"
+
+class GfxReference {
+public:
+    explicit GfxReference(BandBuffer &band) : band(band) {}
+    virtual ~GfxReference() {}
+
+    virtual void drawPixel(int16_t x, int16_t y, ink_t ink) {
+        // GxEPD2_3C::drawPixel: bounds, rotation and page checks
+        if (x < 0 || x >= 800 || y < 0 || y >= 480) return;
+        switch (rotation) {
+        case 1: { int16_t t = x; x = 800 - 1 - y; y = t; break; }
+        case 2: x = 800 - 1 - x; y = 480 - 1 - y; break;
+        case 3: { int16_t t = x; x = y; y = 480 - 1 - t; break; }
+        }
+        if (y < band.top() || y >= band.top() + band.rows()) return;
+        band.setPixel(x, y, ink);
+    }
+
+    void writeFastVLine(int16_t x, int16_t y, int16_t h, ink_t ink) {
+        for (int16_t i = 0; i < h; i++) drawPixel(x, y + i, ink);
+    }
+
+    void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, ink_t ink) {
+        for (int16_t i = x; i < x + w; i++) writeFastVLine(i, y, h, ink);
+    }
+
+    void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t corners,
+                          int16_t delta, ink_t ink) {
+        int16_t f = 1 - r;
+        int16_t ddF_x = 1;
+        int16_t ddF_y = -2 * r;
+        int16_t x = 0;
+        int16_t y = r;
+        int16_t px = x;
+        int16_t py = y;
+        delta++;
+        while (x < y) {
+            if (f >= 0) {
+                y--;
+                ddF_y += 2;
+                f += ddF_y;
+            }
+            x++;
+            ddF_x += 2;
+            f += ddF_x;
+            if (x < (y + 1)) {
+                if (corners & 1) writeFastVLine(x0 + x, y0 - y, 2 * y + delta, ink);
+                if (corners & 2) writeFastVLine(x0 - x, y0 - y, 2 * y + delta, ink);
+            }
+            if (y != py) {
+                if (corners & 1) writeFastVLine(x0 + py, y0 - px, 2 * px + delta, ink);
+                if (corners & 2) writeFastVLine(x0 - py, y0 - px, 2 * px + delta, ink);
+                py = y;
+            }
+            px = x;
+        }
+    }
+
+    void fillCircle(int16_t x0, int16_t y0, int16_t r, ink_t ink) {
+        writeFastVLine(x0, y0 - r, 2 * r + 1, ink);
+        fillCircleHelper(x0, y0, r, 3, 0, ink);
+    }
+
+    void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r,
+                       ink_t ink) {
+        int16_t max_radius = ((w < h) ? w : h) / 2;
+        if (r > max_radius) r = max_radius;
+        fillRect(x + r, y, w - 2 * r, h, ink);
+        fillCircleHelper(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, ink);
+        fillCircleHelper(x + r, y + r, r, 2, h - 2 * r - 1, ink);
+    }
+
+    uint8_t rotation = 0;
+
+private:
+    BandBuffer &band;
+};
+
+#endif // BENCH_GFX_REFERENCE_H
@@ -0,0 +1,196 @@
+#include <unity.h>
+#include "band_buffer.h"
+
+static bool isSet(const uint8_t *plane, int16_t width, int16_t x, int16_t y) {
+    return plane[y * (width / 8) + x / 8] & (0x80 >> (x & 7));
+}
+
+void test_full_frame_fits_in_one_page() {
+    PagePlan plan = planPages(800, 480, 100000, 4);
+    TEST_ASSERT_EQUAL_UINT8(1, plan.pages);
+    TEST_ASSERT_EQUAL_INT16(480, plan.bandHeight);
+    TEST_ASSERT_EQUAL_size_t(96000, plan.bytes);
+}
+
+void test_pages_double_until_band_fits() {
+    TEST_ASSERT_EQUAL_UINT8(2, planPages(800, 480, 95999, 4).pages);
+    TEST_ASSERT_EQUAL_UINT8(2, planPages(800, 480, 48000, 4).pages);
+    PagePlan plan = planPages(800, 480, 30000, 4);
+    TEST_ASSERT_EQUAL_UINT8(4, plan.pages);
+    TEST_ASSERT_EQUAL_INT16(120, plan.bandHeight);
+    TEST_ASSERT_EQUAL_size_t(24000, plan.bytes);
+}
+
+void test_no_plan_when_nothing_fits() {
+    PagePlan plan = planPages(800, 480, 23999, 4);
+    TEST_ASSERT_EQUAL_UINT8(0, plan.pages);
+    TEST_ASSERT_EQUAL_UINT8(8, planPages(800, 480, 23999, 8).pages);
+}
+
+void test_page_limit_above_128_ends() {
+    // pages doubles to 256, which doesn't fit a uint8_t
+    TEST_ASSERT_EQUAL_UINT8(0, planPages(800, 480, 0, 255).pages);
+    TEST_ASSERT_EQUAL_UINT8(128, planPages(800, 480, 800 / 8 * 2 * 4, 255).pages);
+}
+
+void test_uneven_height_rounds_band_up() {
+    PagePlan plan = planPages(800, 300, 800 / 8 * 2 * 150, 4);
+    TEST_ASSERT_EQUAL_UINT8(2, plan.pages);
+    TEST_ASSERT_EQUAL_INT16(150, plan.bandHeight);
+    TEST_ASSERT_EQUAL_UINT8(4, planPages(800, 299, 800 / 8 * 2 * 75, 4).pages);
+}
+
+void test_band_starts_white() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(64, 10));
+    band.setBand(0, 10);
+    for (int i = 0; i < 8 * 10; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0xFF, band.black()[i]);
+        TEST_ASSERT_EQUAL_HEX8(0xFF, band.red()[i]);
+    }
+}
+
+void test_pixels_use_gxepd2_planes() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(64, 10));
+    band.setBand(0, 10);
+    band.setPixel(0, 0, INK_BLACK);
+    band.setPixel(9, 1, INK_RED);
+    TEST_ASSERT_EQUAL_HEX8(0x7F, band.black()[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, band.red()[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, band.black()[8 + 1]);
+    TEST_ASSERT_EQUAL_HEX8(0xBF, band.red()[8 + 1]);
+}
+
+void test_red_clears_black_and_white_clears_both() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(16, 2));
+    band.setBand(0, 2);
+    band.setPixel(3, 0, INK_BLACK);
+    band.setPixel(3, 0, INK_RED);
+    TEST_ASSERT_TRUE(isSet(band.black(), 16, 3, 0));
+    TEST_ASSERT_FALSE(isSet(band.red(), 16, 3, 0));
+    band.setPixel(3, 0, INK_WHITE);
+    TEST_ASSERT_TRUE(isSet(band.black(), 16, 3, 0));
+    TEST_ASSERT_TRUE(isSet(band.red(), 16, 3, 0));
+}
+
+void test_frame_coordinates_are_clipped_to_band() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(16, 4));
+    band.setBand(8, 4);
+    band.setPixel(0, 7, INK_BLACK);
+    band.setPixel(0, 12, INK_BLACK);
+    band.setPixel(-1, 8, INK_BLACK);
+    band.setPixel(16, 8, INK_BLACK);
+    for (int i = 0; i < 2 * 4; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0xFF, band.black()[i]);
+    }
+    band.setPixel(15, 11, INK_BLACK);
+    TEST_ASSERT_FALSE(isSet(band.black(), 16, 15, 3));
+}
+
+void test_short_last_band() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(16, 4));
+    band.setBand(8, 2);
+    TEST_ASSERT_EQUAL_INT16(2, band.rows());
+    // The red plane of a short band still starts after a full plane
+    TEST_ASSERT_EQUAL_PTR(band.black() + 2 * 4, band.red());
+    band.setPixel(0, 10, INK_BLACK);
+    TEST_ASSERT_TRUE(isSet(band.black(), 16, 0, 1));
+}
+
+void test_fill_span_matches_pixels() {
+    BandBuffer spans;
+    BandBuffer pixels;
+    TEST_ASSERT_TRUE(spans.allocate(32, 1));
+    TEST_ASSERT_TRUE(pixels.allocate(32, 1));
+    const ink_t inks[] = {INK_BLACK, INK_RED, INK_WHITE};
+    for (int16_t x = -3; x < 33; x++) {
+        for (int16_t w = 0; w < 36; w++) {
+            for (ink_t ink : inks) {
+                spans.setBand(0, 1);
+                pixels.setBand(0, 1);
+                // Start from a mixed background so white spans show
+                for (int16_t i = 0; i < 32; i += 3) {
+                    spans.setPixel(i, 0, INK_RED);
+                    pixels.setPixel(i, 0, INK_RED);
+                    spans.setPixel(i + 1, 0, INK_BLACK);
+                    pixels.setPixel(i + 1, 0, INK_BLACK);
+                }
+                spans.fillSpan(x, 0, w, ink);
+                for (int16_t i = x; i < x + w; i++) {
+                    pixels.setPixel(i, 0, ink);
+                }
+                TEST_ASSERT_EQUAL_MEMORY(pixels.black(), spans.black(), 4);
+                TEST_ASSERT_EQUAL_MEMORY(pixels.red(), spans.red(), 4);
+            }
+        }
+    }
+}
+
+void test_fill_span_outside_band_is_ignored() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(16, 2));
+    band.setBand(4, 2);
+    band.fillSpan(0, 3, 16, INK_BLACK);
+    band.fillSpan(0, 6, 16, INK_BLACK);
+    for (int i = 0; i < 2 * 2; i++) {
+        TEST_ASSERT_EQUAL_HEX8(0xFF, band.black()[i]);
+    }
+}
+
+void test_red_blank() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(16, 4));
+    band.setBand(0, 4);
+    TEST_ASSERT_TRUE(band.redBlank());
+    band.fillSpan(0, 1, 16, INK_BLACK);
+    TEST_ASSERT_TRUE(band.redBlank());
+    band.setPixel(15, 3, INK_RED);
+    TEST_ASSERT_FALSE(band.redBlank());
+    band.setPixel(15, 3, INK_WHITE);
+    TEST_ASSERT_TRUE(band.redBlank());
+    // Only the rows of a shorter last band count
+    band.fill(INK_RED);
+    band.setBand(4, 2);
+    TEST_ASSERT_TRUE(band.redBlank());
+}
+
+void test_single_plane_draws_red_black() {
+    TEST_ASSERT_EQUAL_size_t(48000, planPages(800, 480, 48000, 1, 1).bytes);
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(16, 4, 1));
+    band.setBand(0, 4);
+    TEST_ASSERT_EQUAL_UINT8(1, band.planeCount());
+    TEST_ASSERT_NULL(band.red());
+    TEST_ASSERT_NULL(band.redRow(1));
+    band.setPixel(3, 0, INK_RED);
+    TEST_ASSERT_FALSE(isSet(band.black(), 16, 3, 0));
+    band.fillSpan(2, 1, 12, INK_RED);
+    TEST_ASSERT_EQUAL_HEX8(0xC0, band.blackRow(1)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x03, band.blackRow(1)[1]);
+    band.fill(INK_RED);
+    TEST_ASSERT_EQUAL_HEX8(0x00, band.blackRow(3)[1]);
+    TEST_ASSERT_TRUE(band.redBlank());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_full_frame_fits_in_one_page);
+    RUN_TEST(test_pages_double_until_band_fits);
+    RUN_TEST(test_no_plan_when_nothing_fits);
+    RUN_TEST(test_page_limit_above_128_ends);
+    RUN_TEST(test_uneven_height_rounds_band_up);
+    RUN_TEST(test_band_starts_white);
+    RUN_TEST(test_pixels_use_gxepd2_planes);
+    RUN_TEST(test_red_clears_black_and_white_clears_both);
+    RUN_TEST(test_frame_coordinates_are_clipped_to_band);
+    RUN_TEST(test_short_last_band);
+    RUN_TEST(test_fill_span_matches_pixels);
+    RUN_TEST(test_fill_span_outside_band_is_ignored);
+    RUN_TEST(test_red_blank);
+    RUN_TEST(test_single_plane_draws_red_black);
+    return UNITY_END();
+}
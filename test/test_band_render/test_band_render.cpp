@@ -0,0 +1,52 @@
+#include <unity.h>
+#include "band_render.h"
+#include "panel_color.h"
+
+static BandBuffer band;
+
+void test_colors_map_to_inks() {
+    TEST_ASSERT_EQUAL_INT(INK_WHITE, inkOf(GxEPD_WHITE));
+    TEST_ASSERT_EQUAL_INT(INK_BLACK, inkOf(GxEPD_BLACK));
+    TEST_ASSERT_EQUAL_INT(INK_RED, inkOf(GxEPD_RED));
+    // Like GxEPD2_3C, anything else is black
+    TEST_ASSERT_EQUAL_INT(INK_BLACK, inkOf(0x7BEF));
+}
+
+void test_only_the_rows_of_the_band_are_drawn() {
+    DisplayList dl;
+    dl.fillRect(0, 10, 16, 20, GxEPD_RED);
+    dl.fillRect(0, 40, 800, 4, GxEPD_BLACK);
+    band.setBand(16, 8);
+    TEST_ASSERT_EQUAL_INT(0, renderBand(band, dl));
+    for (int16_t row = 0; row < band.rows(); row++) {
+        TEST_ASSERT_EQUAL_HEX8(0x00, band.redRow(row)[0]);
+        TEST_ASSERT_EQUAL_HEX8(0x00, band.redRow(row)[1]);
+        TEST_ASSERT_EQUAL_HEX8(0xFF, band.redRow(row)[2]);
+        TEST_ASSERT_EQUAL_HEX8(0xFF, band.blackRow(row)[0]);
+    }
+    band.setBand(40, 8);
+    TEST_ASSERT_EQUAL_INT(0, renderBand(band, dl));
+    TEST_ASSERT_EQUAL_HEX8(0x00, band.blackRow(3)[99]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, band.blackRow(4)[99]);
+}
+
+void test_commands_without_spans_are_counted() {
+    DisplayList dl;
+    dl.line(0, 0, 20, 20, GxEPD_BLACK);
+    dl.fillCircle(50, 10, SPAN_MAX_RADIUS + 1, GxEPD_BLACK);
+    dl.fillCircle(100, 10, SPAN_MAX_RADIUS, GxEPD_BLACK);
+    band.setBand(0, 30);
+    TEST_ASSERT_EQUAL_INT(2, renderBand(band, dl));
+    // Nothing of theirs is in a band below them
+    band.setBand(40, 8);
+    TEST_ASSERT_EQUAL_INT(0, renderBand(band, dl));
+}
+
+int main(int argc, char **argv) {
+    band.allocate(800, 30);
+    UNITY_BEGIN();
+    RUN_TEST(test_colors_map_to_inks);
+    RUN_TEST(test_only_the_rows_of_the_band_are_drawn);
+    RUN_TEST(test_commands_without_spans_are_counted);
+    return UNITY_END();
+}
@@ -1,38 +1,38 @@
 #include <unity.h>
-
-// Mock Arduino.h for native tests
-#ifndef UNIT_TEST
-#include <Arduino.h>
-#else
-#include <stdint.h>
 #include <math.h>
-#endif
-
-// Copy the function here to test it without hardware dependencies
-uint32_t calcBatPercent(uint32_t v, uint32_t minv, uint32_t maxv)
-{
-  // normal
-  uint32_t p = 105 - (105 / (1 + pow(1.724 * (v - minv)/(maxv - minv), 5.5)));
-  return p >= 100 ? 100 : p;
+#include "battery_soc.h"
+
+// The default profile from config.h.template
+typedef LipoProfile<3000, 4200> Lipo;
+
+// Percentage through the LiPo table, as drawStatusBar() gets it
+static uint32_t calcBatPercent(uint32_t v) {
+    return Lipo::lut.lookup(v);
+}
+
+// The sigmoid the table is built from, as it was evaluated on every wake
+static uint32_t sigmoidPercent(uint32_t v, uint32_t minv, uint32_t maxv) {
+    uint32_t p = 105 - (105 / (1 + pow(1.724 * (v - minv)/(maxv - minv), 5.5)));
+    return p >= 100 ? 100 : p;
 }
 
 void test_battery_percent_at_max_voltage() {
     // Battery at maximum voltage should return close to 100%
     // The sigmoidal approximation returns 99-100 at max voltage
-    uint32_t result = calcBatPercent(4200, 3000, 4200);
+    uint32_t result = calcBatPercent(4200);
     TEST_ASSERT_GREATER_OR_EQUAL_UINT32(99, result);
     TEST_ASSERT_LESS_OR_EQUAL_UINT32(100, result);
 }
 
 void test_battery_percent_at_min_voltage() {
     // Battery at minimum voltage should return 0%
-    uint32_t result = calcBatPercent(3000, 3000, 4200);
+    uint32_t result = calcBatPercent(3000);
     TEST_ASSERT_EQUAL_UINT32(0, result);
 }
 
 void test_battery_percent_at_mid_voltage() {
     // Battery at mid voltage should return reasonable percentage
-    uint32_t result = calcBatPercent(3600, 3000, 4200);
+    uint32_t result = calcBatPercent(3600);
     // Should be somewhere between 20-60% based on the sigmoidal curve
     TEST_ASSERT_GREATER_THAN_UINT32(20, result);
     TEST_ASSERT_LESS_THAN_UINT32(60, result);
@@ -40,20 +40,20 @@ void test_battery_percent_at_mid_voltage() {
 
 void test_battery_percent_near_max() {
     // Battery near maximum should be high percentage
-    uint32_t result = calcBatPercent(4100, 3000, 4200);
+    uint32_t result = calcBatPercent(4100);
     TEST_ASSERT_GREATER_THAN_UINT32(80, result);
     TEST_ASSERT_LESS_OR_EQUAL_UINT32(100, result);
 }
 
 void test_battery_percent_near_min() {
     // Battery near minimum should be low percentage
-    uint32_t result = calcBatPercent(3100, 3000, 4200);
+    uint32_t result = calcBatPercent(3100);
     TEST_ASSERT_LESS_THAN_UINT32(20, result);
 }
 
 void test_battery_percent_clamped_at_100() {
     // Even if voltage exceeds max, percentage should be clamped at 100
-    uint32_t result = calcBatPercent(4300, 3000, 4200);
+    uint32_t result = calcBatPercent(4300);
     TEST_ASSERT_EQUAL_UINT32(100, result);
 }
 
@@ -62,11 +62,55 @@ void test_battery_percent_typical_voltages() {
     // 4.2V = 100%, 3.7V = ~50%, 3.0V = 0%
 
     // At 3700mV (nominal voltage), expect around 40-60%
-    uint32_t result = calcBatPercent(3700, 3000, 4200);
+    uint32_t result = calcBatPercent(3700);
     TEST_ASSERT_GREATER_THAN_UINT32(30, result);
     TEST_ASSERT_LESS_THAN_UINT32(70, result);
 }
 
+void test_table_follows_the_sigmoid() {
+    for (uint32_t v = 3000; v <= 4400; v++) {
+        int expected = sigmoidPercent(v, 3000, 4200);
+        int actual = calcBatPercent(v);
+        TEST_ASSERT_INT_WITHIN(1, expected, actual);
+    }
+    // Below the minimum it used to wrap around to 100%
+    TEST_ASSERT_EQUAL_UINT32(0, calcBatPercent(2900));
+}
+
+void test_lifepo4_profile() {
+    static_assert(LiFePO4Profile::lut.minMv == 2500, "first knot");
+    const SocLut &lut = LiFePO4Profile::lut;
+    TEST_ASSERT_EQUAL_UINT32(0, lut.lookup(2400));
+    TEST_ASSERT_EQUAL_UINT32(10, lut.lookup(3000));
+    TEST_ASSERT_EQUAL_UINT32(50, lut.lookup(3260));
+    TEST_ASSERT_EQUAL_UINT32(100, lut.lookup(3400));
+    TEST_ASSERT_EQUAL_UINT32(100, lut.lookup(3600));
+    uint32_t last = 0;
+    for (uint32_t v = 2500; v <= 3450; v++) {
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(last, lut.lookup(v));
+        last = lut.lookup(v);
+    }
+}
+
+void test_median_ignores_outliers() {
+    uint16_t samples[] = {1850, 1852, 40, 1849, 4095, 1851, 1850};
+    TEST_ASSERT_EQUAL_UINT16(1850, medianOf(samples, 7));
+    uint16_t even[] = {7, 3, 5, 1};
+    TEST_ASSERT_EQUAL_UINT16(3, medianOf(even, 4));
+    uint16_t one[] = {9};
+    TEST_ASSERT_EQUAL_UINT16(9, medianOf(one, 1));
+}
+
+void test_sag_compensation() {
+    // 3700 mV idle at 45 mA, 3683 mV at 130 mA: 200 milliohms
+    TEST_ASSERT_EQUAL_UINT32(200, sagResistance(3700, 45, 3683, 130));
+    TEST_ASSERT_EQUAL_UINT32(3709, openCircuitMv(3700, 45, 200));
+    // A higher reading under load, or one that sagged by volts, is noise
+    TEST_ASSERT_EQUAL_UINT32(0, sagResistance(3700, 45, 3710, 130));
+    TEST_ASSERT_EQUAL_UINT32(0, sagResistance(3700, 45, 3300, 130));
+    TEST_ASSERT_EQUAL_UINT32(0, sagResistance(3700, 130, 3600, 45));
+}
+
 int main(int argc, char **argv) {
     UNITY_BEGIN();
 
@@ -77,6 +121,10 @@ int main(int argc, char **argv) {
     RUN_TEST(test_battery_percent_near_min);
     RUN_TEST(test_battery_percent_clamped_at_100);
     RUN_TEST(test_battery_percent_typical_voltages);
+    RUN_TEST(test_table_follows_the_sigmoid);
+    RUN_TEST(test_lifepo4_profile);
+    RUN_TEST(test_median_ignores_outliers);
+    RUN_TEST(test_sag_compensation);
 
     return UNITY_END();
 }
@@ -0,0 +1,141 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "compressed_frame.h"
+#include "../bench_common/calendar_frame.h"
+
+// A week of wakes every 30 minutes
+static const int days = 7;
+static const int wakesPerDay = 48;
+
+// One wake of the week: the clock and battery in the status bar move every
+// wake, the today mark every day, and now and then an event is added
+struct Wake {
+    int today;
+    int added;      // events added this week so far
+    char status[40];
+};
+
+static Wake wakeAt(int i) {
+    Wake w;
+    w.today = 1 + i / wakesPerDay;
+    w.added = i / 20;
+    int minutes = (i % wakesPerDay) * 30;
+    int percent = 95 - i / 8;
+    snprintf(w.status, sizeof(w.status), "%02d:%02d   Good (-6%ddBm)   %d%% (%.2fv)",
+             minutes / 60, minutes % 60, i % 7, percent, 3.3 + percent * 0.009);
+    return w;
+}
+
+static void renderWake(CompressedFrame &frame, BandBuffer &band, const Wake &w) {
+    frame.begin(800, 480);
+    for (int16_t top = 0; top < 480; top += 60) {
+        band.setBand(top, 60);
+        paintCalendarFrame(band, 42, 2, w.today, w.status);
+        // Added events go to the bottom of the days after today
+        for (int e = 0; e < w.added; e++) {
+            int day = 1 + (w.today + e * 5) % BenchView::days;
+            int16_t x = BenchView::cellX(BenchView::column(day));
+            int16_t y = BenchView::cellY(BenchView::week(day)) + BenchView::rowHeight - 50;
+            benchRoundRect(band, x + 3, y, BenchView::dayWidth - 6, 48, 3, INK_BLACK);
+            benchText(band, x + 6, y + 11, "14:00-15:00", 11, FONT_SMALL, INK_WHITE);
+            benchWrapped(band, x + 6, y + 27, benchTitles[e % 12],
+                         BenchView::dayWidth - 12, 2, INK_WHITE);
+        }
+        frame.appendBand(band);
+    }
+}
+
+void test_delta_size_over_a_week() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 60));
+    CompressedFrame previous, frame, rebuilt;
+    renderWake(previous, band, wakeAt(0));
+
+    size_t fullBytes = 0;
+    size_t deltaBytes = 0;
+    size_t largest = 0;
+    std::vector<uint8_t> file;
+    for (int i = 1; i < days * wakesPerDay; i++) {
+        renderWake(frame, band, wakeAt(i));
+        file.clear();
+        frame.save(file);
+        fullBytes += file.size();
+        file.clear();
+        TEST_ASSERT_TRUE(frame.saveDelta(previous, file));
+        deltaBytes += file.size();
+        largest = file.size() > largest ? file.size() : largest;
+
+        TEST_ASSERT_TRUE(rebuilt.loadDelta(previous, file.data(), file.size()));
+        TEST_ASSERT_EQUAL_UINT32(frame.id(), rebuilt.id());
+        std::swap(previous, frame);
+    }
+    int count = days * wakesPerDay - 1;
+    printf("  %d wakes: frame files %.0f bytes, deltas %.0f bytes on average"
+           " (%.1fx smaller), largest delta %u bytes\n",
+           count, (double)fullBytes / count, (double)deltaBytes / count,
+           (double)fullBytes / deltaBytes, (unsigned)largest);
+    printf("  %u of %u bytes downloaded in the week\n", (unsigned)deltaBytes,
+           (unsigned)fullBytes);
+    // A status bar change is a few rows of the frame
+    TEST_ASSERT_LESS_THAN(fullBytes / 5, deltaBytes);
+}
+
+void test_delta_decode_throughput() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 60));
+    // The frames and deltas of one day, around a new event
+    const int first = 2 * wakesPerDay + 30;
+    const int wakes = 12;
+    std::vector<CompressedFrame> frames(wakes + 1);
+    std::vector<std::vector<uint8_t>> deltas(wakes);
+    for (int i = 0; i <= wakes; i++) {
+        renderWake(frames[i], band, wakeAt(first + i));
+    }
+    for (int i = 0; i < wakes; i++) {
+        TEST_ASSERT_TRUE(frames[i + 1].saveDelta(frames[i], deltas[i]));
+    }
+
+    const int rounds = 20;
+    CompressedFrame rebuilt;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int i = 0; i < wakes; i++) {
+            rebuilt.loadDelta(frames[i], deltas[i].data(), deltas[i].size());
+        }
+    }
+    double apply = benchSeconds(start) / (rounds * wakes);
+
+    // Streaming the rebuilt frame out band by band, as sent to SPI
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int16_t top = 0; top < 480; top += 60) {
+            band.setBand(top, 60);
+            rebuilt.decodeBand(band);
+        }
+    }
+    double stream = benchSeconds(start) / rounds;
+
+    start = std::chrono::steady_clock::now();
+    uint32_t ids = 0;
+    for (int r = 0; r < rounds; r++) {
+        ids += frames[r % wakes].id();
+    }
+    double id = benchSeconds(start) / rounds;
+    TEST_ASSERT_NOT_EQUAL(0, ids);
+
+    double raw = rebuilt.rawBytes();
+    printf("  apply delta %.3f ms/frame (%.0f MB/s of frame, base id %.3f ms"
+           " of it), stream bands %.3f ms/frame (%.0f MB/s)\n",
+           apply * 1e3, raw / apply / 1e6, id * 1e3, stream * 1e3,
+           raw / stream / 1e6);
+    TEST_PASS();
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_delta_size_over_a_week);
+    RUN_TEST(test_delta_decode_throughput);
+    return UNITY_END();
+}
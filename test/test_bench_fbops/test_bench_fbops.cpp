@@ -0,0 +1,108 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "fbops.h"
+#include "../bench_common/calendar_frame.h"
+
+static const fb_impl_t impls[] = {FB_PORTABLE, FB_SSE2, FB_AVX2};
+static const char *const implNames[] = {"portable", "sse2", "avx2"};
+
+// One plane of an 800x480 frame, and the rows it is usually handed over in
+static const size_t planeBytes = 800 / 8 * 480;
+static const size_t rowBytes = 800 / 8;
+
+// Both planes of a calendar frame, so runs and bit counts are realistic
+static void paintPlanes(std::vector<uint8_t> &black, std::vector<uint8_t> &red,
+                        uint32_t seed) {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 480));
+    band.setBand(0, 480);
+    paintCalendarFrame(band, seed, 2);
+    black.assign(band.black(), band.black() + planeBytes);
+    red.assign(band.red(), band.red() + planeBytes);
+}
+
+/* Runs kernel over the plane, whole and a row at a time, for every
+ * implementation the CPU has and prints the throughput in MB/s.
+ */
+template <typename Kernel>
+static void benchKernel(const char *name, int rounds, Kernel kernel) {
+    printf("  %-10s", name);
+    for (int i = 0; i < 3; i++) {
+        if (!fbUseImpl(impls[i])) {
+            continue;
+        }
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            kernel(0, planeBytes);
+        }
+        double whole = benchSeconds(start);
+        start = std::chrono::steady_clock::now();
+        for (int r = 0; r < rounds; r++) {
+            for (size_t at = 0; at < planeBytes; at += rowBytes) {
+                kernel(at, rowBytes);
+            }
+        }
+        double rows = benchSeconds(start);
+        printf(" %s %6.0f / %5.0f", implNames[i],
+               rounds * planeBytes / whole / 1e6, rounds * planeBytes / rows / 1e6);
+    }
+    printf("  MB/s, plane / rows\n");
+}
+
+void test_kernel_throughput() {
+    std::vector<uint8_t> black, red, other, out(planeBytes);
+    paintPlanes(black, red, 42);
+    paintPlanes(other, red, 43);
+    const int rounds = 200;
+    volatile size_t sink = 0;
+
+    benchKernel("fill", rounds, [&](size_t at, size_t n) {
+        fbFillBits(out.data() + at, 3, n * 8 - 3, at & 1);
+    });
+    benchKernel("xor_diff", rounds, [&](size_t at, size_t n) {
+        sink += fbXorDiff(out.data() + at, black.data() + at, other.data() + at, n);
+    });
+    benchKernel("compare", rounds, [&](size_t at, size_t n) {
+        sink += fbXorDiff(nullptr, black.data() + at, black.data() + at, n);
+    });
+    benchKernel("popcount", rounds, [&](size_t at, size_t n) {
+        sink += fbPopcount(black.data() + at, n);
+    });
+    // A blank band, which is scanned to its end
+    std::vector<uint8_t> white(planeBytes, 0xFF);
+    benchKernel("find_run", rounds, [&](size_t at, size_t n) {
+        sink += fbFindRun(white.data() + at, n, 0xFF).start;
+    });
+    benchKernel("hash", rounds, [&](size_t at, size_t n) {
+        sink += fbHash(FNV_OFFSET_BASIS, black.data() + at, n);
+    });
+
+    // The byte at a time versions they replace
+    auto start = std::chrono::steady_clock::now();
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (int r = 0; r < rounds; r++) {
+        hash = fnv1a(hash, black.data(), planeBytes);
+    }
+    double fnv = benchSeconds(start);
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        uint8_t all = 0xFF;
+        for (size_t i = 0; i < planeBytes; i++) {
+            all &= white[i];
+        }
+        sink += all;
+    }
+    double blank = benchSeconds(start);
+    printf("  bytewise FNV-1a %.0f MB/s, bytewise blank check %.0f MB/s\n",
+           rounds * planeBytes / fnv / 1e6, rounds * planeBytes / blank / 1e6);
+    sink += hash;
+    TEST_PASS();
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_kernel_throughput);
+    return UNITY_END();
+}
@@ -0,0 +1,118 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "compressed_frame.h"
+#include "../bench_common/calendar_frame.h"
+
+// Frames of an empty, a typical and a busy two weeks
+static const int busyness[] = {0, 2, 4};
+
+static void renderCompressed(CompressedFrame &frame, BandBuffer &band,
+                             int16_t bandHeight, uint32_t seed, int busy) {
+    frame.begin(800, 480);
+    for (int16_t top = 0; top < 480; top += bandHeight) {
+        band.setBand(top, bandHeight);
+        paintCalendarFrame(band, seed, busy);
+        frame.appendBand(band);
+    }
+}
+
+void test_compression_ratio_on_calendar_frames() {
+    BandBuffer raw;
+    BandBuffer band;
+    TEST_ASSERT_TRUE(raw.allocate(800, 480));
+    TEST_ASSERT_TRUE(band.allocate(800, 60));
+    CompressedFrame frame;
+    for (int busy : busyness) {
+        raw.setBand(0, 480);
+        paintCalendarFrame(raw, 42, busy);
+        renderCompressed(frame, band, 60, 42, busy);
+        printf("  %d events/day max: %u of %u bytes, ratio %.1f\n", busy,
+               (unsigned)frame.bytes(), (unsigned)frame.rawBytes(),
+               (double)frame.rawBytes() / frame.bytes());
+
+        // The compressed frame decodes to exactly the raw frame
+        for (int16_t top = 0; top < 480; top += 60) {
+            band.setBand(top, 60);
+            frame.decodeBand(band);
+            TEST_ASSERT_EQUAL_MEMORY(raw.blackRow(top), band.black(), 6000);
+            TEST_ASSERT_EQUAL_MEMORY(raw.redRow(top), band.red(), 6000);
+        }
+        // Even a busy frame takes less than a raw band of 120 rows
+        TEST_ASSERT_LESS_THAN(frame.rawBytes() / 4, frame.bytes());
+    }
+}
+
+void test_compress_and_decode_time() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 60));
+    CompressedFrame frame;
+    const int frames = 50;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        renderCompressed(frame, band, 60, i, 2);
+    }
+    double render = benchSeconds(start) / frames;
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        for (int16_t top = 0; top < 480; top += 60) {
+            band.setBand(top, 60);
+            frame.decodeBand(band);
+        }
+    }
+    double decode = benchSeconds(start) / frames;
+    printf("  paint + compress %.3f ms/frame, decode %.3f ms/frame\n",
+           render * 1e3, decode * 1e3);
+    TEST_PASS();
+}
+
+void test_fill_throughput() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 480));
+    band.setBand(0, 480);
+    const int rounds = 20;
+    // Event box sized rectangles at odd offsets, like the calendar cells
+    const int16_t w = 108;
+    const int16_t h = 48;
+    double pixels = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int16_t y = 0; y + h <= 480; y += 50) {
+            for (int16_t x = 3 + r % 5; x + w <= 800; x += 114) {
+                for (int16_t row = y; row < y + h; row++) {
+                    for (int16_t i = x; i < x + w; i++) {
+                        band.setPixel(i, row, r & 1 ? INK_RED : INK_BLACK);
+                    }
+                }
+                pixels += w * h;
+            }
+        }
+    }
+    double perPixel = benchSeconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int r = 0; r < rounds; r++) {
+        for (int16_t y = 0; y + h <= 480; y += 50) {
+            for (int16_t x = 3 + r % 5; x + w <= 800; x += 114) {
+                for (int16_t row = y; row < y + h; row++) {
+                    band.fillSpan(x, row, w, r & 1 ? INK_RED : INK_BLACK);
+                }
+            }
+        }
+    }
+    double spans = benchSeconds(start);
+    printf("  setPixel %.1f Mpx/s, fillSpan %.1f Mpx/s (%.1fx)\n",
+           pixels / perPixel / 1e6, pixels / spans / 1e6, perPixel / spans);
+    TEST_ASSERT_LESS_THAN(perPixel, spans);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_compression_ratio_on_calendar_frames);
+    RUN_TEST(test_compress_and_decode_time);
+    RUN_TEST(test_fill_throughput);
+    return UNITY_END();
+}
@@ -0,0 +1,156 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+#include "blitter.h"
+#include "../bench_common/calendar_frame.h"
+#include "../bench_common/gfx_reference.h"
+
+struct TextRun {
+    int16_t x;
+    int16_t y;
+    const char *text;
+    uint16_t length;
+    font_t font;
+};
+
+/* The text of a busy two week frame: weekday headers, day numbers, and four
+ * events a day with a time and a two line title.
+ */
+static std::vector<TextRun> calendarText() {
+    static const char *const weekdays[] = {"MONDAY", "TUESDAY", "WEDNESDAY",
+                                           "THURSDAY", "FRIDAY", "SATURDAY",
+                                           "SUNDAY"};
+    static const char *const numbers[] = {"11", "12", "13", "14", "15", "16", "17",
+                                          "18", "19", "20", "21", "22", "23", "24"};
+    std::vector<TextRun> runs;
+    for (int c = 0; c < BenchView::columns; c++) {
+        runs.push_back({(int16_t)(BenchView::cellX(c) + 20), 15, weekdays[c],
+                        (uint16_t)strlen(weekdays[c]), FONT_LARGE});
+    }
+    uint32_t rnd = 7;
+    for (int day = 1; day <= BenchView::days; day++) {
+        int16_t x = BenchView::cellX(BenchView::column(day));
+        int16_t y = BenchView::cellY(BenchView::week(day));
+        runs.push_back({(int16_t)(x + 5), (int16_t)(y + 20), numbers[day - 1], 2, FONT_LARGE});
+        for (int e = 0; e < 4; e++) {
+            int16_t eventY = y + 25 + e * 50;
+            runs.push_back({(int16_t)(x + 6), (int16_t)(eventY + 11), "09:00-10:30", 11,
+                            FONT_SMALL});
+            const char *title = benchTitles[benchRandom(rnd) % 12];
+            TextLine lines[2];
+            uint16_t count = wrapText(title, FONT_LARGE, BenchView::dayWidth - 12, 2, lines);
+            for (uint16_t i = 0; i < count; i++) {
+                runs.push_back({(int16_t)(x + 6), (int16_t)(eventY + 27 + i * 17),
+                                title + lines[i].start, lines[i].length, FONT_LARGE});
+            }
+        }
+    }
+    runs.push_back({520, 477, "22:14   Good (-63dBm)   87% (4.03v)", 35, FONT_SMALL});
+    return runs;
+}
+
+// drawGlyph() before, writing every pixel through the display's drawPixel()
+static void gfxText(GfxReference &gfx, const TextRun &run) {
+    const SparseFont &f = getFont(run.font);
+    forEachTextGlyph(f, run.text, run.length, [&](const GFXglyph &g, int16_t pen) {
+        uint32_t bit = g.bitmapOffset * 8u;
+        for (int16_t gy = 0; gy < g.height; gy++) {
+            for (int16_t gx = 0; gx < g.width; gx++, bit++) {
+                if (f.bitmap[bit >> 3] & (0x80 >> (bit & 7))) {
+                    gfx.drawPixel(run.x + pen + g.xOffset + gx, run.y + g.yOffset + gy,
+                                  INK_BLACK);
+                }
+            }
+        }
+    });
+}
+
+static void blitText(BandBuffer &band, GlyphCache &cache, const TextRun &run) {
+    const SparseFont &font = getFont(run.font);
+    forEachTextGlyph(font, run.text, run.length, [&](const GFXglyph &g, int16_t pen) {
+        blitGlyph(band, cache, font, g, run.x + pen, run.y, INK_BLACK);
+    });
+}
+
+/* Draws the runs into two 240 row bands, as drawDisplayList() does when the
+ * frame is rendered compressed.
+ */
+template <typename Draw>
+static void drawBands(BandBuffer &band, const std::vector<TextRun> &runs, Draw draw) {
+    for (int16_t top = 0; top < 480; top += 240) {
+        band.setBand(top, 240);
+        for (const TextRun &run : runs) {
+            if (run.y + 8 >= top && run.y - 20 < top + 240) {
+                draw(run);
+            }
+        }
+    }
+}
+
+void test_calendar_text_per_frame() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 240));
+    std::vector<TextRun> runs = calendarText();
+    const int frames = 200;
+    GfxReference gfx(band);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        drawBands(band, runs, [&](const TextRun &run) { gfxText(gfx, run); });
+    }
+    double gfxTime = benchSeconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        drawBands(band, runs, [&](const TextRun &run) {
+            benchText(band, run.x, run.y, run.text, run.length, run.font, INK_BLACK);
+        });
+    }
+    double pixelTime = benchSeconds(start);
+
+    GlyphCache cache;
+    drawBands(band, runs, [&](const TextRun &run) { blitText(band, cache, run); });
+    double firstFrameHitRate = 100.0 * cache.hits / (cache.hits + cache.misses);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        drawBands(band, runs, [&](const TextRun &run) { blitText(band, cache, run); });
+    }
+    double blitTime = benchSeconds(start);
+
+    printf("  %u text runs per frame: GFX path %.3f ms, setPixel() %.3f ms, "
+           "blitted %.3f ms (%.1fx the GFX path)\n",
+           (unsigned)runs.size(), gfxTime / frames * 1e3, pixelTime / frames * 1e3,
+           blitTime / frames * 1e3, gfxTime / blitTime);
+    printf("  glyph cache hit rate %.1f%% on the first frame\n", firstFrameHitRate);
+    TEST_ASSERT_LESS_THAN(gfxTime, blitTime);
+    TEST_ASSERT_LESS_THAN(pixelTime, blitTime);
+}
+
+void test_uncached_blit() {
+    // Every glyph unpacked from the font again, as when the cache thrashes
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 240));
+    std::vector<TextRun> runs = calendarText();
+    const int frames = 200;
+    GlyphCache cache;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < frames; i++) {
+        drawBands(band, runs, [&](const TextRun &run) {
+            cache.clear();
+            blitText(band, cache, run);
+        });
+    }
+    printf("  blitted without cache hits across runs %.3f ms per frame\n",
+           benchSeconds(start) / frames * 1e3);
+    TEST_PASS();
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_calendar_text_per_frame);
+    RUN_TEST(test_uncached_blit);
+    return UNITY_END();
+}
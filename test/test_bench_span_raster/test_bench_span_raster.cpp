@@ -0,0 +1,94 @@
+#include <unity.h>
+#include <stdio.h>
+#include <chrono>
+#include "span_raster.h"
+#include "../bench_common/gfx_reference.h"
+
+static double seconds(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+/* Draws the event boxes of a busy two week frame (four single day boxes per
+ * day plus a multi-day bar per week) into two 240 row bands, either through
+ * the GFX reference or the span rasterizer. Returns the pixels covered.
+ */
+template <typename Draw>
+static double drawEventBoxes(BandBuffer &band, Draw draw) {
+    double pixels = 0;
+    for (int16_t top = 0; top < 480; top += 240) {
+        band.setBand(top, 240);
+        for (int week = 0; week < 2; week++) {
+            int16_t cellY = 20 + week * 230;
+            draw(117, cellY + 25, 336, 28, 3);
+            pixels += 336 * 28;
+            for (int day = 0; day < 7; day++) {
+                for (int e = 0; e < 4; e++) {
+                    draw(day * 114 + 3, cellY + 55 + e * 50, 108, 48, 3);
+                    pixels += 108 * 48;
+                }
+            }
+        }
+    }
+    return pixels / 2;      // every box was visited by both bands
+}
+
+void test_event_boxes_pixels_per_second() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 240));
+    GfxReference gfx(band);
+    const int rounds = 200;
+    double pixels = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        pixels = drawEventBoxes(band, [&](int16_t x, int16_t y, int16_t w, int16_t h, int16_t r) {
+            gfx.fillRoundRect(x, y, w, h, r, INK_BLACK);
+        });
+    }
+    double gfxTime = seconds(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        drawEventBoxes(band, [&](int16_t x, int16_t y, int16_t w, int16_t h, int16_t r) {
+            fillRoundRectSpans(band, x, y, w, h, r, CORNERS_ALL, INK_BLACK);
+        });
+    }
+    double spanTime = seconds(start);
+
+    printf("  GFX path %.1f Mpx/s, spans %.1f Mpx/s (%.1fx), %.3f ms per frame\n",
+           pixels * rounds / gfxTime / 1e6, pixels * rounds / spanTime / 1e6,
+           gfxTime / spanTime, spanTime / rounds * 1e3);
+    TEST_ASSERT_LESS_THAN(gfxTime, spanTime);
+}
+
+void test_old_event_box_composition() {
+    // drawRoundedRect used to record two rectangles and four circles
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 240));
+    GfxReference gfx(band);
+    const int rounds = 200;
+    double pixels = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rounds; i++) {
+        pixels = drawEventBoxes(band, [&](int16_t x, int16_t y, int16_t w, int16_t h, int16_t r) {
+            gfx.fillRect(x + r, y, w - 2 * r, h, INK_BLACK);
+            gfx.fillRect(x, y + r, w, h - 2 * r, INK_BLACK);
+            gfx.fillCircle(x + r, y + r, r, INK_BLACK);
+            gfx.fillCircle(x + w - r - 1, y + r, r, INK_BLACK);
+            gfx.fillCircle(x + r, y + h - r - 1, r, INK_BLACK);
+            gfx.fillCircle(x + w - r - 1, y + h - r - 1, r, INK_BLACK);
+        });
+    }
+    double composed = seconds(start);
+    printf("  rectangles + circles through GFX %.1f Mpx/s\n",
+           pixels * rounds / composed / 1e6);
+    TEST_PASS();
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_event_boxes_pixels_per_second);
+    RUN_TEST(test_old_event_box_composition);
+    return UNITY_END();
+}
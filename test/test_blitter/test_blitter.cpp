@@ -0,0 +1,195 @@
+#include <unity.h>
+#include <string.h>
+#include "blitter.h"
+#include "text_layout.h"
+#include "../bench_common/band_pair.h"
+
+// Adafruit_GFX's drawChar(), pixel by pixel
+static void drawGlyphPixels(BandBuffer &band, const SparseFont &font,
+                            const GFXglyph &g, int16_t x, int16_t y, ink_t ink) {
+    uint32_t bit = g.bitmapOffset * 8u;
+    for (int16_t gy = 0; gy < g.height; gy++) {
+        for (int16_t gx = 0; gx < g.width; gx++, bit++) {
+            if (font.bitmap[bit >> 3] & (0x80 >> (bit & 7))) {
+                band.setPixel(x + g.xOffset + gx, y + g.yOffset + gy, ink);
+            }
+        }
+    }
+}
+
+static void drawText(GlyphCache &cache, int16_t x, int16_t y, const char *text,
+                     font_t font, ink_t ink) {
+    const SparseFont &f = getFont(font);
+    forEachTextGlyph(f, text, strlen(text), [&](const GFXglyph &g, int16_t pen) {
+        drawGlyphPixels(pixels, f, g, x + pen, y, ink);
+        blitGlyph(fast, cache, f, g, x + pen, y, ink);
+    });
+}
+
+void test_rows_match_pixels_at_every_offset() {
+    const uint8_t bits[3] = {0xA5, 0x3C, 0xF0};
+    for (int16_t w = 1; w <= 20; w++) {
+        for (int16_t x = -20; x < 20; x++) {
+            startBands(0, 2);
+            fast.blitRow(0, x, bits, w, false, INK_BLACK);
+            fast.blitRow(1, 780 + x, bits, w, true, INK_RED);
+            for (int16_t i = 0; i < w; i++) {
+                if (bits[i / 8] & (0x80 >> (i & 7))) {
+                    pixels.setPixel(x + i, 0, INK_BLACK);
+                } else {
+                    pixels.setPixel(780 + x + i, 1, INK_RED);
+                }
+            }
+            assertSameBands();
+        }
+    }
+}
+
+void test_white_ink_clears_both_planes() {
+    const uint8_t bits[2] = {0xFF, 0xFF};
+    startBands(0, 1);
+    fast.fill(INK_RED);
+    fast.blitRow(0, 4, bits, 12, false, INK_WHITE);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fast.blackRow(0)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x0F, fast.redRow(0)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fast.redRow(0)[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, fast.redRow(0)[2]);
+}
+
+void test_text_matches_pixels() {
+    GlyphCache cache;
+    const char *text = "Wear Red Day 2025: Größe & Élan!";
+    for (int16_t x = 0; x < 8; x++) {
+        startBands(0, 60);
+        drawText(cache, x, 20, text, FONT_LARGE, INK_BLACK);
+        drawText(cache, 3 * x + 1, 45, text, FONT_SMALL, INK_RED);
+        assertSameBands();
+    }
+}
+
+void test_text_clipped_to_band() {
+    GlyphCache cache;
+    // A line of text crossing the band edge, drawn into two bands
+    for (int16_t top = 0; top < 40; top += 20) {
+        startBands(top, 20);
+        drawText(cache, -5, 26, "MONDAY gypsum", FONT_LARGE, INK_BLACK);
+        drawText(cache, 760, 14, "87% (4.03v)", FONT_SMALL, INK_RED);
+        assertSameBands();
+    }
+}
+
+void test_inverted_bitmap() {
+    // 10x2 icon, a cleared bit is ink
+    const uint8_t icon[4] = {0x0F, 0xFF, 0xFF, 0x3F};
+    startBands(0, 4);
+    blitBitmap(fast, 3, 1, icon, 10, 2, true, INK_BLACK);
+    TEST_ASSERT_EQUAL_HEX8(0xE1, fast.blackRow(1)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fast.blackRow(1)[1]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fast.blackRow(2)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xE7, fast.blackRow(2)[1]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fast.blackRow(0)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fast.blackRow(3)[0]);
+}
+
+// 20x6 test icon, a ring of ink in white
+static constexpr uint8_t ringBitmap[] = {
+    0xFF, 0xFF, 0xFF,
+    0xF0, 0x00, 0xFF,
+    0xF7, 0xFE, 0xFF,
+    0xF7, 0xFE, 0xFF,
+    0xF0, 0x00, 0xFF,
+    0xFF, 0xFF, 0xFF,
+};
+static constexpr auto ringPacked =
+    buildStaticIcon<encodeIcon(ringBitmap, 20, 6, nullptr)>(ringBitmap, 20, 6);
+
+void test_packed_icon_matches_bitmap() {
+    static_assert(sizeof(ringPacked.data) < sizeof(ringBitmap),
+                  "runs continue across rows");
+    const PackedIcon ring = ringPacked.icon();
+    // Crossing the band edge, so only part of it is decoded per band
+    for (int16_t top = 0; top < 12; top += 4) {
+        startBands(top, 4);
+        blitIcon(fast, 5, 3, ring, INK_RED);
+        blitBitmap(pixels, 5, 3, ringBitmap, 20, 6, true, INK_RED);
+        assertSameBands();
+    }
+}
+
+void test_cache_hits_repeated_glyphs() {
+    GlyphCache cache;
+    const SparseFont &font = getFont(FONT_SMALL);
+    const GFXglyph *zero = findGlyph(font, '0');
+    TEST_ASSERT_NOT_NULL(cache.get(font, *zero));
+    const CachedGlyph *cached = cache.get(font, *zero);
+    TEST_ASSERT_EQUAL_PTR(zero, cached->glyph);
+    TEST_ASSERT_EQUAL_UINT32(1, cache.hits);
+    TEST_ASSERT_EQUAL_UINT32(1, cache.misses);
+
+    uint8_t rows[GLYPH_CACHE_MAX_HEIGHT * GLYPH_CACHE_ROW_BYTES];
+    unpackGlyph(font, *zero, rows, GLYPH_CACHE_ROW_BYTES);
+    TEST_ASSERT_EQUAL_MEMORY(rows, cached->rows, zero->height * GLYPH_CACHE_ROW_BYTES);
+
+    cache.clear();
+    cache.get(font, *zero);
+    TEST_ASSERT_EQUAL_UINT32(0, cache.hits);
+    TEST_ASSERT_EQUAL_UINT32(1, cache.misses);
+}
+
+void test_cache_evicts_least_recently_used() {
+    GlyphCache cache;
+    const SparseFont &font = getFont(FONT_SMALL);
+    // Glyph records that share a set, see GlyphCache::get()
+    GFXglyph glyphs[GLYPH_CACHE_SETS * (GLYPH_CACHE_WAYS + 1)];
+    for (size_t i = 0; i < sizeof(glyphs) / sizeof(glyphs[0]); i++) {
+        glyphs[i] = *findGlyph(font, 'a');
+    }
+    const GFXglyph *set[GLYPH_CACHE_WAYS + 1];
+    int found = 0;
+    uintptr_t first = (uintptr_t)&glyphs[0];
+    for (size_t i = 0; i < sizeof(glyphs) / sizeof(glyphs[0]) && found <= GLYPH_CACHE_WAYS; i++) {
+        uintptr_t key = (uintptr_t)&glyphs[i];
+        if ((key ^ (key >> 5)) % GLYPH_CACHE_SETS == (first ^ (first >> 5)) % GLYPH_CACHE_SETS) {
+            set[found++] = &glyphs[i];
+        }
+    }
+    TEST_ASSERT_EQUAL(GLYPH_CACHE_WAYS + 1, found);
+
+    for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+        cache.get(font, *set[i]);
+    }
+    cache.get(font, *set[0]);                      // set[1] is now the oldest
+    cache.get(font, *set[GLYPH_CACHE_WAYS]);       // evicts set[1]
+    TEST_ASSERT_EQUAL_UINT32(1, cache.hits);
+    cache.get(font, *set[0]);
+    cache.get(font, *set[2]);
+    TEST_ASSERT_EQUAL_UINT32(3, cache.hits);
+    cache.get(font, *set[1]);
+    TEST_ASSERT_EQUAL_UINT32(3, cache.hits);
+    TEST_ASSERT_EQUAL_UINT32(GLYPH_CACHE_WAYS + 2, cache.misses);
+}
+
+void test_large_glyphs_bypass_cache() {
+    GlyphCache cache;
+    const SparseFont &font = getFont(FONT_LARGE);
+    GFXglyph wide = *findGlyph(font, 'W');
+    wide.width = GLYPH_CACHE_ROW_BYTES * 8 + 1;
+    TEST_ASSERT_NULL(cache.get(font, wide));
+    TEST_ASSERT_EQUAL_UINT32(0, cache.misses);
+}
+
+int main(int argc, char **argv) {
+    fast.allocate(800, 60);
+    pixels.allocate(800, 60);
+    UNITY_BEGIN();
+    RUN_TEST(test_rows_match_pixels_at_every_offset);
+    RUN_TEST(test_white_ink_clears_both_planes);
+    RUN_TEST(test_text_matches_pixels);
+    RUN_TEST(test_text_clipped_to_band);
+    RUN_TEST(test_inverted_bitmap);
+    RUN_TEST(test_packed_icon_matches_bitmap);
+    RUN_TEST(test_cache_hits_repeated_glyphs);
+    RUN_TEST(test_cache_evicts_least_recently_used);
+    RUN_TEST(test_large_glyphs_bypass_cache);
+    return UNITY_END();
+}
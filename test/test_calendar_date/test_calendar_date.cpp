@@ -0,0 +1,48 @@
+#include <unity.h>
+#include "calendar_date.h"
+#include "calendar_geometry.h"
+
+void test_days_since_the_epoch() {
+    static_assert(daysFromCivil(1970, 1, 1) == 0, "the epoch");
+    TEST_ASSERT_EQUAL_INT32(20096, daysFromCivil(2025, 1, 8));
+    TEST_ASSERT_EQUAL_INT32(20096, parseDateDays("2025-01-08T09:30:00+01:00"));
+    TEST_ASSERT_EQUAL_INT32(0, parseDateDays("2025-01"));
+}
+
+void test_month_and_year_ends() {
+    // 2024 is a leap year, 2025 and 2100 are not
+    TEST_ASSERT_EQUAL_INT32(1, daysFromCivil(2024, 3, 1) - daysFromCivil(2024, 2, 29));
+    TEST_ASSERT_EQUAL_INT32(1, daysFromCivil(2025, 3, 1) - daysFromCivil(2025, 2, 28));
+    TEST_ASSERT_EQUAL_INT32(1, daysFromCivil(2100, 3, 1) - daysFromCivil(2100, 2, 28));
+    TEST_ASSERT_EQUAL_INT32(1, daysFromCivil(2026, 1, 1) - daysFromCivil(2025, 12, 31));
+    TEST_ASSERT_EQUAL_INT(29, dayOfMonth(daysFromCivil(2024, 2, 29)));
+    TEST_ASSERT_EQUAL_INT(1, dayOfMonth(daysFromCivil(2025, 3, 1)));
+    TEST_ASSERT_EQUAL_INT(31, dayOfMonth(daysFromCivil(2025, 12, 31)));
+}
+
+void test_six_weeks_cross_two_month_ends() {
+    typedef CalendarGeometry<6, 800, 480, 20> Month;
+    // A view starting on Monday 2025-01-27 runs to Sunday 2025-03-09
+    const int32_t start = parseDateDays("2025-01-27");
+    int monthStarts = 0;
+    for (int day = 1; day <= Month::days; day++) {
+        int shown = dayOfMonth(start + day - 1);
+        TEST_ASSERT_TRUE(shown >= 1 && shown <= 31);
+        monthStarts += shown == 1;
+    }
+    TEST_ASSERT_EQUAL_INT(2, monthStarts);
+    TEST_ASSERT_EQUAL_INT(9, dayOfMonth(start + Month::days - 1));
+    // Events in March land in the last week
+    int day = parseDateDays("2025-03-05") - start + 1;
+    TEST_ASSERT_EQUAL_INT(38, day);
+    TEST_ASSERT_EQUAL_INT(5, Month::week(day));
+    TEST_ASSERT_EQUAL_INT(2, Month::column(day));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_days_since_the_epoch);
+    RUN_TEST(test_month_and_year_ends);
+    RUN_TEST(test_six_weeks_cross_two_month_ends);
+    return UNITY_END();
+}
@@ -0,0 +1,270 @@
+#include <unity.h>
+#include <string.h>
+#include "compressed_frame.h"
+
+// Draws a reproducible pattern of boxes and noise into the current band
+static void drawPattern(BandBuffer &band) {
+    for (int16_t y = band.top(); y < band.top() + band.rows(); y++) {
+        if (y % 40 == 0) {
+            band.fillSpan(0, y, band.width(), INK_BLACK);
+        }
+        if (y % 40 > 10 && y % 40 < 30) {
+            band.fillSpan(20 + y % 7, y, 90, y < 60 ? INK_RED : INK_BLACK);
+        }
+        band.setPixel((y * 37) % band.width(), y, INK_BLACK);
+    }
+}
+
+static void renderFrame(CompressedFrame &frame, BandBuffer &band,
+                        int16_t height, int16_t bandHeight) {
+    for (int16_t top = 0; top < height; top += bandHeight) {
+        band.setBand(top, height - top < bandHeight ? height - top : bandHeight);
+        drawPattern(band);
+        frame.appendBand(band);
+    }
+}
+
+void test_round_trip_matches_raw_frame() {
+    const int16_t width = 160;
+    const int16_t height = 120;
+    BandBuffer raw;
+    TEST_ASSERT_TRUE(raw.allocate(width, height));
+    raw.setBand(0, height);
+    drawPattern(raw);
+
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(width, 25));
+    CompressedFrame frame;
+    frame.begin(width, height);
+    renderFrame(frame, band, height, 25);
+    TEST_ASSERT_EQUAL_INT16(height, frame.rows());
+
+    // Decode with a different band height than was used to render
+    BandBuffer out;
+    TEST_ASSERT_TRUE(out.allocate(width, 50));
+    for (int16_t top = 0; top < height; top += 50) {
+        out.setBand(top, height - top < 50 ? height - top : 50);
+        frame.decodeBand(out);
+        for (int16_t row = 0; row < out.rows(); row++) {
+            TEST_ASSERT_EQUAL_MEMORY(raw.blackRow(top + row), out.blackRow(row), width / 8);
+            TEST_ASSERT_EQUAL_MEMORY(raw.redRow(top + row), out.redRow(row), width / 8);
+        }
+    }
+}
+
+void test_white_frame_is_tiny() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(800, 60));
+    CompressedFrame frame;
+    frame.begin(800, 480);
+    for (int16_t top = 0; top < 480; top += 60) {
+        band.setBand(top, 60);
+        frame.appendBand(band);
+    }
+    TEST_ASSERT_EQUAL_size_t(96000, frame.rawBytes());
+    // Two bytes per plane row plus the row index
+    TEST_ASSERT_EQUAL_size_t(480 * 2 * (2 + 4), frame.bytes());
+}
+
+void test_begin_drops_previous_frame() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(64, 8));
+    CompressedFrame frame;
+    frame.begin(64, 8);
+    band.setBand(0, 8);
+    frame.appendBand(band);
+    frame.begin(64, 16);
+    TEST_ASSERT_EQUAL_INT16(0, frame.rows());
+    TEST_ASSERT_EQUAL_INT16(16, frame.height());
+}
+
+void test_single_plane_round_trip() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(64, 8, 1));
+    CompressedFrame frame;
+    frame.begin(64, 16, 1);
+    renderFrame(frame, band, 16, 8);
+    TEST_ASSERT_EQUAL_INT16(16, frame.rows());
+    TEST_ASSERT_EQUAL_size_t(64 / 8 * 16, frame.rawBytes());
+
+    BandBuffer raw;
+    TEST_ASSERT_TRUE(raw.allocate(64, 16, 1));
+    raw.setBand(0, 16);
+    drawPattern(raw);
+    band.setBand(8, 8);
+    frame.decodeBand(band);
+    for (int16_t row = 0; row < 8; row++) {
+        TEST_ASSERT_EQUAL_MEMORY(raw.blackRow(8 + row), band.blackRow(row), 64 / 8);
+    }
+}
+
+void test_frame_file_round_trip() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(160, 30));
+    CompressedFrame frame;
+    frame.begin(160, 120);
+    renderFrame(frame, band, 120, 30);
+    std::vector<uint8_t> file;
+    frame.save(file);
+    TEST_ASSERT_EQUAL_size_t(FRAME_FILE_HEADER_SIZE + frame.bytes() - 120 * 2 * 4,
+                             file.size());
+    TEST_ASSERT_EQUAL_MEMORY("CALF", file.data(), 4);
+
+    CompressedFrame loaded;
+    TEST_ASSERT_TRUE(loaded.load(file.data(), file.size()));
+    TEST_ASSERT_EQUAL_INT16(160, loaded.width());
+    TEST_ASSERT_EQUAL_INT16(120, loaded.rows());
+    TEST_ASSERT_EQUAL_UINT8(2, loaded.planes());
+    BandBuffer a, b;
+    TEST_ASSERT_TRUE(a.allocate(160, 120));
+    TEST_ASSERT_TRUE(b.allocate(160, 120));
+    a.setBand(0, 120);
+    b.setBand(0, 120);
+    frame.decodeBand(a);
+    loaded.decodeBand(b);
+    TEST_ASSERT_EQUAL_MEMORY(a.black(), b.black(), 160 / 8 * 120 * 2);
+}
+
+void test_frame_file_rejects_bad_files() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(64, 8, 1));
+    CompressedFrame frame;
+    frame.begin(64, 16, 1);
+    renderFrame(frame, band, 16, 8);
+    std::vector<uint8_t> file;
+    frame.save(file);
+
+    CompressedFrame loaded;
+    TEST_ASSERT_TRUE(loaded.load(file.data(), file.size()));
+    TEST_ASSERT_EQUAL_UINT8(1, loaded.planes());
+    // Cut short by a byte
+    TEST_ASSERT_FALSE(loaded.load(file.data(), file.size() - 1));
+    TEST_ASSERT_EQUAL_INT16(0, loaded.rows());
+    TEST_ASSERT_FALSE(loaded.load(file.data(), FRAME_FILE_HEADER_SIZE - 1));
+    std::vector<uint8_t> bad = file;
+    bad[4] = FRAME_FILE_VERSION + 1;
+    TEST_ASSERT_FALSE(loaded.load(bad.data(), bad.size()));
+    bad = file;
+    bad[6] = 60;   // width not a multiple of 8
+    TEST_ASSERT_FALSE(loaded.load(bad.data(), bad.size()));
+}
+
+// The pattern frame with a box drawn over rows [top, bottom)
+static void renderChanged(CompressedFrame &frame, BandBuffer &band,
+                          int16_t top, int16_t bottom) {
+    frame.begin(160, 120);
+    for (int16_t y = 0; y < 120; y += 30) {
+        band.setBand(y, 30);
+        drawPattern(band);
+        for (int16_t row = top; row < bottom; row++) {
+            band.fillSpan(64, row, 40, row % 2 ? INK_RED : INK_WHITE);
+        }
+        frame.appendBand(band);
+    }
+}
+
+void test_delta_rebuilds_the_frame() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(160, 30));
+    CompressedFrame base, next;
+    base.begin(160, 120);
+    renderFrame(base, band, 120, 30);
+    renderChanged(next, band, 20, 50);
+
+    std::vector<uint8_t> delta;
+    TEST_ASSERT_TRUE(next.saveDelta(base, delta));
+    TEST_ASSERT_EQUAL_MEMORY("CALD", delta.data(), 4);
+    // 30 changed rows of a few packets each, nothing for the others
+    TEST_ASSERT_LESS_THAN(30 * 2 * 12, delta.size());
+
+    CompressedFrame rebuilt;
+    TEST_ASSERT_TRUE(rebuilt.loadDelta(base, delta.data(), delta.size()));
+    TEST_ASSERT_EQUAL_INT16(120, rebuilt.rows());
+    TEST_ASSERT_EQUAL_UINT32(next.id(), rebuilt.id());
+    BandBuffer a, b;
+    TEST_ASSERT_TRUE(a.allocate(160, 120));
+    TEST_ASSERT_TRUE(b.allocate(160, 120));
+    a.setBand(0, 120);
+    b.setBand(0, 120);
+    next.decodeBand(a);
+    rebuilt.decodeBand(b);
+    TEST_ASSERT_EQUAL_MEMORY(a.black(), b.black(), 160 / 8 * 120 * 2);
+
+    // Changes reaching the last row, and none at all
+    renderChanged(next, band, 100, 120);
+    delta.clear();
+    TEST_ASSERT_TRUE(next.saveDelta(base, delta));
+    TEST_ASSERT_TRUE(rebuilt.loadDelta(base, delta.data(), delta.size()));
+    TEST_ASSERT_EQUAL_UINT32(next.id(), rebuilt.id());
+    delta.clear();
+    TEST_ASSERT_TRUE(base.saveDelta(base, delta));
+    TEST_ASSERT_EQUAL_size_t(DELTA_FILE_HEADER_SIZE + 4, delta.size());
+    TEST_ASSERT_TRUE(rebuilt.loadDelta(base, delta.data(), delta.size()));
+    TEST_ASSERT_EQUAL_UINT32(base.id(), rebuilt.id());
+}
+
+void test_delta_rejects_other_bases() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(160, 30));
+    CompressedFrame base, next, other;
+    base.begin(160, 120);
+    renderFrame(base, band, 120, 30);
+    renderChanged(next, band, 20, 50);
+    renderChanged(other, band, 0, 10);
+    TEST_ASSERT_NOT_EQUAL(base.id(), other.id());
+
+    std::vector<uint8_t> delta;
+    TEST_ASSERT_TRUE(next.saveDelta(base, delta));
+    CompressedFrame rebuilt;
+    TEST_ASSERT_FALSE(rebuilt.loadDelta(other, delta.data(), delta.size()));
+    TEST_ASSERT_EQUAL_INT16(0, rebuilt.rows());
+    TEST_ASSERT_FALSE(rebuilt.loadDelta(base, delta.data(), delta.size() - 1));
+    // A frame file is not a delta file
+    std::vector<uint8_t> file;
+    next.save(file);
+    TEST_ASSERT_FALSE(rebuilt.loadDelta(base, file.data(), file.size()));
+
+    CompressedFrame small;
+    small.begin(64, 16);
+    TEST_ASSERT_FALSE(next.saveDelta(small, delta));
+}
+
+void test_same_packing_tells_unchanged_frames() {
+    BandBuffer band;
+    TEST_ASSERT_TRUE(band.allocate(160, 30));
+    CompressedFrame base, next;
+    base.begin(160, 120);
+    renderFrame(base, band, 120, 30);
+    renderChanged(next, band, 20, 50);
+    TEST_ASSERT_FALSE(next.samePacking(base));
+
+    // A delta without changes copies every row of the base packed
+    std::vector<uint8_t> delta;
+    TEST_ASSERT_TRUE(base.saveDelta(base, delta));
+    CompressedFrame rebuilt;
+    TEST_ASSERT_TRUE(rebuilt.loadDelta(base, delta.data(), delta.size()));
+    TEST_ASSERT_TRUE(rebuilt.samePacking(base));
+    // Changed rows are packed again, the same way
+    delta.clear();
+    TEST_ASSERT_TRUE(next.saveDelta(base, delta));
+    TEST_ASSERT_TRUE(rebuilt.loadDelta(base, delta.data(), delta.size()));
+    TEST_ASSERT_TRUE(rebuilt.samePacking(next));
+    TEST_ASSERT_FALSE(rebuilt.samePacking(base));
+
+    CompressedFrame empty;
+    TEST_ASSERT_FALSE(base.samePacking(empty));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_round_trip_matches_raw_frame);
+    RUN_TEST(test_white_frame_is_tiny);
+    RUN_TEST(test_begin_drops_previous_frame);
+    RUN_TEST(test_single_plane_round_trip);
+    RUN_TEST(test_frame_file_round_trip);
+    RUN_TEST(test_frame_file_rejects_bad_files);
+    RUN_TEST(test_delta_rebuilds_the_frame);
+    RUN_TEST(test_delta_rejects_other_bases);
+    RUN_TEST(test_same_packing_tells_unchanged_frames);
+    return UNITY_END();
+}
@@ -0,0 +1,102 @@
+#include <unity.h>
+#include <string.h>
+#include <vector>
+#include "display_list.h"
+
+// Collects the indices of the commands replayed for one band
+static std::vector<int> replayBand(const DisplayList &dl, int16_t top, int16_t bottom) {
+    std::vector<int> replayed;
+    dl.forEachInBand(top, bottom, [&](const DisplayCommand &cmd) {
+        replayed.push_back(&cmd - &dl[0]);
+    });
+    return replayed;
+}
+
+void test_rect_bounds() {
+    DisplayList dl;
+    dl.fillRect(10, 20, 30, 40, 0);
+    TEST_ASSERT_EQUAL_INT16(10, dl[0].bounds.x0);
+    TEST_ASSERT_EQUAL_INT16(20, dl[0].bounds.y0);
+    TEST_ASSERT_EQUAL_INT16(40, dl[0].bounds.x1);
+    TEST_ASSERT_EQUAL_INT16(60, dl[0].bounds.y1);
+}
+
+void test_circle_bounds_include_edge_pixels() {
+    DisplayList dl;
+    dl.fillCircle(100, 50, 3, 0);
+    TEST_ASSERT_EQUAL_INT16(97, dl[0].bounds.x0);
+    TEST_ASSERT_EQUAL_INT16(47, dl[0].bounds.y0);
+    TEST_ASSERT_EQUAL_INT16(104, dl[0].bounds.x1);
+    TEST_ASSERT_EQUAL_INT16(54, dl[0].bounds.y1);
+}
+
+void test_round_rect_keeps_corners() {
+    DisplayList dl;
+    dl.fillRoundRect(0, 0, 50, 28, 3, 0);
+    dl.fillRoundRect(0, 30, 50, 28, 3, 0, CORNERS_LEFT);
+    TEST_ASSERT_EQUAL_UINT8(CORNERS_ALL, dl[0].corners);
+    TEST_ASSERT_EQUAL_UINT8(CORNERS_LEFT, dl[1].corners);
+    TEST_ASSERT_EQUAL_INT16(3, dl[1].r);
+}
+
+void test_horizontal_line_is_one_row() {
+    DisplayList dl;
+    dl.line(0, 240, 800, 240, 0);
+    TEST_ASSERT_TRUE(DisplayList::inBand(dl[0], 0, 241));
+    TEST_ASSERT_TRUE(DisplayList::inBand(dl[0], 240, 480));
+    TEST_ASSERT_FALSE(DisplayList::inBand(dl[0], 0, 240));
+    TEST_ASSERT_FALSE(DisplayList::inBand(dl[0], 241, 480));
+}
+
+void test_commands_split_across_two_bands() {
+    DisplayList dl;
+    dl.fillRect(0, 0, 10, 10, 0);       // top band only
+    dl.fillRect(0, 230, 10, 20, 0);     // straddles the band boundary
+    dl.fillRect(0, 400, 10, 10, 0);     // bottom band only
+
+    std::vector<int> top = replayBand(dl, 0, 240);
+    TEST_ASSERT_EQUAL_INT(2, top.size());
+    TEST_ASSERT_EQUAL_INT(0, top[0]);
+    TEST_ASSERT_EQUAL_INT(1, top[1]);
+
+    std::vector<int> bottom = replayBand(dl, 240, 480);
+    TEST_ASSERT_EQUAL_INT(2, bottom.size());
+    TEST_ASSERT_EQUAL_INT(1, bottom[0]);
+    TEST_ASSERT_EQUAL_INT(2, bottom[1]);
+}
+
+void test_text_is_stored_and_culled_by_measured_bounds() {
+    DisplayList dl;
+    dl.text(5, 300, "Swimming lesson", FONT_LARGE, 0, {5, 288, 90, 304});
+    dl.text(5, 20, "MONDAY", FONT_SMALL, 0, {5, 10, 60, 20});
+
+    TEST_ASSERT_EQUAL_STRING("Swimming lesson", dl.textOf(dl[0]));
+    TEST_ASSERT_EQUAL_STRING("MONDAY", dl.textOf(dl[1]));
+    TEST_ASSERT_EQUAL_INT(FONT_LARGE, dl[0].font);
+
+    std::vector<int> bottom = replayBand(dl, 240, 480);
+    TEST_ASSERT_EQUAL_INT(1, bottom.size());
+    TEST_ASSERT_EQUAL_INT(0, bottom[0]);
+}
+
+void test_clear() {
+    DisplayList dl;
+    dl.fillRect(0, 0, 1, 1, 0);
+    dl.text(0, 0, "x", FONT_SMALL, 0, {0, 0, 1, 1});
+    dl.clear();
+    TEST_ASSERT_EQUAL_INT(0, dl.size());
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_rect_bounds);
+    RUN_TEST(test_circle_bounds_include_edge_pixels);
+    RUN_TEST(test_round_rect_keeps_corners);
+    RUN_TEST(test_horizontal_line_is_one_row);
+    RUN_TEST(test_commands_split_across_two_bands);
+    RUN_TEST(test_text_is_stored_and_culled_by_measured_bounds);
+    RUN_TEST(test_clear);
+
+    return UNITY_END();
+}
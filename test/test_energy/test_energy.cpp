@@ -0,0 +1,193 @@
+#include <unity.h>
+#include <stdio.h>
+#include "energy.h"
+#include "wake_schedule.h"
+
+// The currents from config.h.template, a 1000 mAh battery for half a year
+static const EnergyModel model = {{45, 130, 110, 50, 45, 20}, {20, 8, 0}, 15,
+                                   1000, 182};
+
+// 2026-10-18, any time after the epoch works
+static const uint32_t start = 1792281600;
+
+// A typical wake at 240 MHz: 26.5 s awake, 1077.5 mA x s
+static void addWake(EnergyLedger &ledger) {
+    energyAddPhase(ledger, PHASE_BOOT, CLOCK_240MHZ, 1000);
+    energyAddPhase(ledger, PHASE_WIFI, CLOCK_240MHZ, 3000);
+    energyAddPhase(ledger, PHASE_HTTP, CLOCK_240MHZ, 2000);
+    energyAddPhase(ledger, PHASE_RENDER, CLOCK_240MHZ, 500);
+    energyAddPhase(ledger, PHASE_REFRESH, CLOCK_240MHZ, 20000);
+}
+
+void test_wake_and_sleep_are_booked() {
+    EnergyLedger ledger = {};
+    addWake(ledger);
+    energySettle(ledger, model, start);
+    TEST_ASSERT_EQUAL_UINT32(1077500, ledger.lastWakeUc);
+    TEST_ASSERT_EQUAL_UINT64(1077500, ledger.usedUc);
+    TEST_ASSERT_EQUAL_UINT32(start, ledger.chargedAt);
+    TEST_ASSERT_EQUAL_UINT16(100, ledger.stretch);
+
+    // An hour later: the wake plus an hour at 15 uA
+    addWake(ledger);
+    energySettle(ledger, model, start + 3600);
+    TEST_ASSERT_EQUAL_UINT64(2 * 1077500 + 3600 * 15, ledger.usedUc);
+    TEST_ASSERT_EQUAL_UINT32(3600, ledger.windowS);
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        TEST_ASSERT_EQUAL_UINT32(0, ledger.phaseMs[p]);
+    }
+}
+
+void test_wakes_without_time_are_booked_later() {
+    EnergyLedger ledger = {};
+    energySettle(ledger, model, start);
+    addWake(ledger);
+    energySettle(ledger, model, 0);
+    TEST_ASSERT_EQUAL_UINT64(1077500, ledger.usedUc);
+    TEST_ASSERT_EQUAL_UINT32(0, ledger.windowS);
+    addWake(ledger);
+    energySettle(ledger, model, start + 7200);
+    TEST_ASSERT_EQUAL_UINT64(2 * 1077500 + 7200 * 15, ledger.usedUc);
+    TEST_ASSERT_EQUAL_UINT32(7200, ledger.windowS);
+}
+
+void test_lower_clocks_are_subtracted() {
+    EnergyLedger ledger = {};
+    // Boot and WiFi at 80 MHz, parsing at 240 MHz
+    energyAddStep(ledger, 0, PHASE_BOOT, CLOCK_80MHZ);
+    energyAddPhase(ledger, PHASE_BOOT, CLOCK_80MHZ, 1000);
+    energyAddPhase(ledger, PHASE_WIFI, CLOCK_80MHZ, 3000);
+    energyAddStep(ledger, 4000, PHASE_PARSE, CLOCK_240MHZ);
+    energyAddPhase(ledger, PHASE_PARSE, CLOCK_240MHZ, 500);
+    // The refresh sleeps, 80 MHz saves nothing there
+    energyAddPhase(ledger, PHASE_REFRESH, CLOCK_80MHZ, 10000);
+    TEST_ASSERT_EQUAL_UINT8(2, ledger.profileSteps);
+    TEST_ASSERT_EQUAL_UINT32(4000, ledger.profile[1].atMs);
+    TEST_ASSERT_EQUAL_UINT8(PHASE_PARSE, ledger.profile[1].phase);
+
+    // 660 mA x s at 240 MHz, less 4 s at 20 mA
+    energySettle(ledger, model, start);
+    TEST_ASSERT_EQUAL_UINT32(580000, ledger.lastWakeUc);
+    TEST_ASSERT_EQUAL_UINT32(80000, ledger.lastSavedUc);
+    TEST_ASSERT_EQUAL_UINT8(0, ledger.profileSteps);
+    for (int c = 0; c < CLOCK_COUNT; c++) {
+        TEST_ASSERT_EQUAL_UINT32(0, ledger.clockMs[c]);
+    }
+
+    // The profile keeps its first steps
+    for (int i = 0; i < PROFILE_STEPS + 4; i++) {
+        energyAddStep(ledger, i, PHASE_HTTP, CLOCK_80MHZ);
+    }
+    TEST_ASSERT_EQUAL_UINT8(PROFILE_STEPS, ledger.profileSteps);
+    TEST_ASSERT_EQUAL_UINT32(PROFILE_STEPS - 1,
+                             ledger.profile[PROFILE_STEPS - 1].atMs);
+}
+
+void test_stretch_follows_the_target() {
+    // 1000 mAh over 182 days is 228.9 uA
+    EnergyLedger ledger = {};
+    energySettle(ledger, model, start);
+    TEST_ASSERT_EQUAL_UINT32(228, energyTargetUa(ledger, model, start));
+
+    // A wake every 10 minutes draws far more, the intervals double
+    uint32_t now = start;
+    while (ledger.stretch == 100) {
+        addWake(ledger);
+        now += 600;
+        energySettle(ledger, model, now);
+    }
+    TEST_ASSERT_EQUAL_UINT32(start + ENERGY_WINDOW, now);
+    TEST_ASSERT_EQUAL_UINT16(200, ledger.stretch);
+
+    // A day of sleep draws less, they shrink again, by at most half a day
+    energySettle(ledger, model, now + ENERGY_WINDOW);
+    TEST_ASSERT_EQUAL_UINT16(100, ledger.stretch);
+    energySettle(ledger, model, now + 2 * ENERGY_WINDOW);
+    TEST_ASSERT_EQUAL_UINT16(50, ledger.stretch);
+    energySettle(ledger, model, now + 3 * ENERGY_WINDOW);
+    TEST_ASSERT_EQUAL_UINT16(MIN_STRETCH, ledger.stretch);
+
+    // Without a target the schedule is kept
+    const EnergyModel untargeted = {{45, 130, 110, 50, 45, 20}, {20, 8, 0},
+                                     15, 1000, 0};
+    energySettle(ledger, untargeted, now + 4 * ENERGY_WINDOW);
+    TEST_ASSERT_EQUAL_UINT16(100, ledger.stretch);
+}
+
+void test_restart_after_a_charge() {
+    EnergyLedger ledger = {};
+    energySettle(ledger, model, start);
+    ledger.stretch = 300;
+    ledger.usedUc = 123456789;
+    addWake(ledger);
+    // The wake finding the battery full doesn't know the time yet
+    energyRestart(ledger, 0);
+    TEST_ASSERT_EQUAL_UINT64(0, ledger.usedUc);
+    TEST_ASSERT_EQUAL_UINT16(300, ledger.stretch);
+    TEST_ASSERT_EQUAL_UINT32(start, ledger.chargedAt);
+    // The running wake is booked after the charge
+    TEST_ASSERT_EQUAL_UINT32(20000, ledger.phaseMs[PHASE_REFRESH]);
+    // and so is the sleep across the charge
+    energySettle(ledger, model, start + 100);
+    TEST_ASSERT_EQUAL_UINT32(start, ledger.chargedAt);
+    TEST_ASSERT_EQUAL_UINT64(1077500 + 100 * 15, ledger.usedUc);
+    TEST_ASSERT_EQUAL_UINT32(100, ledger.windowS);
+}
+
+void test_restart_before_any_time_is_known() {
+    EnergyLedger ledger = {};
+    ledger.stretch = 100;
+    energyRestart(ledger, 0);
+    addWake(ledger);
+    energySettle(ledger, model, start);
+    TEST_ASSERT_EQUAL_UINT32(start, ledger.chargedAt);
+    TEST_ASSERT_EQUAL_UINT64(1077500, ledger.usedUc);
+}
+
+// Every 30 minutes from 06:00 to midnight
+#define HALF_HOURLY 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, \
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30
+static constexpr uint16_t halfHourlyTable[7][24] = {
+    {HALF_HOURLY}, {HALF_HOURLY}, {HALF_HOURLY}, {HALF_HOURLY},
+    {HALF_HOURLY}, {HALF_HOURLY}, {HALF_HOURLY}};
+static constexpr WeeklySchedule halfHourly = makeWeeklySchedule(halfHourlyTable);
+
+// Days until model runs the battery flat, waking on the schedule
+static double lifetime(const EnergyModel &model, int *wakes) {
+    EnergyLedger ledger = {};
+    uint32_t t = 0;
+    energySettle(ledger, model, start);
+    *wakes = 0;
+    while (ledger.usedUc < model.capacityMah * 3600000ULL) {
+        t += planWake(halfHourly, t, ledger.stretch).seconds;
+        addWake(ledger);
+        energySettle(ledger, model, start + t);
+        ++*wakes;
+    }
+    return t / 86400.0;
+}
+
+void test_battery_lasts_the_target() {
+    const EnergyModel untargeted = {{45, 130, 110, 50, 45, 20}, {20, 8, 0},
+                                     15, 1000, 0};
+    int scheduledWakes, targetedWakes;
+    double scheduled = lifetime(untargeted, &scheduledWakes);
+    double targeted = lifetime(model, &targetedWakes);
+    printf("  1000 mAh: %.1f days on the schedule (%d wakes), %.1f days for a "
+           "182 day target (%d wakes)\n",
+           scheduled, scheduledWakes, targeted, targetedWakes);
+    TEST_ASSERT_TRUE(scheduled < 120);
+    TEST_ASSERT_TRUE(targeted > 182 * 0.95 && targeted < 182 * 1.05);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_wake_and_sleep_are_booked);
+    RUN_TEST(test_wakes_without_time_are_booked_later);
+    RUN_TEST(test_lower_clocks_are_subtracted);
+    RUN_TEST(test_stretch_follows_the_target);
+    RUN_TEST(test_restart_after_a_charge);
+    RUN_TEST(test_restart_before_any_time_is_known);
+    RUN_TEST(test_battery_lasts_the_target);
+    return UNITY_END();
+}
@@ -0,0 +1,185 @@
+#include <unity.h>
+#include <string.h>
+#include "fbops.h"
+
+static const fb_impl_t impls[] = {FB_PORTABLE, FB_SSE2, FB_AVX2};
+
+static uint32_t rnd = 1;
+
+static uint8_t randomByte() {
+    rnd = rnd * 1664525u + 1013904223u;
+    return rnd >> 24;
+}
+
+// Mostly white bytes with some ink, like a plane
+static void fillRandom(uint8_t *data, size_t length) {
+    for (size_t i = 0; i < length; i++) {
+        data[i] = randomByte() < 200 ? 0xFF : randomByte();
+    }
+}
+
+void test_fill_bits_matches_bit_by_bit() {
+    for (fb_impl_t impl : impls) {
+        if (!fbUseImpl(impl)) {
+            continue;
+        }
+        for (int32_t from = 0; from < 40; from += 3) {
+            for (int32_t to = from; to < 400; to += 7) {
+                uint8_t row[52];
+                uint8_t expected[52];
+                fillRandom(row, sizeof(row));
+                memcpy(expected, row, sizeof(row));
+                bool set = (from + to) & 1;
+                for (int32_t x = from; x < to; x++) {
+                    if (set) {
+                        expected[x >> 3] |= 0x80 >> (x & 7);
+                    } else {
+                        expected[x >> 3] &= ~(0x80 >> (x & 7));
+                    }
+                }
+                fbFillBits(row, from, to, set);
+                TEST_ASSERT_EQUAL_MEMORY(expected, row, sizeof(row));
+            }
+        }
+    }
+    fbUseImpl(FB_PORTABLE);
+}
+
+void test_xor_diff_at_every_offset() {
+    uint8_t a[300], b[300], out[300];
+    fillRandom(a, sizeof(a));
+    memcpy(b, a, sizeof(b));
+    for (fb_impl_t impl : impls) {
+        if (!fbUseImpl(impl)) {
+            continue;
+        }
+        for (size_t offset = 0; offset < 8; offset++) {
+            for (size_t length = 0; length + offset < 300; length += 13) {
+                TEST_ASSERT_FALSE(fbXorDiff(out + offset, a + offset, b + offset, length));
+                // Pointers a word boundary apart from each other
+                TEST_ASSERT_EQUAL(memcmp(a + offset, b, length) != 0,
+                                  fbXorDiff(nullptr, a + offset, b, length));
+                if (!length) {
+                    continue;
+                }
+                // A single differing bit anywhere is found and kept
+                size_t at = (offset * 31 + length / 2) % length;
+                b[offset + at] ^= 0x10;
+                TEST_ASSERT_TRUE(fbXorDiff(out + 1, a + offset, b + offset, length));
+                TEST_ASSERT_TRUE(fbXorDiff(nullptr, a + offset, b + offset, length));
+                for (size_t i = 0; i < length; i++) {
+                    TEST_ASSERT_EQUAL_HEX8(i == at ? 0x10 : 0x00, out[1 + i]);
+                }
+                b[offset + at] ^= 0x10;
+            }
+        }
+    }
+    fbUseImpl(FB_PORTABLE);
+}
+
+void test_popcount_matches_bytes() {
+    uint8_t data[500];
+    fillRandom(data, sizeof(data));
+    for (fb_impl_t impl : impls) {
+        if (!fbUseImpl(impl)) {
+            continue;
+        }
+        for (size_t offset = 0; offset < 5; offset++) {
+            for (size_t length = 0; length + offset <= 500; length += 37) {
+                size_t expected = 0;
+                for (size_t i = 0; i < length; i++) {
+                    expected += __builtin_popcount(data[offset + i]);
+                }
+                TEST_ASSERT_EQUAL_size_t(expected, fbPopcount(data + offset, length));
+            }
+        }
+    }
+    fbUseImpl(FB_PORTABLE);
+}
+
+void test_find_run_of_ink() {
+    uint8_t data[200];
+    for (fb_impl_t impl : impls) {
+        if (!fbUseImpl(impl)) {
+            continue;
+        }
+        for (size_t start = 0; start < 200; start += 9) {
+            for (size_t end = start; end <= 200; end += 17) {
+                memset(data, 0xFF, sizeof(data));
+                for (size_t i = start; i < end; i++) {
+                    data[i] = i & 1 ? 0x00 : 0x7E;
+                }
+                if (end < 190) {
+                    data[end + 5] = 0x00;   // a second run is not part of it
+                }
+                FbRun run = fbFindRun(data, 200, 0xFF);
+                if (start == end) {
+                    TEST_ASSERT_EQUAL_size_t(end < 190 ? end + 5 : 200, run.start);
+                    continue;
+                }
+                TEST_ASSERT_EQUAL_size_t(start, run.start);
+                TEST_ASSERT_EQUAL_size_t(end, run.end);
+            }
+        }
+        memset(data, 0xFF, sizeof(data));
+        FbRun none = fbFindRun(data, 200, 0xFF);
+        TEST_ASSERT_EQUAL_size_t(200, none.start);
+        TEST_ASSERT_EQUAL_size_t(200, none.end);
+    }
+    fbUseImpl(FB_PORTABLE);
+}
+
+void test_hash_is_the_same_everywhere() {
+    uint8_t data[1000];
+    fillRandom(data, sizeof(data));
+    // Shorter than a block it is plain FNV-1a
+    TEST_ASSERT_EQUAL_HEX32(fnv1a(FNV_OFFSET_BASIS, data, 31),
+                            fbHash(FNV_OFFSET_BASIS, data, 31));
+    fbUseImpl(FB_PORTABLE);
+    uint32_t expected[40];
+    for (size_t i = 0; i < 40; i++) {
+        expected[i] = fbHash(FNV_OFFSET_BASIS, data + i % 4, i * 23);
+    }
+    for (fb_impl_t impl : impls) {
+        if (!fbUseImpl(impl)) {
+            continue;
+        }
+        for (size_t i = 0; i < 40; i++) {
+            TEST_ASSERT_EQUAL_HEX32(expected[i], fbHash(FNV_OFFSET_BASIS, data + i % 4, i * 23));
+        }
+    }
+    fbUseImpl(FB_PORTABLE);
+
+    // A changed bit in a lane or in the tail changes the hash
+    uint32_t before = fbHash(FNV_OFFSET_BASIS, data, 100);
+    data[5] ^= 1;
+    TEST_ASSERT_NOT_EQUAL(before, fbHash(FNV_OFFSET_BASIS, data, 100));
+    data[5] ^= 1;
+    data[99] ^= 1;
+    TEST_ASSERT_NOT_EQUAL(before, fbHash(FNV_OFFSET_BASIS, data, 100));
+}
+
+void test_hash_reference_value() {
+    // 32 zero bytes: every lane multiplies its seed once, then folds
+    uint8_t zeros[32] = {};
+    uint32_t hash = FNV_OFFSET_BASIS;
+    uint32_t lanes[8];
+    for (uint32_t j = 0; j < 8; j++) {
+        lanes[j] = (FNV_OFFSET_BASIS ^ j) * FNV_PRIME;
+    }
+    for (uint32_t j = 0; j < 8; j++) {
+        hash = (hash ^ lanes[j]) * FNV_PRIME;
+    }
+    TEST_ASSERT_EQUAL_HEX32(hash, fbHash(FNV_OFFSET_BASIS, zeros, 32));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_fill_bits_matches_bit_by_bit);
+    RUN_TEST(test_xor_diff_at_every_offset);
+    RUN_TEST(test_popcount_matches_bytes);
+    RUN_TEST(test_find_run_of_ink);
+    RUN_TEST(test_hash_is_the_same_everywhere);
+    RUN_TEST(test_hash_reference_value);
+    return UNITY_END();
+}
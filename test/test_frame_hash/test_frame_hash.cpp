@@ -0,0 +1,273 @@
+#include <unity.h>
+#include "frame_hash.h"
+#include "calendar_geometry.h"
+
+// Hashes a 64x32 frame in bands of bandHeight, with one optional pixel set
+static FrameHash hashFrame(int16_t bandHeight, int16_t x = -1, int16_t y = -1,
+                           ink_t ink = INK_BLACK) {
+    BandBuffer band;
+    band.allocate(64, bandHeight);
+    // Region from column 44 (rounded down to 40) in rows 24 ... 31
+    static const DisplayRect region = {44, 24, 64, 32};
+    FrameHash hash;
+    hash.begin(&region, 1);
+    for (int16_t top = 0; top < 32; top += bandHeight) {
+        band.setBand(top, 32 - top < bandHeight ? 32 - top : bandHeight);
+        band.fillSpan(0, 3, 64, INK_BLACK);
+        band.setPixel(x, y, ink);
+        hash.addBand(band);
+    }
+    return hash;
+}
+
+void test_hash_does_not_depend_on_bands() {
+    FrameHash whole = hashFrame(32);
+    TEST_ASSERT_EQUAL_HEX32(whole.value(), hashFrame(5).value());
+    TEST_ASSERT_EQUAL_HEX32(whole.regionValue(0), hashFrame(5).regionValue(0));
+    TEST_ASSERT_EQUAL_HEX32(whole.value(), hashFrame(1).value());
+}
+
+void test_any_pixel_outside_region_changes_hash() {
+    FrameHash blank = hashFrame(8);
+    const int16_t pixels[][2] = {{0, 0}, {63, 0}, {39, 31}, {63, 23}, {10, 24}};
+    for (const auto &p : pixels) {
+        FrameHash changed = hashFrame(8, p[0], p[1]);
+        TEST_ASSERT_NOT_EQUAL(blank.value(), changed.value());
+        TEST_ASSERT_EQUAL_HEX32(blank.regionValue(0), changed.regionValue(0));
+    }
+}
+
+void test_red_and_black_hash_differently() {
+    TEST_ASSERT_NOT_EQUAL(hashFrame(8, 5, 5, INK_BLACK).value(),
+                          hashFrame(8, 5, 5, INK_RED).value());
+}
+
+void test_region_changes_only_region_hash() {
+    FrameHash blank = hashFrame(8);
+    // The left edge of the region is rounded down to column 40
+    const int16_t pixels[][2] = {{40, 24}, {63, 31}, {50, 28}};
+    for (const auto &p : pixels) {
+        FrameHash changed = hashFrame(8, p[0], p[1]);
+        TEST_ASSERT_EQUAL_HEX32(blank.value(), changed.value());
+        TEST_ASSERT_NOT_EQUAL(blank.regionValue(0), changed.regionValue(0));
+    }
+}
+
+void test_fnv1a_reference_values() {
+    const uint8_t a[] = {'a'};
+    TEST_ASSERT_EQUAL_HEX32(0x811C9DC5, fnv1a(FNV_OFFSET_BASIS, a, 0));
+    TEST_ASSERT_EQUAL_HEX32(0xE40C292C, fnv1a(FNV_OFFSET_BASIS, a, 1));
+}
+
+// A 64x32 frame of four 32x16 cells below a status bar at the bottom right
+static const DisplayRect cells[] = {
+    {36, 28, 64, 32},       // status bar, rounded to 32 ... 63
+    {0, 0, 30, 16}, {30, 0, 64, 16}, {0, 16, 30, 32}, {30, 16, 64, 32}};
+
+static FrameHash hashCells(int16_t x = -1, int16_t y = -1) {
+    BandBuffer band;
+    band.allocate(64, 12);
+    FrameHash hash;
+    hash.begin(cells, 5);
+    for (int16_t top = 0; top < 32; top += 12) {
+        band.setBand(top, 32 - top < 12 ? 32 - top : 12);
+        band.setPixel(x, y, INK_RED);
+        hash.addBand(band);
+    }
+    return hash;
+}
+
+void test_overlapping_regions_go_to_the_first() {
+    FrameHash blank = hashCells();
+    // Columns 24 ... 31 are in the rounded first and second cell
+    struct { int16_t x, y; int region; } pixels[] = {
+        {29, 3, 1}, {31, 3, 1}, {32, 3, 2}, {40, 29, 0}, {40, 27, 4}, {20, 30, 3}};
+    for (const auto &p : pixels) {
+        FrameHash changed = hashCells(p.x, p.y);
+        for (int i = 0; i < 5; i++) {
+            if (i == p.region) {
+                TEST_ASSERT_NOT_EQUAL(blank.regionValue(i), changed.regionValue(i));
+            } else {
+                TEST_ASSERT_EQUAL_HEX32(blank.regionValue(i), changed.regionValue(i));
+            }
+        }
+        TEST_ASSERT_EQUAL_HEX32(blank.value(), changed.value());
+    }
+}
+
+static PanelState showing(const FrameHash &hash) {
+    PanelState state = {};
+    rememberRefresh(state, hash, REFRESH_FULL, 0);
+    return state;
+}
+
+void test_unchanged_frame_is_not_refreshed() {
+    PanelState state = showing(hashCells());
+    TEST_ASSERT_FALSE(fullRefreshAhead(state, 5));
+    TEST_ASSERT_TRUE(fullRefreshAhead(state, 4));
+    TEST_ASSERT_EQUAL(REFRESH_NONE, planRefresh(state, hashCells(), 0, 600, 5).kind);
+    PanelState unknown = {};
+    TEST_ASSERT_TRUE(fullRefreshAhead(unknown, 5));
+    TEST_ASSERT_EQUAL(REFRESH_FULL, planRefresh(unknown, hashCells(), 0, 600, 5).kind);
+}
+
+void test_changed_cells_are_one_partial_window() {
+    PanelState state = showing(hashCells());
+    RefreshPlan plan = planRefresh(state, hashCells(5, 20), 0, 600, 5);
+    TEST_ASSERT_EQUAL(REFRESH_PARTIAL, plan.kind);
+    TEST_ASSERT_EQUAL_INT16(0, plan.window.x0);
+    TEST_ASSERT_EQUAL_INT16(16, plan.window.y0);
+    TEST_ASSERT_EQUAL_INT16(32, plan.window.x1);
+    TEST_ASSERT_EQUAL_INT16(32, plan.window.y1);
+
+    // Two cells and the status bar span their bounding box
+    FrameHash frame;
+    BandBuffer band;
+    band.allocate(64, 32);
+    band.setBand(0, 32);
+    band.setPixel(40, 5, INK_RED);
+    band.setPixel(5, 20, INK_BLACK);
+    band.setPixel(60, 30, INK_BLACK);
+    frame.begin(cells, 5);
+    frame.addBand(band);
+    plan = planRefresh(state, frame, 0, 600, 5);
+    TEST_ASSERT_EQUAL(REFRESH_PARTIAL, plan.kind);
+    TEST_ASSERT_EQUAL_INT16(0, plan.window.x0);
+    TEST_ASSERT_EQUAL_INT16(0, plan.window.y0);
+    TEST_ASSERT_EQUAL_INT16(64, plan.window.x1);
+    TEST_ASSERT_EQUAL_INT16(32, plan.window.y1);
+}
+
+void test_status_bar_changes_wait_for_its_age() {
+    PanelState state = showing(hashCells());
+    FrameHash status = hashCells(40, 30);
+    for (uint32_t now = 0; now < 600; now += 150) {
+        TEST_ASSERT_EQUAL(REFRESH_NONE, planRefresh(state, status, now, 600, 5).kind);
+    }
+    RefreshPlan plan = planRefresh(state, status, 600, 600, 5);
+    TEST_ASSERT_EQUAL(REFRESH_PARTIAL, plan.kind);
+    TEST_ASSERT_EQUAL_INT16(32, plan.window.x0);
+    TEST_ASSERT_EQUAL_INT16(28, plan.window.y0);
+    rememberRefresh(state, status, plan.kind, 600);
+    TEST_ASSERT_EQUAL_UINT32(600, state.statusShownAt);
+    // The age counts from that refresh, and a clock gone back refreshes
+    FrameHash later = hashCells(50, 30);
+    TEST_ASSERT_EQUAL(REFRESH_NONE, planRefresh(state, later, 1199, 600, 5).kind);
+    TEST_ASSERT_EQUAL(REFRESH_PARTIAL, planRefresh(state, later, 1200, 600, 5).kind);
+    TEST_ASSERT_EQUAL(REFRESH_PARTIAL, planRefresh(state, later, 10, 600, 5).kind);
+}
+
+void test_full_refresh_after_partial_ones() {
+    PanelState state = showing(hashCells());
+    for (int i = 0; i < 3; i++) {
+        FrameHash frame = hashCells(5 + i, 5);
+        RefreshPlan plan = planRefresh(state, frame, 0, 600, 3);
+        TEST_ASSERT_EQUAL(REFRESH_PARTIAL, plan.kind);
+        rememberRefresh(state, frame, plan.kind, 0);
+    }
+    RefreshPlan plan = planRefresh(state, hashCells(), 0, 600, 3);
+    TEST_ASSERT_EQUAL(REFRESH_FULL, plan.kind);
+    rememberRefresh(state, hashCells(), plan.kind, 0);
+    TEST_ASSERT_EQUAL_UINT8(0, state.partialRefreshes);
+    // Panels without partial refresh
+    TEST_ASSERT_EQUAL(REFRESH_FULL, planRefresh(state, hashCells(5, 5), 0, 600, 0).kind);
+}
+
+void test_pixels_outside_regions_refresh_in_full() {
+    static const DisplayRect top = {0, 0, 64, 16};
+    BandBuffer band;
+    band.allocate(64, 32);
+    FrameHash before;
+    before.begin(&top, 1);
+    band.setBand(0, 32);
+    before.addBand(band);
+    PanelState state = showing(before);
+
+    FrameHash after;
+    after.begin(&top, 1);
+    band.setPixel(3, 20, INK_BLACK);
+    after.addBand(band);
+    TEST_ASSERT_EQUAL(REFRESH_FULL, planRefresh(state, after, 0, 600, 5).kind);
+}
+
+// The default calendar: two weeks of 114x230 cells below a 20 row header,
+// the status bar strip at the bottom right covering Fri to Sun of week 2
+typedef CalendarGeometry<2, 800, 480, 20> View;
+static const DisplayRect strip = {480, 456, 800, 480};
+static const DisplayRect statusBar = {560, 458, 798, 480};
+
+static FrameHash hashCalendar(DisplayRect *regions, int16_t x = -1,
+                              int16_t y = -1) {
+    BandBuffer band;
+    band.allocate(800, 480);
+    band.setBand(0, 480);
+    band.setPixel(x, y, INK_BLACK);
+    FrameHash hash;
+    hash.begin(regions, calendarRegions<View>(regions, statusBar, strip));
+    hash.addBand(band);
+    return hash;
+}
+
+void test_status_bar_shares_no_bytes_with_cells() {
+    TEST_ASSERT_EQUAL_INT(0, (stripRows<View>(strip, 0, 6)));
+    TEST_ASSERT_EQUAL_INT(0, (stripRows<View>(strip, 1, 3)));
+    TEST_ASSERT_EQUAL_INT(24, (stripRows<View>(strip, 1, 4)));
+    DisplayRect regions[FRAME_MAX_REGIONS];
+    FrameHash hash = hashCalendar(regions);
+    TEST_ASSERT_EQUAL_UINT8(2 + View::days, hash.regionCount());
+    DisplayRect bar = hash.region(0);
+    TEST_ASSERT_EQUAL_INT16(560, bar.x0);
+    TEST_ASSERT_EQUAL_INT16(458, bar.y0);
+    for (uint8_t i = 1; i < hash.regionCount(); i++) {
+        DisplayRect r = hash.region(i);
+        TEST_ASSERT_FALSE(r.x0 < bar.x1 && bar.x0 < r.x1 &&
+                          r.y0 < bar.y1 && bar.y0 < r.y1);
+    }
+    // Without a status bar the region is empty
+    DisplayRect none = {0, 0, 0, 0};
+    calendarRegions<View>(regions, none, strip);
+    TEST_ASSERT_EQUAL_INT16(0, regions[0].x1);
+}
+
+void test_cell_rows_beside_the_status_bar_are_refreshed() {
+    DisplayRect regions[FRAME_MAX_REGIONS];
+    PanelState state = showing(hashCalendar(regions));
+
+    // The bottom rows of a cell left of the strip: a partial refresh
+    RefreshPlan plan = planRefresh(state, hashCalendar(regions, 300, 470), 0, 600, 5);
+    TEST_ASSERT_EQUAL(REFRESH_PARTIAL, plan.kind);
+    TEST_ASSERT_EQUAL_INT16(224, plan.window.x0);
+    TEST_ASSERT_EQUAL_INT16(250, plan.window.y0);
+    TEST_ASSERT_EQUAL_INT16(480, plan.window.y1);
+
+    // A cell over the strip, just above it
+    plan = planRefresh(state, hashCalendar(regions, 600, 450), 0, 600, 5);
+    TEST_ASSERT_EQUAL(REFRESH_PARTIAL, plan.kind);
+    TEST_ASSERT_EQUAL_INT16(456, plan.window.y1);
+
+    // In the strip but not the status bar: refreshed, never skipped
+    TEST_ASSERT_EQUAL(REFRESH_FULL,
+                      planRefresh(state, hashCalendar(regions, 500, 470), 0, 600, 5).kind);
+
+    // Only the status bar itself is skipped
+    TEST_ASSERT_EQUAL(REFRESH_NONE,
+                      planRefresh(state, hashCalendar(regions, 600, 470), 0, 600, 5).kind);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hash_does_not_depend_on_bands);
+    RUN_TEST(test_any_pixel_outside_region_changes_hash);
+    RUN_TEST(test_red_and_black_hash_differently);
+    RUN_TEST(test_region_changes_only_region_hash);
+    RUN_TEST(test_fnv1a_reference_values);
+    RUN_TEST(test_overlapping_regions_go_to_the_first);
+    RUN_TEST(test_unchanged_frame_is_not_refreshed);
+    RUN_TEST(test_changed_cells_are_one_partial_window);
+    RUN_TEST(test_status_bar_changes_wait_for_its_age);
+    RUN_TEST(test_full_refresh_after_partial_ones);
+    RUN_TEST(test_pixels_outside_regions_refresh_in_full);
+    RUN_TEST(test_status_bar_shares_no_bytes_with_cells);
+    RUN_TEST(test_cell_rows_beside_the_status_bar_are_refreshed);
+    return UNITY_END();
+}
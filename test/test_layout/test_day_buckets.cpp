@@ -0,0 +1,196 @@
+#include <unity.h>
+#include <stdio.h>
+#include <vector>
+#include "calendar_layout.h"
+#include "calendar_geometry.h"
+
+static LayoutEvent single(int day, const char *time) {
+    return {(int16_t)day, (int16_t)day, parseStartMinute(time), false};
+}
+
+static LayoutEvent multi(int startDay, int endDay) {
+    return {(int16_t)startDay, (int16_t)endDay, 0, true};
+}
+
+void test_parse_start_minute() {
+    TEST_ASSERT_EQUAL_UINT16(1, parseStartMinute("00:00"));
+    TEST_ASSERT_EQUAL_UINT16(1 + 9 * 60 + 30, parseStartMinute("09:30"));
+    TEST_ASSERT_EQUAL_UINT16(1 + 23 * 60 + 59, parseStartMinute("23:59"));
+}
+
+void test_parse_start_minute_full_day_and_invalid() {
+    // Full-day events use "-" and must sort before 00:00
+    TEST_ASSERT_EQUAL_UINT16(0, parseStartMinute("-"));
+    TEST_ASSERT_EQUAL_UINT16(0, parseStartMinute(""));
+    TEST_ASSERT_EQUAL_UINT16(0, parseStartMinute("9:30"));
+    TEST_ASSERT_EQUAL_UINT16(0, parseStartMinute("25:00"));
+    TEST_ASSERT_EQUAL_UINT16(0, parseStartMinute(nullptr));
+}
+
+void test_single_day_events_sorted_per_day() {
+    std::vector<LayoutEvent> events = {
+        single(3, "14:45"),
+        single(1, "10:00"),
+        single(3, "09:30"),
+        single(3, "-"),
+        single(1, "08:15"),
+    };
+    CalendarLayout layout;
+    buildCalendarLayout(events, 14, layout);
+
+    TEST_ASSERT_EQUAL_INT(2, layout.singleDayCount(1));
+    TEST_ASSERT_EQUAL_UINT16(4, layout.singleDayEvents(1)[0]);
+    TEST_ASSERT_EQUAL_UINT16(1, layout.singleDayEvents(1)[1]);
+
+    TEST_ASSERT_EQUAL_INT(0, layout.singleDayCount(2));
+
+    TEST_ASSERT_EQUAL_INT(3, layout.singleDayCount(3));
+    TEST_ASSERT_EQUAL_UINT16(3, layout.singleDayEvents(3)[0]); // full day first
+    TEST_ASSERT_EQUAL_UINT16(2, layout.singleDayEvents(3)[1]);
+    TEST_ASSERT_EQUAL_UINT16(0, layout.singleDayEvents(3)[2]);
+}
+
+void test_equal_start_times_keep_input_order() {
+    std::vector<LayoutEvent> events = {
+        single(5, "14:45"),
+        single(5, "14:45"),
+        single(5, "14:45"),
+    };
+    CalendarLayout layout;
+    buildCalendarLayout(events, 14, layout);
+
+    TEST_ASSERT_EQUAL_INT(3, layout.singleDayCount(5));
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_UINT16(i, layout.singleDayEvents(5)[i]);
+    }
+}
+
+void test_more_than_thirty_events_in_one_day() {
+    // The old fixed array held 30 indices per day
+    std::vector<LayoutEvent> events;
+    for (int i = 0; i < 100; i++) {
+        char time[6];
+        snprintf(time, sizeof(time), "%02d:%02d", 23 - (i % 24), i % 60);
+        events.push_back(single(7, time));
+    }
+    CalendarLayout layout;
+    buildCalendarLayout(events, 14, layout);
+
+    TEST_ASSERT_EQUAL_INT(100, layout.singleDayCount(7));
+    const uint16_t *order = layout.singleDayEvents(7);
+    for (int i = 1; i < 100; i++) {
+        TEST_ASSERT_LESS_OR_EQUAL(events[order[i]].startMinute,
+                                  events[order[i - 1]].startMinute);
+    }
+}
+
+void test_multi_day_rows_first_fit() {
+    std::vector<LayoutEvent> events = {
+        multi(1, 3),   // row 0
+        multi(2, 5),   // overlaps event 0 -> row 1
+        multi(4, 6),   // row 0 is free again on day 4
+        multi(3, 4),   // rows 0 and 1 taken -> row 2
+    };
+    CalendarLayout layout;
+    buildCalendarLayout(events, 14, layout);
+
+    TEST_ASSERT_EQUAL_INT8(0, layout.multiDayRows[0]);
+    TEST_ASSERT_EQUAL_INT8(1, layout.multiDayRows[1]);
+    TEST_ASSERT_EQUAL_INT8(0, layout.multiDayRows[2]);
+    TEST_ASSERT_EQUAL_INT8(2, layout.multiDayRows[3]);
+}
+
+void test_multi_day_depth_per_day() {
+    std::vector<LayoutEvent> events = {
+        multi(1, 3),
+        multi(2, 5),
+        single(2, "10:00"),
+        multi(13, 20), // clipped to the visible days
+    };
+    CalendarLayout layout;
+    buildCalendarLayout(events, 14, layout);
+
+    TEST_ASSERT_EQUAL_UINT8(1, layout.multiDayDepth[1]);
+    TEST_ASSERT_EQUAL_UINT8(2, layout.multiDayDepth[2]);
+    TEST_ASSERT_EQUAL_UINT8(2, layout.multiDayDepth[3]);
+    // Row 1 is still occupied on day 4 although row 0 is free
+    TEST_ASSERT_EQUAL_UINT8(2, layout.multiDayDepth[4]);
+    TEST_ASSERT_EQUAL_UINT8(0, layout.multiDayDepth[6]);
+    TEST_ASSERT_EQUAL_UINT8(1, layout.multiDayDepth[14]);
+    TEST_ASSERT_EQUAL_INT8(-1, layout.multiDayRows[2]);
+}
+
+void test_events_outside_view_are_ignored() {
+    std::vector<LayoutEvent> events = {
+        single(0, "10:00"),
+        single(15, "10:00"),
+        multi(15, 16),
+    };
+    CalendarLayout layout;
+    buildCalendarLayout(events, 14, layout);
+
+    for (int day = 1; day <= 14; day++) {
+        TEST_ASSERT_EQUAL_INT(0, layout.singleDayCount(day));
+        TEST_ASSERT_EQUAL_UINT8(0, layout.multiDayDepth[day]);
+    }
+    TEST_ASSERT_EQUAL_INT8(-1, layout.multiDayRows[2]);
+}
+
+void test_geometry_two_weeks() {
+    typedef CalendarGeometry<2, 800, 480, 20> View;
+    static_assert(View::days == 14, "two weeks");
+    static_assert(View::dayWidth == 114, "800 / 7");
+    static_assert(View::rowHeight == 230, "(480 - 20) / 2");
+    TEST_ASSERT_EQUAL_INT(0, View::week(7));
+    TEST_ASSERT_EQUAL_INT(1, View::week(8));
+    TEST_ASSERT_EQUAL_INT(6, View::column(14));
+    TEST_ASSERT_EQUAL_INT(8, View::day(1, 0));
+    TEST_ASSERT_EQUAL_INT(250, View::cellY(1));
+    TEST_ASSERT_FALSE(View::contains(0));
+    TEST_ASSERT_TRUE(View::contains(14));
+    TEST_ASSERT_FALSE(View::contains(15));
+}
+
+void test_geometry_one_and_six_weeks() {
+    typedef CalendarGeometry<1, 800, 480, 20> Week;
+    typedef CalendarGeometry<6, 800, 480, 20> Month;
+    static_assert(Week::days == 7 && Week::rowHeight == 460, "one week");
+    static_assert(Month::days == 42 && Month::rowHeight == 76, "six weeks");
+    TEST_ASSERT_EQUAL_INT(5, Month::week(42));
+    TEST_ASSERT_EQUAL_INT(20 + 5 * 76, Month::cellY(Month::week(42)));
+    TEST_ASSERT_EQUAL_INT(42, Month::day(5, 6));
+}
+
+void test_six_week_layout() {
+    typedef CalendarGeometry<6, 800, 480, 20> Month;
+    std::vector<LayoutEvent> events = {
+        multi(30, 45),         // clipped to day 42
+        single(42, "08:00"),
+        single(43, "08:00"),   // outside a six week view
+    };
+    CalendarLayout layout;
+    buildCalendarLayout<Month>(events, layout);
+
+    TEST_ASSERT_EQUAL_INT8(0, layout.multiDayRows[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, layout.multiDayDepth[42]);
+    TEST_ASSERT_EQUAL_INT(1, layout.singleDayCount(42));
+    TEST_ASSERT_EQUAL_UINT16(1, layout.singleDayEvents(42)[0]);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_parse_start_minute);
+    RUN_TEST(test_parse_start_minute_full_day_and_invalid);
+    RUN_TEST(test_single_day_events_sorted_per_day);
+    RUN_TEST(test_equal_start_times_keep_input_order);
+    RUN_TEST(test_more_than_thirty_events_in_one_day);
+    RUN_TEST(test_multi_day_rows_first_fit);
+    RUN_TEST(test_multi_day_depth_per_day);
+    RUN_TEST(test_events_outside_view_are_ignored);
+    RUN_TEST(test_geometry_two_weeks);
+    RUN_TEST(test_geometry_one_and_six_weeks);
+    RUN_TEST(test_six_week_layout);
+
+    return UNITY_END();
+}
@@ -0,0 +1,109 @@
+#include <unity.h>
+#include <string.h>
+#include "packbits.h"
+
+static void roundTrip(const uint8_t *data, size_t length) {
+    uint8_t packed[1024];
+    uint8_t unpacked[512];
+    size_t size = packbitsEncode(data, length, packed);
+    TEST_ASSERT_EQUAL_size_t(size, packbitsEncode(data, length, nullptr));
+    memset(unpacked, 0x5A, sizeof(unpacked));
+    TEST_ASSERT_EQUAL_size_t(size, packbitsDecode(packed, unpacked, length));
+    TEST_ASSERT_EQUAL_MEMORY(data, unpacked, length);
+}
+
+void test_white_row_packs_to_one_packet() {
+    uint8_t row[100];
+    memset(row, 0xFF, sizeof(row));
+    uint8_t packed[4];
+    TEST_ASSERT_EQUAL_size_t(2, packbitsEncode(row, sizeof(row), packed));
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)-99, packed[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, packed[1]);
+    roundTrip(row, sizeof(row));
+}
+
+void test_long_runs_are_split() {
+    uint8_t row[300];
+    memset(row, 0x00, sizeof(row));
+    // 128 + 128 + 44
+    TEST_ASSERT_EQUAL_size_t(6, packbitsEncode(row, sizeof(row), nullptr));
+    roundTrip(row, sizeof(row));
+}
+
+void test_literals() {
+    uint8_t data[300];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 7 + 3);
+    }
+    // 128 + 128 + 44 literal bytes, one header each
+    TEST_ASSERT_EQUAL_size_t(303, packbitsEncode(data, sizeof(data), nullptr));
+    roundTrip(data, sizeof(data));
+}
+
+void test_mixed_runs_and_literals() {
+    const uint8_t data[] = {0xFF, 0xFF, 0xFF, 0x81, 0x7E, 0x7E, 0x3C,
+                            0x00, 0x00, 0x00, 0x00, 0xAA};
+    const uint8_t expected[] = {(uint8_t)-2, 0xFF, 3, 0x81, 0x7E, 0x7E, 0x3C,
+                                (uint8_t)-3, 0x00, 0, 0xAA};
+    uint8_t packed[32];
+    size_t size = packbitsEncode(data, sizeof(data), packed);
+    TEST_ASSERT_EQUAL_size_t(sizeof(expected), size);
+    TEST_ASSERT_EQUAL_MEMORY(expected, packed, sizeof(expected));
+    roundTrip(data, sizeof(data));
+}
+
+void test_single_byte_and_empty() {
+    const uint8_t one[] = {0x42};
+    roundTrip(one, 1);
+    TEST_ASSERT_EQUAL_size_t(0, packbitsEncode(one, 0, nullptr));
+}
+
+void test_decode_skips_noop_and_stops_at_length() {
+    const uint8_t packed[] = {0x80, (uint8_t)-3, 0x11, 0x80, 1, 0x22, 0x33};
+    uint8_t out[6];
+    TEST_ASSERT_EQUAL_size_t(7, packbitsDecode(packed, out, 6));
+    const uint8_t expected[] = {0x11, 0x11, 0x11, 0x11, 0x22, 0x33};
+    TEST_ASSERT_EQUAL_MEMORY(expected, out, 6);
+}
+
+void test_encode_is_constexpr() {
+    static constexpr uint8_t row[] = {1, 1, 1, 1, 2};
+    static_assert(packbitsEncode(row, sizeof(row), nullptr) == 4, "");
+    TEST_PASS();
+}
+
+void test_reader_splits_packets_across_pieces() {
+    uint8_t data[300];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = i < 140 ? 0xFF : (i < 200 ? (uint8_t)(i * 7) : 0x00);
+    }
+    uint8_t packed[400];
+    packed[0] = 0x80;   // no-op first
+    packbitsEncode(data, sizeof(data), packed + 1);
+
+    // Odd piece sizes so runs and literals end inside a piece
+    PackbitsReader reader(packed);
+    uint8_t unpacked[300];
+    size_t done = 0;
+    for (size_t piece = 1; done < sizeof(data); piece = piece * 3 % 37 + 1) {
+        size_t length = piece < sizeof(data) - done ? piece : sizeof(data) - done;
+        reader.read(unpacked + done, length);
+        done += length;
+    }
+    TEST_ASSERT_EQUAL_MEMORY(data, unpacked, sizeof(data));
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_white_row_packs_to_one_packet);
+    RUN_TEST(test_long_runs_are_split);
+    RUN_TEST(test_literals);
+    RUN_TEST(test_mixed_runs_and_literals);
+    RUN_TEST(test_single_byte_and_empty);
+    RUN_TEST(test_decode_skips_noop_and_stops_at_length);
+    RUN_TEST(test_encode_is_constexpr);
+    RUN_TEST(test_reader_splits_packets_across_pieces);
+
+    return UNITY_END();
+}
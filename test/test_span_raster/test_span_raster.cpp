@@ -0,0 +1,89 @@
+#include <unity.h>
+#include "span_raster.h"
+#include "../bench_common/gfx_reference.h"
+#include "../bench_common/band_pair.h"
+
+void test_corner_insets_small_radii() {
+    constexpr CornerTable table = makeCornerTable();
+    // Radius 3 as used for the event boxes
+    TEST_ASSERT_EQUAL_UINT8(2, table.of(3)[0]);
+    TEST_ASSERT_EQUAL_UINT8(1, table.of(3)[1]);
+    TEST_ASSERT_EQUAL_UINT8(0, table.of(3)[2]);
+    TEST_ASSERT_EQUAL_UINT8(1, table.of(1)[0]);
+    // Insets never grow towards the middle
+    for (int16_t r = 1; r <= SPAN_MAX_RADIUS; r++) {
+        for (int16_t row = 1; row < r; row++) {
+            TEST_ASSERT_LESS_OR_EQUAL(table.of(r)[row - 1], table.of(r)[row]);
+        }
+    }
+}
+
+void test_round_rects_match_gfx() {
+    GfxReference gfx(pixels);
+    for (int16_t r = 0; r <= SPAN_MAX_RADIUS; r++) {
+        for (int16_t h = 1; h < 40; h += 3) {
+            startBands(0, 60);
+            gfx.fillRoundRect(5 + r, 4, 3 * r + 7, h, r, INK_RED);
+            TEST_ASSERT_TRUE(fillRoundRectSpans(fast, 5 + r, 4, 3 * r + 7, h, r,
+                                                CORNERS_ALL, INK_RED));
+            assertSameBands();
+        }
+    }
+}
+
+void test_circles_match_gfx() {
+    GfxReference gfx(pixels);
+    for (int16_t r = 0; r <= SPAN_MAX_RADIUS; r++) {
+        startBands(0, 40);
+        gfx.fillCircle(20 + r, 18, r, INK_BLACK);
+        TEST_ASSERT_TRUE(fillCircleSpans(fast, 20 + r, 18, r, INK_BLACK));
+        assertSameBands();
+    }
+}
+
+void test_shapes_clipped_to_band() {
+    GfxReference gfx(pixels);
+    // A box crossing both band edges, drawn into three bands
+    for (int16_t top = 0; top < 60; top += 20) {
+        startBands(top, 20);
+        gfx.fillRoundRect(-4, 12, 120, 36, 5, INK_BLACK);
+        gfx.fillCircle(790, 30, 12, INK_RED);
+        fillRoundRectSpans(fast, -4, 12, 120, 36, 5, CORNERS_ALL, INK_BLACK);
+        fillCircleSpans(fast, 790, 30, 12, INK_RED);
+        assertSameBands();
+    }
+}
+
+void test_partly_rounded_rect() {
+    startBands(0, 20);
+    fillRoundRectSpans(fast, 0, 0, 40, 10, 3, CORNERS_LEFT, INK_BLACK);
+    // Left end rounded, right end square
+    TEST_ASSERT_EQUAL_HEX8(0xC0, fast.blackRow(0)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, fast.blackRow(0)[4]);
+    TEST_ASSERT_EQUAL_HEX8(0xC0, fast.blackRow(9)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x80, fast.blackRow(1)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, fast.blackRow(5)[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, fast.blackRow(10)[0]);
+}
+
+void test_radius_is_limited() {
+    startBands(0, 20);
+    TEST_ASSERT_FALSE(fillRoundRectSpans(fast, 0, 0, 60, 60, SPAN_MAX_RADIUS + 1,
+                                         CORNERS_ALL, INK_BLACK));
+    // Clamped to half the height first, as Adafruit_GFX does
+    TEST_ASSERT_TRUE(fillRoundRectSpans(fast, 0, 0, 200, 10, 40, CORNERS_ALL,
+                                        INK_BLACK));
+}
+
+int main(int argc, char **argv) {
+    fast.allocate(800, 60);
+    pixels.allocate(800, 60);
+    UNITY_BEGIN();
+    RUN_TEST(test_corner_insets_small_radii);
+    RUN_TEST(test_round_rects_match_gfx);
+    RUN_TEST(test_circles_match_gfx);
+    RUN_TEST(test_shapes_clipped_to_band);
+    RUN_TEST(test_partly_rounded_rect);
+    RUN_TEST(test_radius_is_limited);
+    return UNITY_END();
+}
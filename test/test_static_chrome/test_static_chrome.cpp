@@ -0,0 +1,141 @@
+#include <unity.h>
+#include <vector>
+#include "static_chrome.h"
+#include "text_layout.h"
+#include "DongleLight9pt15b.h"
+
+// Test font with a single 3x2 block glyph 'A'
+static constexpr uint8_t blockBitmap[] = {0xFC};
+static constexpr GFXglyph blockGlyphs[] = {
+    {0, 3, 2, 4, 0, -2},   // 'A'
+};
+static constexpr GlyphRange blockRanges[] = {{'A', 'A', 0}};
+static constexpr SparseFont blockFont = {blockBitmap, blockGlyphs, blockRanges, 1, 3};
+
+static constexpr ChromeSpec blockSpec = {
+    16, 6, &blockFont,
+    {"A", "AA"}, 2, CHROME_PLANE_BLACK,
+    8, 3,
+    {5}, 1, CHROME_PLANE_BLACK
+};
+
+struct Run {
+    int16_t x, y, w;
+    uint8_t plane;
+};
+
+static std::vector<Run> collectRuns(const ChromeImage &image, int16_t top, int16_t bottom) {
+    std::vector<Run> runs;
+    forEachChromeRun(image, top, bottom, [&](int16_t x, int16_t y, int16_t w, uint8_t plane) {
+        runs.push_back({x, y, w, plane});
+    });
+    return runs;
+}
+
+void test_only_rows_with_ink_are_stored() {
+    constexpr ChromeSize size = encodeChrome(blockSpec, nullptr, nullptr);
+    TEST_ASSERT_EQUAL_UINT16(3, size.rows);
+
+    static constexpr auto chrome = buildStaticChrome<size.rows, size.bytes>(blockSpec);
+    TEST_ASSERT_EQUAL_INT16(1, chrome.rows[0].y);
+    TEST_ASSERT_EQUAL_INT16(2, chrome.rows[1].y);
+    TEST_ASSERT_EQUAL_INT16(5, chrome.rows[2].y);
+}
+
+void test_labels_centred_in_cells() {
+    constexpr ChromeSize size = encodeChrome(blockSpec, nullptr, nullptr);
+    static constexpr auto chrome = buildStaticChrome<size.rows, size.bytes>(blockSpec);
+    std::vector<Run> runs = collectRuns(chrome.image(16), 1, 2);
+
+    // "A" is 3 wide in an 8 wide cell, "AA" is 4 + 3 wide
+    TEST_ASSERT_EQUAL_INT(3, runs.size());
+    TEST_ASSERT_EQUAL_INT16(2, runs[0].x);
+    TEST_ASSERT_EQUAL_INT16(3, runs[0].w);
+    TEST_ASSERT_EQUAL_INT16(8, runs[1].x);
+    TEST_ASSERT_EQUAL_INT16(3, runs[1].w);
+    TEST_ASSERT_EQUAL_INT16(12, runs[2].x);
+    TEST_ASSERT_EQUAL_INT16(3, runs[2].w);
+    TEST_ASSERT_EQUAL_UINT8(CHROME_PLANE_BLACK, runs[2].plane);
+}
+
+void test_lines_span_the_width() {
+    constexpr ChromeSize size = encodeChrome(blockSpec, nullptr, nullptr);
+    static constexpr auto chrome = buildStaticChrome<size.rows, size.bytes>(blockSpec);
+    std::vector<Run> runs = collectRuns(chrome.image(16), 3, 6);
+
+    TEST_ASSERT_EQUAL_INT(1, runs.size());
+    TEST_ASSERT_EQUAL_INT16(0, runs[0].x);
+    TEST_ASSERT_EQUAL_INT16(5, runs[0].y);
+    TEST_ASSERT_EQUAL_INT16(16, runs[0].w);
+}
+
+void test_band_outside_chrome_is_empty() {
+    constexpr ChromeSize size = encodeChrome(blockSpec, nullptr, nullptr);
+    static constexpr auto chrome = buildStaticChrome<size.rows, size.bytes>(blockSpec);
+    TEST_ASSERT_EQUAL_INT(0, collectRuns(chrome.image(16), 6, 100).size());
+    TEST_ASSERT_EQUAL_INT(0, collectRuns(chrome.image(16), 3, 5).size());
+}
+
+void test_red_labels() {
+    static constexpr ChromeSpec redSpec = {
+        16, 6, &blockFont,
+        {"A"}, 1, CHROME_PLANE_RED,
+        8, 3,
+        {5}, 1, CHROME_PLANE_BLACK
+    };
+    constexpr ChromeSize size = encodeChrome(redSpec, nullptr, nullptr);
+    static constexpr auto chrome = buildStaticChrome<size.rows, size.bytes>(redSpec);
+    std::vector<Run> runs = collectRuns(chrome.image(16), 0, 6);
+
+    TEST_ASSERT_EQUAL_INT(3, runs.size());
+    TEST_ASSERT_EQUAL_UINT8(CHROME_PLANE_RED, runs[0].plane);
+    TEST_ASSERT_EQUAL_UINT8(CHROME_PLANE_RED, runs[1].plane);
+    TEST_ASSERT_EQUAL_UINT8(CHROME_PLANE_BLACK, runs[2].plane);
+}
+
+void test_label_width_matches_text_layout() {
+    // The red current weekday label is drawn over the chrome one, both must
+    // be centred the same way
+    const char *labels[] = {"MONDAY", "WEDNESDAY", "SATURDAY", "A B", "JEUDI", "MAÎTRE"};
+    for (const char *label : labels) {
+        TEST_ASSERT_EQUAL_INT16(getTextWidth(label, FONT_LARGE), chromeTextWidth(Dongle_Light15pt, label));
+    }
+}
+
+void test_calendar_sized_chrome_compresses() {
+    static constexpr ChromeSpec spec = {
+        800, 251,
+        &Dongle_Light15pt,
+        {"MONDAY", "TUESDAY", "WEDNESDAY", "THURSDAY", "FRIDAY", "SATURDAY", "SUNDAY"},
+        7, CHROME_PLANE_BLACK,
+        800 / 7, 16,
+        {20, 250}, 2, CHROME_PLANE_BLACK
+    };
+    constexpr ChromeSize size = encodeChrome(spec, nullptr, nullptr);
+    static constexpr auto chrome = buildStaticChrome<size.rows, size.bytes>(spec);
+
+    // Only the text rows and the two lines are stored, a fraction of the
+    // 251 rows of 100 bytes the chrome covers
+    TEST_ASSERT_LESS_THAN(20, size.rows);
+    TEST_ASSERT_LESS_THAN(251 * 100 / 16, size.bytes);
+    std::vector<Run> runs = collectRuns(chrome.image(800), 0, 251);
+    TEST_ASSERT_GREATER_THAN(100, runs.size());
+    for (const Run &run : runs) {
+        TEST_ASSERT_TRUE(run.x >= 0 && run.x + run.w <= 800);
+        TEST_ASSERT_TRUE(run.y <= 20 || run.y == 250);
+    }
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_only_rows_with_ink_are_stored);
+    RUN_TEST(test_labels_centred_in_cells);
+    RUN_TEST(test_lines_span_the_width);
+    RUN_TEST(test_band_outside_chrome_is_empty);
+    RUN_TEST(test_red_labels);
+    RUN_TEST(test_label_width_matches_text_layout);
+    RUN_TEST(test_calendar_sized_chrome_compresses);
+
+    return UNITY_END();
+}
@@ -0,0 +1,206 @@
+#include <unity.h>
+#include <string.h>
+#include "text_layout.h"
+
+// Line text as a C string for comparisons
+static const char *lineText(const char *text, const TextLine &line) {
+    static char buffer[128];
+    memcpy(buffer, text + line.start, line.length);
+    buffer[line.length] = '\0';
+    return buffer;
+}
+
+void test_width_of_empty_string() {
+    TEST_ASSERT_EQUAL_INT16(0, getTextWidth("", FONT_LARGE));
+}
+
+void test_width_is_additive_in_advances() {
+    // "ll": first glyph advances, the second contributes its ink
+    int16_t one = getTextWidth("l", FONT_LARGE);
+    int16_t two = getTextWidth("ll", FONT_LARGE);
+    TEST_ASSERT_GREATER_THAN(one, two);
+    TEST_ASSERT_EQUAL_INT16(getTextWidth("MONDAY", FONT_LARGE),
+                            getTextWidth("MONDAY TUESDAY", 6, FONT_LARGE));
+}
+
+void test_small_font_is_narrower() {
+    TEST_ASSERT_LESS_THAN(getTextWidth("WEDNESDAY", FONT_LARGE),
+                          getTextWidth("WEDNESDAY", FONT_SMALL));
+}
+
+void test_trailing_space_adds_no_ink() {
+    TEST_ASSERT_EQUAL_INT16(getTextWidth("abc", FONT_LARGE),
+                            getTextWidth("abc ", FONT_LARGE));
+}
+
+void test_short_text_is_one_line() {
+    TextLine lines[2];
+    uint16_t count = wrapText("Swim", FONT_LARGE, 108, 2, lines);
+    TEST_ASSERT_EQUAL_UINT16(1, count);
+    TEST_ASSERT_FALSE(lines[0].ellipsis);
+    TEST_ASSERT_EQUAL_STRING("Swim", lineText("Swim", lines[0]));
+}
+
+void test_wraps_at_word_boundary() {
+    const char *text = "School parent meeting";
+    int16_t maxWidth = getTextWidth("School parent", FONT_LARGE);
+    TextLine lines[2];
+    uint16_t count = wrapText(text, FONT_LARGE, maxWidth, 2, lines);
+    TEST_ASSERT_EQUAL_UINT16(2, count);
+    TEST_ASSERT_EQUAL_STRING("School parent", lineText(text, lines[0]));
+    TEST_ASSERT_EQUAL_STRING("meeting", lineText(text, lines[1]));
+    TEST_ASSERT_FALSE(lines[1].ellipsis);
+}
+
+void test_wraps_after_hyphen() {
+    const char *text = "Well-being";
+    int16_t maxWidth = getTextWidth(text, FONT_LARGE) - 1;
+    TextLine lines[2];
+    uint16_t count = wrapText(text, FONT_LARGE, maxWidth, 2, lines);
+    TEST_ASSERT_EQUAL_UINT16(2, count);
+    TEST_ASSERT_EQUAL_STRING("Well-", lineText(text, lines[0]));
+    TEST_ASSERT_EQUAL_STRING("being", lineText(text, lines[1]));
+}
+
+void test_last_line_gets_ellipsis() {
+    const char *text = "Reception Parents Reading and Phonics Meeting";
+    const int16_t maxWidth = 102;
+    TextLine lines[2];
+    uint16_t count = wrapText(text, FONT_LARGE, maxWidth, 2, lines);
+    TEST_ASSERT_EQUAL_UINT16(2, count);
+    TEST_ASSERT_FALSE(lines[0].ellipsis);
+    TEST_ASSERT_TRUE(lines[1].ellipsis);
+    for (int i = 0; i < 2; i++) {
+        int16_t width = getTextWidth(text + lines[i].start, lines[i].length, FONT_LARGE);
+        if (lines[i].ellipsis) {
+            width += getEllipsisWidth(FONT_LARGE);
+        }
+        TEST_ASSERT_LESS_OR_EQUAL(maxWidth, width);
+    }
+}
+
+void test_single_line_mode_truncates() {
+    const char *text = "Parent association meeting";
+    TextLine lines[1];
+    uint16_t count = wrapText(text, FONT_LARGE, 102, 1, lines);
+    TEST_ASSERT_EQUAL_UINT16(1, count);
+    TEST_ASSERT_TRUE(lines[0].ellipsis);
+    TEST_ASSERT_EQUAL_UINT16(0, lines[0].start);
+    TEST_ASSERT_GREATER_THAN(0, lines[0].length);
+}
+
+void test_long_word_is_broken_between_characters() {
+    const char *text = "Donaudampfschifffahrtsgesellschaft";
+    const int16_t maxWidth = 60;
+    TextLine lines[3];
+    uint16_t count = wrapText(text, FONT_LARGE, maxWidth, 3, lines);
+    TEST_ASSERT_EQUAL_UINT16(3, count);
+    TEST_ASSERT_FALSE(lines[0].ellipsis);
+    TEST_ASSERT_LESS_OR_EQUAL(maxWidth, getTextWidth(text, lines[0].length, FONT_LARGE));
+    TEST_ASSERT_EQUAL_UINT16(lines[0].length, lines[1].start);
+}
+
+void test_ascii_glyphs_found_without_search() {
+    const SparseFont &font = getFont(FONT_LARGE);
+    TEST_ASSERT_EQUAL_PTR(&font.glyphs[0], findGlyph(font, ' '));
+    TEST_ASSERT_EQUAL_PTR(&font.glyphs['A' - ' '], findGlyph(font, 'A'));
+    TEST_ASSERT_NULL(findGlyph(font, 0x7F));
+}
+
+void test_sparse_ranges_binary_search() {
+    const SparseFont &font = getFont(FONT_LARGE);
+    // Every glyph of every range is found, codes between ranges are not
+    for (uint16_t r = 0; r < font.rangeCount; r++) {
+        const GlyphRange &range = font.ranges[r];
+        for (uint32_t cp = range.first; cp <= range.last; cp++) {
+            TEST_ASSERT_EQUAL_PTR(&font.glyphs[range.glyph + cp - range.first], findGlyph(font, cp));
+        }
+        if (r > 0 && font.ranges[r - 1].last + 1 < range.first) {
+            TEST_ASSERT_NULL(findGlyph(font, range.first - 1));
+        }
+    }
+    TEST_ASSERT_NOT_NULL(findGlyph(font, 0x00E4));  // ä
+    TEST_ASSERT_NOT_NULL(findGlyph(font, 0x00E9));  // é
+    TEST_ASSERT_NULL(findGlyph(font, 0x4E2D));
+}
+
+void test_decode_utf8() {
+    const char *text = "a\xC3\xA4\xE2\x80\x93\xF0\x9F\x98\x80";
+    size_t length = strlen(text);
+    size_t i = 0;
+    TEST_ASSERT_EQUAL_UINT32('a', decodeUtf8(text, length, i));
+    TEST_ASSERT_EQUAL_UINT32(0x00E4, decodeUtf8(text, length, i));
+    TEST_ASSERT_EQUAL_UINT32(0x2013, decodeUtf8(text, length, i));
+    TEST_ASSERT_EQUAL_UINT32(0x1F600, decodeUtf8(text, length, i));
+    TEST_ASSERT_EQUAL_size_t(length, i);
+}
+
+void test_decode_malformed_utf8() {
+    // Stray continuation byte and a sequence cut short by the end
+    const char *text = "\x80x\xC3";
+    size_t i = 0;
+    TEST_ASSERT_EQUAL_UINT32(UTF8_REPLACEMENT, decodeUtf8(text, 3, i));
+    TEST_ASSERT_EQUAL_UINT32('x', decodeUtf8(text, 3, i));
+    TEST_ASSERT_EQUAL_UINT32(UTF8_REPLACEMENT, decodeUtf8(text, 3, i));
+    TEST_ASSERT_EQUAL_size_t(3, i);
+}
+
+void test_umlaut_width_matches_base_letter() {
+    // Composed letters keep the advance of their base letter
+    TEST_ASSERT_EQUAL_INT16(getTextWidth("Muller", FONT_LARGE),
+                            getTextWidth("M\xC3\xBCller", FONT_LARGE));
+    TEST_ASSERT_EQUAL_INT16(getTextWidth("Fete", FONT_SMALL),
+                            getTextWidth("F\xC3\xAAte", FONT_SMALL));
+}
+
+void test_missing_glyphs_fall_back() {
+    // sharp s is drawn as "ss", an en dash as "-"
+    TEST_ASSERT_EQUAL_INT16(getTextWidth("Strasse", FONT_LARGE),
+                            getTextWidth("Stra\xC3\x9F" "e", FONT_LARGE));
+    TEST_ASSERT_EQUAL_INT16(getTextWidth("9-10", FONT_LARGE),
+                            getTextWidth("9\xE2\x80\x93" "10", FONT_LARGE));
+}
+
+void test_wrap_keeps_utf8_sequences_whole() {
+    const char *text = "\xC3\x84\xC3\x96\xC3\x9C\xC3\xA4\xC3\xB6\xC3\xBC\xC3\xA9\xC3\xA8\xC3\xA0\xC3\xA7";
+    TextLine lines[4];
+    uint16_t count = wrapText(text, FONT_LARGE, 30, 4, lines);
+    TEST_ASSERT_GREATER_THAN(1, count);
+    for (uint16_t i = 0; i < count; i++) {
+        // Lines start on lead bytes and hold whole two byte sequences
+        TEST_ASSERT_NOT_EQUAL(0x80, (uint8_t)text[lines[i].start] & 0xC0);
+        TEST_ASSERT_EQUAL_INT(0, lines[i].length % 2);
+    }
+}
+
+void test_text_box() {
+    DisplayRect box = getTextBox(10, 100, 50, FONT_LARGE);
+    TEST_ASSERT_EQUAL_INT16(60, box.x1);
+    TEST_ASSERT_LESS_THAN(100, box.y0);
+    TEST_ASSERT_GREATER_THAN(100, box.y1);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+
+    RUN_TEST(test_width_of_empty_string);
+    RUN_TEST(test_width_is_additive_in_advances);
+    RUN_TEST(test_small_font_is_narrower);
+    RUN_TEST(test_trailing_space_adds_no_ink);
+    RUN_TEST(test_short_text_is_one_line);
+    RUN_TEST(test_wraps_at_word_boundary);
+    RUN_TEST(test_wraps_after_hyphen);
+    RUN_TEST(test_last_line_gets_ellipsis);
+    RUN_TEST(test_single_line_mode_truncates);
+    RUN_TEST(test_long_word_is_broken_between_characters);
+    RUN_TEST(test_ascii_glyphs_found_without_search);
+    RUN_TEST(test_sparse_ranges_binary_search);
+    RUN_TEST(test_decode_utf8);
+    RUN_TEST(test_decode_malformed_utf8);
+    RUN_TEST(test_umlaut_width_matches_base_letter);
+    RUN_TEST(test_missing_glyphs_fall_back);
+    RUN_TEST(test_wrap_keeps_utf8_sequences_whole);
+    RUN_TEST(test_text_box);
+
+    return UNITY_END();
+}
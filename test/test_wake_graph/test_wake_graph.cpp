@@ -0,0 +1,163 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include "wake_graph.h"
+
+// What the tasks ran, in order
+static char ran[64];
+
+static bool succeed(void *arg) {
+    strcat(ran, (const char *)arg);
+    return true;
+}
+
+static bool fail(void *arg) {
+    strcat(ran, (const char *)arg);
+    return false;
+}
+
+// The wake of main.cpp up to the refresh, which runs after the graph: WiFi
+// and the panel only need the battery, the sag is read once both are up
+struct Wake {
+    WakeGraph graph;
+    int battery, wifi, display, sag, fetch, layout;
+};
+
+static void buildWake(Wake &wake, graph_fn_t wifi,
+                      graph_fn_t battery = succeed) {
+    wake.graph = {};
+    ran[0] = 0;
+    wake.battery = graphAdd(wake.graph, "battery", battery, (void *)"B");
+    wake.wifi = graphAdd(wake.graph, "wifi", wifi, (void *)"W",
+                         GRAPH_BIT(wake.battery));
+    wake.display = graphAdd(wake.graph, "display", succeed, (void *)"D",
+                            GRAPH_BIT(wake.battery));
+    wake.sag = graphAdd(wake.graph, "battery sag", succeed, (void *)"S",
+                        GRAPH_BIT(wake.wifi) | GRAPH_BIT(wake.display));
+    wake.fetch = graphAdd(wake.graph, "fetch", succeed, (void *)"F",
+                          GRAPH_BIT(wake.sag));
+    wake.layout = graphAdd(wake.graph, "layout", succeed, (void *)"L",
+                           GRAPH_BIT(wake.fetch));
+}
+
+void test_tasks_run_after_their_dependencies() {
+    Wake wake;
+    buildWake(wake, succeed);
+    graphRun(wake.graph);
+    TEST_ASSERT_EQUAL_STRING("BWDSFL", ran);
+    TEST_ASSERT_TRUE(graphFinished(wake.graph));
+    TEST_ASSERT_TRUE(graphSucceeded(wake.graph, wake.layout));
+}
+
+void test_failure_skips_what_runs_after_it() {
+    Wake wake;
+    buildWake(wake, fail);
+    graphRun(wake.graph);
+    // The panel is still initialized, for the error screen
+    TEST_ASSERT_EQUAL_STRING("BWD", ran);
+    TEST_ASSERT_TRUE(graphFinished(wake.graph));
+    TEST_ASSERT_EQUAL_UINT8(TASK_FAILED, wake.graph.tasks[wake.wifi].state);
+    TEST_ASSERT_EQUAL_UINT8(TASK_SKIPPED, wake.graph.tasks[wake.fetch].state);
+    TEST_ASSERT_EQUAL_UINT8(TASK_SKIPPED, wake.graph.tasks[wake.layout].state);
+    TEST_ASSERT_TRUE(graphSucceeded(wake.graph, wake.display));
+}
+
+void test_low_battery_leaves_the_panel_alone() {
+    Wake wake;
+    buildWake(wake, succeed, fail);
+    graphRun(wake.graph);
+    TEST_ASSERT_EQUAL_STRING("B", ran);
+    TEST_ASSERT_TRUE(graphFinished(wake.graph));
+    TEST_ASSERT_EQUAL_UINT8(TASK_SKIPPED, wake.graph.tasks[wake.display].state);
+    TEST_ASSERT_EQUAL_UINT8(TASK_SKIPPED, wake.graph.tasks[wake.wifi].state);
+}
+
+void test_independent_tasks_run_together() {
+    Wake wake;
+    buildWake(wake, succeed);
+    // Two workers: one takes the battery, the other waits for it
+    TEST_ASSERT_EQUAL_INT(wake.battery, graphNext(wake.graph));
+    TEST_ASSERT_EQUAL_INT(-1, graphNext(wake.graph));
+    graphFinish(wake.graph, wake.battery, true);
+    // WiFi associates while the panel resets
+    TEST_ASSERT_EQUAL_INT(wake.wifi, graphNext(wake.graph));
+    TEST_ASSERT_EQUAL_INT(wake.display, graphNext(wake.graph));
+    TEST_ASSERT_EQUAL_INT(-1, graphNext(wake.graph));
+    // The sag waits for both
+    graphFinish(wake.graph, wake.wifi, true);
+    TEST_ASSERT_EQUAL_INT(-1, graphNext(wake.graph));
+    graphFinish(wake.graph, wake.display, true);
+    TEST_ASSERT_EQUAL_INT(wake.sag, graphNext(wake.graph));
+    TEST_ASSERT_FALSE(graphFinished(wake.graph));
+}
+
+void test_graph_rejects_bad_tasks() {
+    WakeGraph graph = {};
+    TEST_ASSERT_EQUAL_INT(-1, graphAdd(graph, "ahead", succeed, nullptr,
+                                       GRAPH_BIT(0)));
+    for (int i = 0; i < GRAPH_MAX_TASKS; i++) {
+        TEST_ASSERT_EQUAL_INT(i, graphAdd(graph, "task", succeed, (void *)"",
+                                          i ? GRAPH_BIT(i - 1) : 0));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, graphAdd(graph, "full", succeed, nullptr));
+    ran[0] = 0;
+    graphRun(graph);
+    TEST_ASSERT_TRUE(graphFinished(graph));
+    TEST_ASSERT_TRUE(graphSucceeded(graph, GRAPH_MAX_TASKS - 1));
+    TEST_ASSERT_FALSE(graphSucceeded(graph, GRAPH_MAX_TASKS));
+}
+
+// Milliseconds the wake takes with workers taking tasks as graphRunTasks()
+// does, each task taking ms[task]
+static uint32_t simulate(Wake &wake, const uint32_t *ms, int workers) {
+    uint32_t now = 0;
+    int running[4];
+    uint32_t ends[4];
+    int busy = 0;
+    while (!graphFinished(wake.graph)) {
+        int task;
+        while (busy < workers && (task = graphNext(wake.graph)) >= 0) {
+            running[busy] = task;
+            ends[busy++] = now + ms[task];
+        }
+        if (!busy) {
+            break;
+        }
+        int first = 0;
+        for (int i = 1; i < busy; i++) {
+            if (ends[i] < ends[first]) {
+                first = i;
+            }
+        }
+        now = ends[first];
+        graphFinish(wake.graph, running[first], true);
+        running[first] = running[--busy];
+        ends[first] = ends[busy];
+    }
+    return now;
+}
+
+void test_display_reset_overlaps_wifi() {
+    // Battery, WiFi, display, sag, fetch, layout
+    const uint32_t ms[] = {20, 2500, 400, 30, 900, 150};
+    Wake wake;
+    buildWake(wake, succeed);
+    uint32_t serial = simulate(wake, ms, 1);
+    buildWake(wake, succeed);
+    uint32_t overlapped = simulate(wake, ms, 2);
+    printf("  wake: %u ms one after the other, %u ms on two workers\n",
+           serial, overlapped);
+    TEST_ASSERT_EQUAL_UINT32(4000, serial);
+    TEST_ASSERT_EQUAL_UINT32(serial - ms[wake.display], overlapped);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_tasks_run_after_their_dependencies);
+    RUN_TEST(test_failure_skips_what_runs_after_it);
+    RUN_TEST(test_low_battery_leaves_the_panel_alone);
+    RUN_TEST(test_independent_tasks_run_together);
+    RUN_TEST(test_graph_rejects_bad_tasks);
+    RUN_TEST(test_display_reset_overlaps_wifi);
+    return UNITY_END();
+}
@@ -0,0 +1,142 @@
+#include <unity.h>
+#include <stdio.h>
+#include "wake_schedule.h"
+
+enum { SUNDAY, MONDAY, TUESDAY, WEDNESDAY, THURSDAY, FRIDAY, SATURDAY };
+
+static uint32_t at(uint32_t day, uint32_t hour, uint32_t minute,
+                   uint32_t second = 0) {
+    return day * SECONDS_PER_DAY + hour * 3600 + minute * 60 + second;
+}
+
+// The default from config.h.template: every 4 hours from 6 to midnight
+#define DAILY 0, 0, 0, 0, 0, 0, 240, 240, 240, 240, 240, 240, \
+            240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240
+static constexpr uint16_t dailyTable[7][24] = {
+    {DAILY}, {DAILY}, {DAILY}, {DAILY}, {DAILY}, {DAILY}, {DAILY}};
+static constexpr WeeklySchedule daily = makeWeeklySchedule(dailyTable);
+
+// Every 15 minutes on weekday mornings, hourly in the afternoon, off at
+// night and on weekends
+#define OFF 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, \
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+#define WORK 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15, \
+            60, 60, 60, 60, 60, 60, 0, 0, 0, 0, 0, 0
+static constexpr uint16_t officeTable[7][24] = {
+    {OFF}, {WORK}, {WORK}, {WORK}, {WORK}, {WORK}, {OFF}};
+static constexpr WeeklySchedule office = makeWeeklySchedule(officeTable);
+
+// The old fixed 30 minute interval from 6 to midnight
+#define HALF_HOURLY 0, 0, 0, 0, 0, 0, 30, 30, 30, 30, 30, 30, \
+            30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30
+static constexpr uint16_t halfHourlyTable[7][24] = {
+    {HALF_HOURLY}, {HALF_HOURLY}, {HALF_HOURLY}, {HALF_HOURLY},
+    {HALF_HOURLY}, {HALF_HOURLY}, {HALF_HOURLY}};
+static constexpr WeeklySchedule halfHourly = makeWeeklySchedule(halfHourlyTable);
+
+void test_runs_are_built_at_compile_time() {
+    static_assert(office.minutes[24 + 6] == 15, "Monday 06:00");
+    static_assert(office.runStart[24 + 11] == 5, "Monday 11:00");
+    static_assert(office.runLeft[24 + 11] == 1, "Monday 11:00");
+    // Friday 18:00 to the end of Saturday
+    static_assert(office.runLeft[5 * 24 + 18] == 30, "Friday 18:00");
+    static_assert(office.runStart[0] == 0 && office.runLeft[0] == 30, "Sunday");
+    TEST_PASS();
+}
+
+void test_refresh_aligns_to_its_run() {
+    WakePlan plan = planWake(daily, at(TUESDAY, 7, 12, 30));
+    TEST_ASSERT_EQUAL(WAKE_REFRESH, plan.reason);
+    TEST_ASSERT_EQUAL_UINT32(at(0, 10, 0) - at(0, 7, 12, 30), plan.seconds);
+
+    // Woken a little early, the refresh right ahead is skipped
+    plan = planWake(daily, at(TUESDAY, 9, 49));
+    TEST_ASSERT_EQUAL_UINT32(at(0, 14, 0) - at(0, 9, 49), plan.seconds);
+    plan = planWake(daily, at(TUESDAY, 9, 48));
+    TEST_ASSERT_EQUAL_UINT32(at(0, 10, 0) - at(0, 9, 48), plan.seconds);
+
+    // A new interval starts with a refresh
+    plan = planWake(office, at(MONDAY, 11, 50));
+    TEST_ASSERT_EQUAL(WAKE_REFRESH, plan.reason);
+    TEST_ASSERT_EQUAL_UINT32(at(0, 12, 0) - at(0, 11, 50), plan.seconds);
+    plan = planWake(office, at(MONDAY, 12, 0, 20));
+    TEST_ASSERT_EQUAL_UINT32(at(0, 13, 0) - at(0, 12, 0, 20), plan.seconds);
+}
+
+void test_hours_without_refreshes_are_slept_through() {
+    // Midnight is off, the new day shows at 06:00
+    WakePlan plan = planWake(daily, at(TUESDAY, 22, 0, 5));
+    TEST_ASSERT_EQUAL(WAKE_RESUME, plan.reason);
+    TEST_ASSERT_EQUAL_UINT32(at(1, 6, 0) - at(0, 22, 0, 5), plan.seconds);
+
+    // Awake in an hour that is off, e.g. after a reset
+    plan = planWake(daily, at(TUESDAY, 3, 17));
+    TEST_ASSERT_EQUAL(WAKE_RESUME, plan.reason);
+    TEST_ASSERT_EQUAL_UINT32(at(0, 6, 0) - at(0, 3, 17), plan.seconds);
+
+    // Friday afternoon to Monday morning, across the end of the week
+    plan = planWake(office, at(FRIDAY, 17, 0));
+    TEST_ASSERT_EQUAL(WAKE_RESUME, plan.reason);
+    TEST_ASSERT_EQUAL_UINT32(at(MONDAY + 7, 6, 0) - at(FRIDAY, 17, 0), plan.seconds);
+    plan = planWake(office, at(SATURDAY, 23, 59, 59));
+    TEST_ASSERT_EQUAL_UINT32(at(MONDAY + 7, 6, 0) - at(SATURDAY, 23, 59, 59),
+                             plan.seconds);
+}
+
+// Friday night refreshes go on until Saturday 02:00
+#define LATE 240, 240, 0, 0, 0, 0, 240, 240, 240, 240, 240, 240, \
+            240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240
+static constexpr uint16_t lateTable[7][24] = {
+    {DAILY}, {DAILY}, {DAILY}, {DAILY}, {DAILY}, {DAILY}, {LATE}};
+static constexpr WeeklySchedule late = makeWeeklySchedule(lateTable);
+
+void test_midnight_in_refresh_hours() {
+    WakePlan plan = planWake(late, at(FRIDAY, 22, 0, 10));
+    TEST_ASSERT_EQUAL(WAKE_ROLLOVER, plan.reason);
+    TEST_ASSERT_EQUAL_UINT32(at(SATURDAY, 0, 0) - at(FRIDAY, 22, 0, 10), plan.seconds);
+    // The refresh at 02:00 would be in the hours that are off
+    plan = planWake(late, at(SATURDAY, 0, 0, 3));
+    TEST_ASSERT_EQUAL(WAKE_RESUME, plan.reason);
+    TEST_ASSERT_EQUAL_UINT32(at(0, 6, 0) - at(0, 0, 0, 3), plan.seconds);
+    // Other nights midnight is off
+    plan = planWake(late, at(THURSDAY, 22, 0, 10));
+    TEST_ASSERT_EQUAL(WAKE_RESUME, plan.reason);
+}
+
+// Wakes in days days from start when every wake happens on time
+static int countWakes(const WeeklySchedule &schedule, uint32_t start, int days) {
+    uint32_t now = start;
+    const uint32_t end = start + days * SECONDS_PER_DAY;
+    int wakes = 0;
+    while (true) {
+        now += planWake(schedule, now).seconds;
+        if (now > end) {
+            return wakes;
+        }
+        wakes++;
+    }
+}
+
+void test_wakes_in_a_month() {
+    // October 2026 begins on a Thursday and has 22 weekdays
+    const uint32_t october = at(THURSDAY, 0, 0);
+    int halfHourlyWakes = countWakes(halfHourly, october, 31);
+    int dailyWakes = countWakes(daily, october, 31);
+    int officeWakes = countWakes(office, october, 31);
+    printf("  wakes in a month: every 30 min %d, every 4 h %d, office %d\n",
+           halfHourlyWakes, dailyWakes, officeWakes);
+    TEST_ASSERT_EQUAL(36 * 31, halfHourlyWakes);
+    TEST_ASSERT_EQUAL(5 * 31, dailyWakes);
+    // 06:00 to 11:45, 12:00 to 17:00 on each weekday
+    TEST_ASSERT_EQUAL((24 + 6) * 22, officeWakes);
+}
+
+int main(int argc, char **argv) {
+    UNITY_BEGIN();
+    RUN_TEST(test_runs_are_built_at_compile_time);
+    RUN_TEST(test_refresh_aligns_to_its_run);
+    RUN_TEST(test_hours_without_refreshes_are_slept_through);
+    RUN_TEST(test_midnight_in_refresh_hours);
+    RUN_TEST(test_wakes_in_a_month);
+    return UNITY_END();
+}
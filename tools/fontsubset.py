@@ -0,0 +1,268 @@
+#!/usr/bin/env python3
+"""Subsets an Adafruit GFX font header into a sparse font (see src/sparse_font.h).
+
+The input is a header as written by Adafruit's fontconvert, or one written by
+this script. Printable ASCII is always kept so that it stays the first range
+and is looked up without searching. Other characters are only included when
+they are asked for, either directly with --chars or by passing text files
+(locale strings, exported calendar titles, ...) with --text.
+
+Accented Latin letters the input font has no glyph for are composed from the
+base letter and a mark drawn to match the stroke width of the font, so the
+Dongle fonts gain German and French letters without their TrueType source.
+
+  python3 tools/fontsubset.py src/DongleLight9pt15b.h --name Dongle_Light15pt \\
+      --chars "ÄÖÜäöüéè" -o src/DongleLight9pt15b.h
+"""
+
+import argparse
+import re
+import sys
+import unicodedata
+
+ASCII = [chr(c) for c in range(0x20, 0x7F)]
+
+# Latin letters used by the German and French calendars this was written for
+DEFAULT_CHARS = "ÄÖÜäöüÀÂÇÈÉÊËÎÏÔÙÛàâçèéêëîïôùûÿ"
+
+COMBINING_MARKS = {
+    "\u0300": "grave",
+    "\u0301": "acute",
+    "\u0302": "circumflex",
+    "\u0303": "tilde",
+    "\u0308": "diaeresis",
+    "\u0327": "cedilla",
+}
+
+
+class Glyph:
+    def __init__(self, width, height, x_advance, x_offset, y_offset, rows):
+        self.width = width
+        self.height = height
+        self.x_advance = x_advance
+        self.x_offset = x_offset
+        self.y_offset = y_offset
+        self.rows = rows  # height lists of width 0/1 pixels
+
+    def pixels(self):
+        """Set pixels as (x, y) relative to the pen position and baseline."""
+        for y, row in enumerate(self.rows):
+            for x, bit in enumerate(row):
+                if bit:
+                    yield self.x_offset + x, self.y_offset + y
+
+    @staticmethod
+    def from_pixels(pixels, x_advance):
+        pixels = set(pixels)
+        if not pixels:
+            return Glyph(0, 0, x_advance, 0, 0, [])
+        x0 = min(x for x, _ in pixels)
+        x1 = max(x for x, _ in pixels)
+        y0 = min(y for _, y in pixels)
+        y1 = max(y for _, y in pixels)
+        rows = [[1 if (x, y) in pixels else 0 for x in range(x0, x1 + 1)]
+                for y in range(y0, y1 + 1)]
+        return Glyph(x1 - x0 + 1, y1 - y0 + 1, x_advance, x0, y0, rows)
+
+    def top(self):
+        return self.y_offset
+
+    def bottom(self):
+        return self.y_offset + self.height
+
+    def centre(self):
+        return self.x_offset + self.width / 2
+
+
+def parse_header(text):
+    """Returns ({char: Glyph}, yAdvance) of a GFX or sparse font header."""
+    bitmap_match = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+    glyph_match = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};[^\n]*", text, re.S)
+    if not bitmap_match or not glyph_match:
+        sys.exit("no bitmap or glyph table found")
+    bitmap = [int(b, 16) for b in re.findall(r"0x[0-9A-Fa-f]+", bitmap_match.group(1))]
+
+    # Every glyph line carries its code point in the trailing comment
+    entries = re.findall(
+        r"\{\s*(\d+),\s*(\d+),\s*(\d+),\s*(\d+),\s*(-?\d+),\s*(-?\d+)\s*\}[ ,}\];]*//\s*0x([0-9A-Fa-f]+)",
+        glyph_match.group(0))
+    glyphs = {}
+    for offset, width, height, x_advance, x_offset, y_offset, code in entries:
+        offset, width, height = int(offset), int(width), int(height)
+        rows = []
+        bit = offset * 8
+        for _ in range(height):
+            row = []
+            for _ in range(width):
+                row.append((bitmap[bit >> 3] >> (7 - (bit & 7))) & 1)
+                bit += 1
+            rows.append(row)
+        glyph = Glyph(width, height, int(x_advance), int(x_offset), int(y_offset), rows)
+        # fontconvert stores a blank 1x1 bitmap for the space
+        glyphs[chr(int(code, 16))] = Glyph.from_pixels(glyph.pixels(), glyph.x_advance)
+
+    font_match = re.findall(r"PROGMEM\s*=\s*\{[^{}]*?(\d+)\s*\};", text)
+    if not font_match:
+        sys.exit("no font struct found")
+    return glyphs, int(font_match[-1])
+
+
+class Composer:
+    """Builds accented letters from base glyphs and drawn marks."""
+
+    def __init__(self, glyphs):
+        self.glyphs = glyphs
+        self.stroke = max(1, glyphs["."].width)
+        self.x_top = glyphs["x"].top()
+
+    def dotless_i(self):
+        i = self.glyphs["i"]
+        return Glyph.from_pixels(((x, y) for x, y in i.pixels() if y >= self.x_top),
+                                 i.x_advance)
+
+    def mark(self, name, base):
+        """Pixels of a mark, relative to the mark's own top left corner."""
+        s = self.stroke
+        if name == "diaeresis":
+            gap = max(s, base.width - 2 * s - 2)
+            return [(x + dx, y) for x in (0, s + gap) for dx in range(s) for y in range(s)]
+        if name in ("grave", "acute"):
+            grave = self.glyphs["`"]
+            pixels = [(x - grave.x_offset, y - grave.y_offset) for x, y in grave.pixels()]
+            if name == "acute":
+                pixels = [(grave.width - 1 - x, y) for x, y in pixels]
+            return pixels
+        if name == "circumflex":
+            k = max(2, self.glyphs["`"].height - 1)
+            return [(k + side * r + dx, r) for r in range(k + 1) for side in (-1, 1)
+                    for dx in range(s)]
+        if name == "tilde":
+            tilde = self.glyphs["~"]
+            return [(x - tilde.x_offset, y - tilde.y_offset) for x, y in tilde.pixels()]
+        if name == "cedilla":
+            comma = self.glyphs[","]
+            return [(x - comma.x_offset, y - comma.y_offset) for x, y in comma.pixels()]
+        raise KeyError(name)
+
+    def compose(self, char):
+        decomposed = unicodedata.normalize("NFD", char)
+        base_char, marks = decomposed[0], decomposed[1:]
+        if len(marks) != 1 or marks not in COMBINING_MARKS:
+            return None
+        if base_char == "i" and marks != "\u0327":
+            base = self.dotless_i()
+        elif base_char in self.glyphs:
+            base = self.glyphs[base_char]
+        else:
+            return None
+        name = COMBINING_MARKS[marks]
+        mark = self.mark(name, base)
+        width = max(x for x, _ in mark) + 1
+        height = max(y for _, y in mark) + 1
+        left = round(base.centre() - width / 2)
+        if name == "cedilla":
+            top = base.bottom()
+        else:
+            top = base.top() - max(1, self.stroke) - height
+        pixels = list(base.pixels()) + [(left + x, top + y) for x, y in mark]
+        return Glyph.from_pixels(pixels, base.x_advance)
+
+
+def build_ranges(chars):
+    """Splits the sorted code points into runs of consecutive values."""
+    ranges = []
+    for index, char in enumerate(chars):
+        code = ord(char)
+        if ranges and ranges[-1][1] == code - 1:
+            ranges[-1][1] = code
+        else:
+            ranges.append([code, code, index])
+    return ranges
+
+
+def char_comment(char):
+    code = ord(char)
+    return "0x%02X '%s'" % (code, char) if code < 0x80 else "0x%04X '%s'" % (code, char)
+
+
+def write_header(name, chars, glyphs, y_advance):
+    bitmap = []
+    table = []
+    for char in chars:
+        glyph = glyphs[char]
+        table.append((len(bitmap), glyph))
+        bits = [bit for row in glyph.rows for bit in row]
+        bits += [0] * (-len(bits) % 8)
+        bitmap += [int("".join(map(str, bits[i:i + 8])), 2) for i in range(0, len(bits), 8)]
+    if not bitmap:
+        bitmap = [0]
+    ranges = build_ranges(chars)
+
+    out = []
+    out.append("// Generated by tools/fontsubset.py")
+    out.append("constexpr uint8_t %sBitmaps[] PROGMEM = {" % name)
+    lines = [", ".join("0x%02X" % b for b in bitmap[i:i + 12])
+             for i in range(0, len(bitmap), 12)]
+    out.append(",\n".join("  " + line for line in lines) + " };")
+    out.append("")
+    out.append("constexpr GFXglyph %sGlyphs[] PROGMEM = {" % name)
+    for index, (offset, glyph) in enumerate(table):
+        last = index == len(table) - 1
+        entry = "  { %5d, %3d, %3d, %3d, %4d, %4d }" % (
+            offset, glyph.width, glyph.height, glyph.x_advance, glyph.x_offset, glyph.y_offset)
+        out.append(entry + (" }; // " if last else ",   // ") + char_comment(chars[index]))
+    out.append("")
+    out.append("constexpr GlyphRange %sRanges[] PROGMEM = {" % name)
+    for index, (first, last, glyph) in enumerate(ranges):
+        end = " };" if index == len(ranges) - 1 else ","
+        out.append("  { 0x%04X, 0x%04X, %4d }%s" % (first, last, glyph, end))
+    out.append("")
+    out.append("constexpr SparseFont %s PROGMEM = {" % name)
+    out.append("  %sBitmaps, %sGlyphs, %sRanges, %d, %d };" % (name, name, name, len(ranges), y_advance))
+    out.append("")
+    size = len(bitmap) + 7 * len(table) + 6 * len(ranges) + 14
+    out.append("// Approx. %d bytes" % size)
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("font", help="GFX or sparse font header to read")
+    parser.add_argument("--name", required=True, help="symbol prefix of the output")
+    parser.add_argument("--chars", default=DEFAULT_CHARS, help="characters to add to ASCII")
+    parser.add_argument("--text", nargs="*", default=[], help="UTF-8 files whose characters are needed")
+    parser.add_argument("-o", "--output", help="header to write, stdout if omitted")
+    args = parser.parse_args()
+
+    with open(args.font, encoding="utf-8") as f:
+        glyphs, y_advance = parse_header(f.read())
+
+    wanted = set(ASCII) | set(args.chars)
+    for path in args.text:
+        with open(path, encoding="utf-8") as f:
+            wanted |= {c for c in f.read() if c.isprintable()}
+
+    composer = Composer(glyphs)
+    chars = []
+    for char in sorted(wanted):
+        if ord(char) > 0xFFFF:
+            continue
+        if char not in glyphs:
+            composed = composer.compose(char)
+            if composed is None:
+                print("no glyph for %s, it falls back at run time" % char_comment(char),
+                      file=sys.stderr)
+                continue
+            glyphs[char] = composed
+        chars.append(char)
+
+    header = write_header(args.name, chars, glyphs, y_advance)
+    if args.output:
+        with open(args.output, "w", encoding="utf-8") as f:
+            f.write(header)
+    else:
+        sys.stdout.write(header)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,275 @@
+#!/usr/bin/env python3
+"""Packs an image into a frame file for thin-client mode (see src/compressed_frame.h).
+
+The frame is rendered off-device, by anything that writes an 800x480 image
+in the panel's colours, and served at FRAME_URL, e.g. from Home Assistant's
+www folder as /local/calendar_frame.bin. The panel then only downloads and
+decodes it instead of fetching the events and laying them out.
+
+The image is read as a binary netpbm file (PBM, PGM or PPM), which ImageMagick
+and most renderers write. Pixels are red when clearly red, black when dark and
+white otherwise. For a black and white panel, --planes 1 draws red black.
+
+  convert calendar.png ppm:- | python3 tools/framepack.py - -o calendar_frame.bin
+
+With --base and --delta, a delta file against the previous frame file is
+written too, served at FRAME_DELTA_URL. Panels that still hold that frame
+download only the rows that changed. --base may name the output file, which
+is read before it is replaced:
+
+  ... | python3 tools/framepack.py - -o calendar_frame.bin \
+          --base calendar_frame.bin --delta calendar_frame.delta
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+FRAME_FILE_VERSION = 1
+MAX_PACKET = 128
+FNV_OFFSET_BASIS = 2166136261
+FNV_PRIME = 16777619
+
+
+def read_token(data, pos):
+    """Next whitespace separated header token, skipping comments."""
+    while True:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b"#":
+            while data[pos:pos + 1] not in (b"\n", b""):
+                pos += 1
+            continue
+        start = pos
+        while pos < len(data) and not data[pos:pos + 1].isspace():
+            pos += 1
+        return data[start:pos], pos
+
+
+def read_netpbm(data):
+    """Returns width, height and rows of (r, g, b) pixels."""
+    magic, pos = read_token(data, 0)
+    if magic not in (b"P4", b"P5", b"P6"):
+        sys.exit("not a binary PBM, PGM or PPM image")
+    width, pos = read_token(data, pos)
+    height, pos = read_token(data, pos)
+    width, height = int(width), int(height)
+    maxval = 1
+    if magic != b"P4":
+        maxval, pos = read_token(data, pos)
+        maxval = int(maxval)
+        if maxval > 255:
+            sys.exit("only 8 bit images are supported")
+    pixels = data[pos + 1:]
+
+    rows = []
+    for y in range(height):
+        if magic == b"P4":
+            stride = (width + 7) // 8
+            line = pixels[y * stride:(y + 1) * stride]
+            rows.append([(0, 0, 0) if line[x >> 3] & (0x80 >> (x & 7)) else (255, 255, 255)
+                         for x in range(width)])
+        elif magic == b"P5":
+            line = pixels[y * width:(y + 1) * width]
+            rows.append([(v * 255 // maxval,) * 3 for v in line])
+        else:
+            line = pixels[y * width * 3:(y + 1) * width * 3]
+            rows.append([tuple(line[i + c] * 255 // maxval for c in range(3))
+                         for i in range(0, width * 3, 3)])
+    if len(rows) != height or any(len(row) != width for row in rows):
+        sys.exit("image is cut short")
+    return width, height, rows
+
+
+def ink(pixel):
+    """'r', 'k' or 'w' for a pixel."""
+    r, g, b = pixel
+    if r >= 128 and g < 96 and b < 96:
+        return "r"
+    if (r * 299 + g * 587 + b * 114) // 1000 < 128:
+        return "k"
+    return "w"
+
+
+def plane_row(inks, plane):
+    """GxEPD2 row of a plane: MSB first, a cleared bit is ink."""
+    row = bytearray(b"\xff" * ((len(inks) + 7) // 8))
+    for x, i in enumerate(inks):
+        if i == plane:
+            row[x >> 3] &= ~(0x80 >> (x & 7)) & 0xFF
+    return bytes(row)
+
+
+def packbits(data):
+    """PackBits as in src/packbits.h, runs of two stay in literals."""
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and run < MAX_PACKET and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            out += bytes([(1 - run) & 0xFF, data[i]])
+            i += run
+            continue
+        literal = 1
+        while i + literal < len(data) and literal < MAX_PACKET:
+            j = i + literal
+            if j + 2 < len(data) and data[j] == data[j + 1] == data[j + 2]:
+                break
+            literal += 1
+        out.append(literal - 1)
+        out += data[i:i + literal]
+        i += literal
+    return bytes(out)
+
+
+def unpackbits(data, pos, length):
+    """Decodes a row of length bytes at pos, returns it and the next pos."""
+    out = bytearray()
+    while len(out) < length:
+        if pos >= len(data):
+            raise ValueError("frame file cut short")
+        n = data[pos] - 256 if data[pos] > 127 else data[pos]
+        pos += 1
+        if n >= 0:
+            out += data[pos:pos + n + 1]
+            pos += n + 1
+        elif n != -128:
+            out += bytes([data[pos]]) * (1 - n)
+            pos += 1
+    return bytes(out[:length]), pos
+
+
+def plane_rows(width, rows, planes):
+    """Plane rows of every frame row, black before red."""
+    out = []
+    for pixels in rows:
+        inks = [ink(p) for p in pixels]
+        if planes == 1:
+            inks = ["k" if i == "r" else i for i in inks]
+        out.append([plane_row(inks, "k")] + ([plane_row(inks, "r")] if planes == 2 else []))
+    return out
+
+
+def read_frame(data):
+    """Width, height, planes and plane rows of a frame file."""
+    if data[:4] != b"CALF" or len(data) < 10 or data[4] != FRAME_FILE_VERSION:
+        raise ValueError("not a frame file")
+    planes, width, height = struct.unpack("<BHH", data[5:10])
+    pos = 10
+    rows = []
+    for _ in range(height):
+        row = []
+        for _ in range(planes):
+            plane, pos = unpackbits(data, pos, width // 8)
+            row.append(plane)
+        rows.append(row)
+    return width, height, planes, rows
+
+
+def fb_hash(h, data):
+    """fbHash() of src/fbops.h: whole 32 byte blocks as 8 lanes of little
+    endian words, each lane its own FNV-1a, the rest byte by byte."""
+    blocks = len(data) // 32
+    if blocks:
+        lanes = [h ^ j for j in range(8)]
+        words = struct.unpack("<%dI" % (blocks * 8), data[:blocks * 32])
+        for i, word in enumerate(words):
+            lanes[i % 8] = ((lanes[i % 8] ^ word) * FNV_PRIME) & 0xFFFFFFFF
+        for lane in lanes:
+            h = ((h ^ lane) * FNV_PRIME) & 0xFFFFFFFF
+    for byte in data[blocks * 32:]:
+        h = ((h ^ byte) * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def frame_id(rows):
+    """Hash of the decoded rows, as CompressedFrame::id()."""
+    h = FNV_OFFSET_BASIS
+    for row in rows:
+        h = fb_hash(h, b"".join(row))
+    return h
+
+
+def pack_frame(width, height, rows, planes):
+    out = bytearray(b"CALF")
+    out += struct.pack("<BBHH", FRAME_FILE_VERSION, planes, width, height)
+    for row in rows:
+        for plane in row:
+            out += packbits(plane)
+    return bytes(out)
+
+
+def pack_delta(width, height, rows, planes, base):
+    """Delta file turning the plane rows base into rows, see compressed_frame.h."""
+    out = bytearray(b"CALD")
+    out += struct.pack("<BBHHI", FRAME_FILE_VERSION, planes, width, height, frame_id(base))
+    y = 0
+    while y < height:
+        equal = 0
+        while y + equal < height and rows[y + equal] == base[y + equal]:
+            equal += 1
+        changed = 0
+        while y + equal + changed < height and rows[y + equal + changed] != base[y + equal + changed]:
+            changed += 1
+        out += struct.pack("<HH", equal, changed)
+        for row, old in zip(rows[y + equal:y + equal + changed], base[y + equal:y + equal + changed]):
+            for plane, old_plane in zip(row, old):
+                out += packbits(bytes(a ^ b for a, b in zip(plane, old_plane)))
+        y += equal + changed
+    return bytes(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("image", help="PBM, PGM or PPM image to read, - for stdin")
+    parser.add_argument("--planes", type=int, choices=(1, 2), default=2,
+                        help="2 for three-color panels, 1 for black and white ones")
+    parser.add_argument("-o", "--output", required=True, help="frame file to write")
+    parser.add_argument("--base", help="previous frame file to write a delta against")
+    parser.add_argument("--delta", help="delta file to write, needs --base")
+    args = parser.parse_args()
+    if bool(args.base) != bool(args.delta):
+        sys.exit("--base and --delta go together")
+
+    if args.image == "-":
+        data = sys.stdin.buffer.read()
+    else:
+        with open(args.image, "rb") as f:
+            data = f.read()
+    width, height, rows = read_netpbm(data)
+    if width % 8:
+        sys.exit("width must be a multiple of 8")
+
+    rows = plane_rows(width, rows, args.planes)
+    base = None
+    if args.base:
+        try:
+            with open(args.base, "rb") as f:
+                base = read_frame(f.read())
+        except (OSError, ValueError) as e:
+            print("no delta, %s: %s" % (args.base, e), file=sys.stderr)
+        if base and base[:3] != (width, height, args.planes):
+            print("no delta, %s is another size" % args.base, file=sys.stderr)
+            base = None
+
+    frame = pack_frame(width, height, rows, args.planes)
+    with open(args.output, "wb") as f:
+        f.write(frame)
+    if base:
+        delta = pack_delta(width, height, rows, args.planes, base[3])
+        with open(args.delta, "wb") as f:
+            f.write(delta)
+        print("delta against %s: %d bytes" % (args.base, len(delta)), file=sys.stderr)
+    elif args.delta and os.path.exists(args.delta):
+        # A delta left from an older frame would rebuild that one
+        os.remove(args.delta)
+    raw = width // 8 * height * args.planes
+    print("%dx%d, %d planes: %d of %d bytes" % (width, height, args.planes, len(frame), raw),
+          file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,87 @@
+#ifndef FRAMERENDER_ARDUINO_H
+#define FRAMERENDER_ARDUINO_H
+
+// The part of Arduino.h the layout in calendar_view.cpp uses, for building
+// it natively: String on top of std::string, and min() and max()
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+#ifndef PROGMEM
+#define PROGMEM
+#endif
+
+class String {
+public:
+  String() {}
+  String(const char *text) : data(text ? text : "") {}
+  String(const std::string &text) : data(text) {}
+  explicit String(int value) : data(std::to_string(value)) {}
+  explicit String(unsigned value) : data(std::to_string(value)) {}
+  explicit String(long value) : data(std::to_string(value)) {}
+  explicit String(unsigned long value) : data(std::to_string(value)) {}
+  String(float value, unsigned char decimals)
+  {
+    char text[32];
+    snprintf(text, sizeof(text), "%.*f", decimals, value);
+    data = text;
+  }
+
+  const char *c_str() const { return data.c_str(); }
+  unsigned int length() const { return data.length(); }
+  bool isEmpty() const { return data.empty(); }
+  int toInt() const { return atoi(data.c_str()); }
+
+  int indexOf(char c) const
+  {
+    size_t pos = data.find(c);
+    return pos == std::string::npos ? -1 : (int)pos;
+  }
+
+  String substring(unsigned int from) const
+  {
+    return from < data.length() ? String(data.substr(from)) : String();
+  }
+
+  String substring(unsigned int from, unsigned int to) const
+  {
+    return from < to && from < data.length()
+               ? String(data.substr(from, to - from))
+               : String();
+  }
+
+  String &operator+=(const String &other)
+  {
+    data += other.data;
+    return *this;
+  }
+
+  bool operator==(const String &other) const { return data == other.data; }
+  bool operator!=(const String &other) const { return data != other.data; }
+
+  friend String operator+(String a, const String &b) { return a += b; }
+  friend String operator+(String a, const char *b) { return a += String(b); }
+  friend String operator+(const char *a, const String &b)
+  {
+    return String(a) += b;
+  }
+
+private:
+  std::string data;
+};
+
+template <class T, class U>
+auto min(T a, U b) -> decltype(a < b ? a : b)
+{
+  return a < b ? a : b;
+}
+
+template <class T, class U>
+auto max(T a, U b) -> decltype(a > b ? a : b)
+{
+  return a > b ? a : b;
+}
+
+#endif // FRAMERENDER_ARDUINO_H
@@ -0,0 +1,242 @@
+/* Renders a calendar frame off-device for thin-client mode, with the same
+ * layout code as the firmware: drawCalendar() and drawStatusBar() record a
+ * display list, which is replayed band by band into a CompressedFrame and
+ * saved as the frame file drawCompressedFrame() takes, see
+ * compressed_frame.h.
+ *
+ *   pio run -e framerender
+ *   .pio/build/framerender/program events.tsv frame.bin [planes [base delta]]
+ *
+ * The events file is tab separated, one line per setting or event, as the
+ * firmware gets them from parseResponse(); lines starting with # are
+ * skipped. See sample.tsv.
+ *
+ *   date        current date, YYYY-MM-DD
+ *   week_start  date of the first cell, YYYY-MM-DD
+ *   refreshed   time shown in the status bar
+ *   rssi        WiFi signal in dBm shown in the status bar, 0 for none
+ *   battery_mv  battery voltage shown in the status bar
+ *   event       start day, end day, start time, end time, title; days are
+ *               numbered from 1 at week_start, a full-day event has the
+ *               start time "-"
+ *
+ * planes is 2 for red panels, the default, and 1 for black and white ones.
+ * With base, the previous frame file, a delta file against it is written
+ * too, as framepack.py --base does. base may name the output file, which is
+ * read before it is replaced.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include "calendar_view.h"
+#include "band_render.h"
+#include "compressed_frame.h"
+
+// Rows rendered at a time, as the device would
+#define RENDER_BAND_ROWS 48
+
+struct RenderInput {
+  String date;
+  String weekStart;
+  String refreshed;
+  int rssi = 0;
+  uint32_t batteryMv = 0;
+  std::vector<CalendarEvent> events;
+};
+
+/* Splits line at tabs into at most count fields, in place. Returns the
+ * number of fields.
+ */
+static int splitFields(char *line, char **fields, int count)
+{
+  line[strcspn(line, "\r\n")] = 0;
+  int n = 0;
+  while (n < count)
+  {
+    fields[n++] = line;
+    char *tab = strchr(line, '\t');
+    if (!tab)
+    {
+      break;
+    }
+    *tab = 0;
+    line = tab + 1;
+  }
+  return n;
+}
+
+static bool readInput(const char *path, RenderInput &input)
+{
+  FILE *file = fopen(path, "r");
+  if (!file)
+  {
+    perror(path);
+    return false;
+  }
+  char line[512];
+  int number = 0;
+  bool ok = true;
+  while (ok && fgets(line, sizeof(line), file))
+  {
+    number++;
+    char *f[6];
+    int n = splitFields(line, f, 6);
+    if (f[0][0] == '#' || f[0][0] == 0)
+    {
+      continue;
+    }
+    if (n == 2 && !strcmp(f[0], "date"))
+    {
+      input.date = f[1];
+    }
+    else if (n == 2 && !strcmp(f[0], "week_start"))
+    {
+      input.weekStart = f[1];
+    }
+    else if (n == 2 && !strcmp(f[0], "refreshed"))
+    {
+      input.refreshed = f[1];
+    }
+    else if (n == 2 && !strcmp(f[0], "rssi"))
+    {
+      input.rssi = atoi(f[1]);
+    }
+    else if (n == 2 && !strcmp(f[0], "battery_mv"))
+    {
+      input.batteryMv = strtoul(f[1], nullptr, 10);
+    }
+    else if (n == 6 && !strcmp(f[0], "event"))
+    {
+      CalendarEvent event;
+      event.startDay = atoi(f[1]);
+      event.endDay = atoi(f[2]);
+      event.startTime = f[3];
+      event.endTime = f[4];
+      event.title = f[5];
+      event.isMultiDay = event.startDay != event.endDay;
+      // The firmware drops the same events in parseResponse()
+      if (CalendarView::contains(event.startDay))
+      {
+        input.events.push_back(event);
+      }
+    }
+    else
+    {
+      fprintf(stderr, "%s:%d: can't read \"%s\"\n", path, number, f[0]);
+      ok = false;
+    }
+  }
+  fclose(file);
+  if (ok && (input.date.isEmpty() || input.weekStart.isEmpty()))
+  {
+    fprintf(stderr, "%s: date and week_start are needed\n", path);
+    ok = false;
+  }
+  return ok;
+} // end readInput
+
+static bool readFile(const char *path, std::vector<uint8_t> &data)
+{
+  FILE *file = fopen(path, "rb");
+  if (!file)
+  {
+    perror(path);
+    return false;
+  }
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+  {
+    data.insert(data.end(), chunk, chunk + n);
+  }
+  fclose(file);
+  return true;
+}
+
+static bool writeFile(const char *path, const std::vector<uint8_t> &data)
+{
+  FILE *file = fopen(path, "wb");
+  if (!file || fwrite(data.data(), 1, data.size(), file) != data.size()
+      || fclose(file))
+  {
+    perror(path);
+    return false;
+  }
+  return true;
+}
+
+int main(int argc, char **argv)
+{
+  int planes = argc > 3 ? atoi(argv[3]) : 2;
+  RenderInput input;
+  if ((argc != 3 && argc != 4 && argc != 6) || (planes != 1 && planes != 2))
+  {
+    fprintf(stderr, "usage: %s events.tsv frame.bin [planes [base delta]]\n",
+            argv[0]);
+    return 2;
+  }
+  if (!readInput(argv[1], input))
+  {
+    return 1;
+  }
+  std::vector<uint8_t> file;
+  CompressedFrame base;
+  if (argc == 6 && (!readFile(argv[4], file)
+                    || !base.load(file.data(), file.size())))
+  {
+    fprintf(stderr, "%s: not a frame file\n", argv[4]);
+    return 1;
+  }
+
+  DisplayList dl;
+  drawCalendar(dl, input.events, input.date, "", input.refreshed,
+               input.weekStart);
+  drawStatusBar(dl, input.refreshed, input.rssi, input.batteryMv);
+
+  BandBuffer band;
+  CompressedFrame frame;
+  if (!band.allocate(DISP_WIDTH, RENDER_BAND_ROWS, planes))
+  {
+    fprintf(stderr, "out of memory\n");
+    return 1;
+  }
+  frame.begin(DISP_WIDTH, DISP_HEIGHT, planes);
+  int undrawn = 0;
+  for (int16_t top = 0; top < DISP_HEIGHT; top += RENDER_BAND_ROWS)
+  {
+    band.setBand(top, DISP_HEIGHT - top);
+    undrawn += renderBand(band, dl);
+    frame.appendBand(band);
+  }
+  // Lines and large radii need Adafruit_GFX, which only the firmware has
+  if (undrawn)
+  {
+    fprintf(stderr, "%d draw commands can't be rendered natively\n", undrawn);
+    return 1;
+  }
+
+  file.clear();
+  frame.save(file);
+  if (!writeFile(argv[2], file))
+  {
+    return 1;
+  }
+  if (argc == 6)
+  {
+    file.clear();
+    if (!frame.saveDelta(base, file))
+    {
+      fprintf(stderr, "%s: doesn't match the frame\n", argv[4]);
+      return 1;
+    }
+    if (!writeFile(argv[5], file))
+    {
+      return 1;
+    }
+  }
+  printf("%u events, %u draw commands, %u byte frame (%u raw)\n",
+         (unsigned)input.events.size(), (unsigned)dl.size(),
+         (unsigned)frame.bytes(), (unsigned)frame.rawBytes());
+  return 0;
+} // end main